@@ -0,0 +1,86 @@
+/*
+ * ADC sampling
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "adc.h"
+
+#ifdef ADC_CHANNEL
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#if ADC_PRESCALER == 16
+#define _ADC_ADPS (_BV(ADPS2))
+#elif ADC_PRESCALER == 32
+#define _ADC_ADPS (_BV(ADPS2) | _BV(ADPS0))
+#elif ADC_PRESCALER == 64
+#define _ADC_ADPS (_BV(ADPS2) | _BV(ADPS1))
+#elif ADC_PRESCALER == 128
+#define _ADC_ADPS (_BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0))
+#else
+#error ADC_PRESCALER must be one of 16, 32, 64, 128
+#endif
+
+static int8_t adc_buffer[2][ADC_BLOCK];
+// block and position being filled
+static uint8_t adc_fill;
+static uint8_t adc_pos;
+// completed block + 1, or 0 if there is none
+static volatile uint8_t adc_ready;
+
+ISR(ADC_vect) {
+	// left adjusted, so the high byte holds the upper 8 bits
+	adc_buffer[adc_fill][adc_pos] = (int8_t) (ADCH - 128);
+	adc_pos = (adc_pos + 1) & (ADC_BLOCK - 1);
+	if (adc_pos == 0) {
+		adc_ready = adc_fill + 1;
+		adc_fill ^= 1;
+	}
+}
+
+void adc_init() {
+	adc_fill = 0;
+	adc_pos = 0;
+	adc_ready = 0;
+	// disable the digital input buffer on the analog pin
+	DIDR0 = _BV(ADC_CHANNEL);
+	// AVcc reference, left adjusted result
+	ADMUX = _BV(REFS0) | _BV(ADLAR) | (ADC_CHANNEL);
+	// free running
+	ADCSRB = 0;
+	ADCSRA = _BV(ADEN) | _BV(ADSC) | _BV(ADATE) | _BV(ADIE) | _ADC_ADPS;
+}
+
+const int8_t *adc_get_block() {
+	uint8_t ready;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		ready = adc_ready;
+		adc_ready = 0;
+	}
+	return ready ? adc_buffer[ready - 1] : 0;
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * ADC sampling
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _ADC_H
+#define _ADC_H
+
+#include <stdint.h>
+#include "config.h"
+
+// Supported configuration variables:
+// ADC_CHANNEL: Analog input to sample (0..7). Define to enable the ADC module.
+// The input should be biased to half the supply voltage.
+// Defaults to undefined.
+//#define ADC_CHANNEL 0
+// ADC_PRESCALER: ADC clock divider, one of 16, 32, 64, 128.
+// The ADC runs free, a conversion takes 13 ADC clocks. Only 8 bits are
+// used, so the ADC can be clocked above the 200kHz recommended for 10 bits.
+// Defaults to 64 (19231Hz sampling rate at 16MHz).
+#ifndef ADC_PRESCALER
+#define ADC_PRESCALER 64
+#endif
+// ADC_BLOCK: Number of samples per block.
+// Must be a power of two and no larger than 128. Two blocks are kept in RAM.
+// Defaults to 64.
+#ifndef ADC_BLOCK
+#define ADC_BLOCK 64
+#endif
+#if ADC_BLOCK > 128 || (ADC_BLOCK & (ADC_BLOCK - 1)) != 0
+#error ADC_BLOCK must be a power of two <= 128
+#endif
+
+// The resulting sampling rate (Hz)
+#define ADC_SAMPLE_RATE ((F_CPU) / (ADC_PRESCALER) / 13)
+
+// Starts sampling into a double buffer.
+// Interrupts must be enabled globally.
+// While a bit-banged LED driver is sending, interrupts are off and samples
+// are lost. Blocks stay the same length, but contain a short gap then.
+void adc_init();
+
+// Returns the most recently completed block of ADC_BLOCK signed samples,
+// or 0 if no new block is available. The block stays valid until the
+// following one is complete, i.e. for ADC_BLOCK sample periods.
+const int8_t *adc_get_block();
+
+#endif /*_ADC_H*/
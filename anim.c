@@ -0,0 +1,132 @@
+/*
+ * Compressed animation player
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "anim.h"
+#include "tinymath.h"
+
+#ifdef __AVR_ARCH__
+#define _anim_memcpy memcpy_P
+#else
+#define _anim_memcpy memcpy
+#endif
+
+static inline uint16_t _anim_read16(const uint8_t *p) {
+	return pgm_read_byte(p) | (uint16_t) pgm_read_byte(p + 1) << 8;
+}
+
+bool anim_open(anim_t *anim, const uint8_t *data) {
+	if (pgm_read_byte(&data[0]) != ANIM_MAGIC0 || pgm_read_byte(&data[1]) != ANIM_MAGIC1) {
+		return false;
+	}
+	if (_anim_read16(&data[2]) != WS_WIDTH || _anim_read16(&data[4]) != WS_HEIGHT) {
+		return false;
+	}
+	anim->data = data;
+	anim->frames = _anim_read16(&data[6]);
+	anim->delay = pgm_read_byte(&data[9]);
+	if (anim->delay == 0) {
+		anim->delay = 1;
+	}
+	const uint8_t *p = &data[ANIM_HEADER_SIZE];
+	if (pgm_read_byte(&data[8]) & ANIM_FLAG_PALETTE) {
+		uint8_t count = pgm_read_byte(p++);
+#if PAL_MODE == PAL_MODE_RAM
+		uint8_t i = 0;
+		do {
+			rgb_t color;
+			color.r = pgm_read_byte(p++);
+			color.g = pgm_read_byte(p++);
+			color.b = pgm_read_byte(p++);
+			pal_set(i++, color);
+		} while (i != count);
+#else
+		p += (count ? count : 256) * 3;
+#endif
+	}
+	anim->start = p;
+	anim->pos = p;
+	anim->frame = 0;
+	anim->wait = 0;
+	return anim->frames > 0;
+}
+
+bool anim_next(anim_t *anim) {
+	if (anim->frame == anim->frames) {
+		anim->frame = 0;
+		anim->pos = anim->start;
+	}
+	const uint8_t *p = anim->pos;
+	uint8_t *fb = ws_fb;
+	ws_index_t left = _WS_FB_SIZE;
+	while (left > 0) {
+		uint8_t op = pgm_read_byte(p++);
+		uint8_t count = (op & PXC_COUNT_MASK) + 1;
+		if (count > left) {
+			return false;
+		}
+		_ws_count_cycles(PXC_CYCLES_OP);
+		switch (op & PXC_OP_MASK) {
+		case PXC_OP_LITERAL:
+			_ws_count_cycles(PXC_CYCLES_LITERAL * count);
+			_anim_memcpy(fb, p, count);
+			p += count;
+			break;
+		case PXC_OP_RUN:
+			_ws_count_cycles(PXC_CYCLES_RUN * count);
+			memset(fb, pgm_read_byte(p++), count);
+			break;
+		case PXC_OP_SKIP:
+			break;
+		case PXC_OP_COPY: {
+			ws_index_t offset = (ws_index_t) pgm_read_byte(p++) + 1;
+			if (offset > _WS_FB_SIZE - left) {
+				return false;
+			}
+			// byte-wise, overlapping copies repeat the pattern
+			_ws_count_cycles(PXC_CYCLES_COPY * count);
+			const uint8_t *src = fb - offset;
+			for (uint8_t i = 0; i < count; i++) {
+				fb[i] = src[i];
+			}
+		} break;
+		}
+		fb += count;
+		left -= count;
+	}
+	anim->pos = p;
+	anim->frame++;
+	return true;
+}
+
+bool anim_tick(anim_t *anim) {
+	if (anim->wait == 0) {
+		anim->wait = anim->delay - 1;
+		return anim_next(anim);
+	}
+	anim->wait--;
+	return false;
+}
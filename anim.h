@@ -0,0 +1,91 @@
+/*
+ * Compressed animation player
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _ANIM_H
+#define _ANIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ws2812.h"
+#include "pxcodec.h"
+
+// Animation container format, stored in ROM.
+// All multi-byte values are little endian.
+//
+// offset  size  contents
+// 0       2     magic: 'W', 'A'
+// 2       2     width in pixels
+// 4       2     height in pixels
+// 6       2     number of frames
+// 8       1     flags
+// 9       1     display frames per animation frame (0 = 1)
+// 10            optional palette: count (1 byte, 0 = 256), then r, g, b triples
+//               frame data
+//
+// Each frame is a sequence of pxcodec ops covering the whole frame buffer.
+// The first frame must be a key frame (no SKIP ops), the others may be
+// key or delta frames. Use animenc to build containers from raw frames.
+#define ANIM_MAGIC0 'W'
+#define ANIM_MAGIC1 'A'
+#define ANIM_HEADER_SIZE 10
+// the container includes a palette
+#define ANIM_FLAG_PALETTE 0x01
+
+// Playback state, the only RAM needed besides the frame buffer.
+typedef struct {
+	// start of the container
+	const uint8_t *data;
+	// start of the first frame
+	const uint8_t *start;
+	// next frame
+	const uint8_t *pos;
+	// frame counters
+	uint16_t frame, frames;
+	// display frames per animation frame, and the countdown
+	uint8_t delay, wait;
+} anim_t;
+
+// Opens an animation container stored in ROM.
+// If the container includes a palette and the palette lives in RAM,
+// it is loaded into the palette.
+// Returns false if the container is invalid or doesn't match the display size.
+bool anim_open(anim_t *anim, const uint8_t *data);
+
+// Decodes the next frame into the frame buffer, looping at the end.
+// Returns false if the frame data is invalid.
+//
+// Decoding walks the ops once, with no per-pixel bookkeeping. Rough cost
+// on AVR: ~15 cycles per op plus, per pixel, ~5 cycles for literals and
+// copies, ~2 cycles for runs and nothing for skipped pixels
+// (PXC_CYCLES_* in pxcodec.h).
+bool anim_next(anim_t *anim);
+
+// Advances the animation by one display frame, decoding a new frame
+// when the frame delay has elapsed.
+// Returns true if the frame buffer was updated.
+bool anim_tick(anim_t *anim);
+
+#endif /*_ANIM_H*/
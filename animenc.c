@@ -0,0 +1,199 @@
+/*
+ * Compressed animation encoder
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "ws2812.h"
+#include "pxcodec.h"
+#include "anim.h"
+
+// stand-ins for the player, used to verify the output
+uint8_t ws_fb[_WS_FB_SIZE];
+// anim_next() charges its estimated cycles here (built with WS_VIRTUAL)
+uint32_t ws_virtual_accesses;
+uint32_t ws_virtual_cycles;
+#if PAL_MODE == PAL_MODE_RAM
+pal_t PAL_TABLE_VAR;
+#endif
+
+static void usage(const char *name) {
+	fprintf(stderr, "Usage: %s [-o <output>] [-v <variable>] [-p <palette>] [-k <interval>] [-d <delay>] [<input>]\n", name);
+	fprintf(stderr, "Encodes raw frames (%u bytes each) into a ROM animation container.\n", _WS_FB_SIZE);
+	fprintf(stderr, "-o  Output header file (default: stdout)\n");
+	fprintf(stderr, "-v  Variable name (default: anim_data)\n");
+	fprintf(stderr, "-p  Embed a palette file (256 r, g, b triples)\n");
+	fprintf(stderr, "-k  Key frame interval, 0 = only the first frame (default: 0)\n");
+	fprintf(stderr, "-d  Display frames per animation frame (default: 1)\n");
+	fprintf(stderr, "input defaults to stdin\n");
+	exit(1);
+}
+
+// growing output buffer
+static uint8_t *buf;
+static size_t buf_len, buf_size;
+
+static void emit(const uint8_t *data, size_t len) {
+	if (buf_len + len > buf_size) {
+		buf_size = (buf_len + len) * 2;
+		buf = realloc(buf, buf_size);
+		if (!buf) {
+			fprintf(stderr, "Out of memory\n");
+			exit(1);
+		}
+	}
+	memcpy(&buf[buf_len], data, len);
+	buf_len += len;
+}
+
+static void emit16(uint16_t value) {
+	uint8_t le[2] = { (uint8_t) value, (uint8_t) (value >> 8) };
+	emit(le, 2);
+}
+
+int main(int argc, char **argv) {
+	const char *output = NULL, *var = "anim_data", *palfile = NULL;
+	unsigned int keyint = 0, delay = 1;
+	int opt;
+	while ((opt = getopt(argc, argv, "o:v:p:k:d:h")) != -1) {
+		switch (opt) {
+		case 'o': output = optarg; break;
+		case 'v': var = optarg; break;
+		case 'p': palfile = optarg; break;
+		case 'k': keyint = strtoul(optarg, NULL, 0); break;
+		case 'd': delay = strtoul(optarg, NULL, 0); break;
+		default: usage(argv[0]);
+		}
+	}
+	FILE *in = stdin;
+	if (optind < argc) {
+		in = fopen(argv[optind], "rb");
+		if (!in) {
+			perror(argv[optind]);
+			return 1;
+		}
+	}
+
+	// header, the frame count is patched in later
+	uint8_t magic[2] = { ANIM_MAGIC0, ANIM_MAGIC1 };
+	emit(magic, 2);
+	emit16(WS_WIDTH);
+	emit16(WS_HEIGHT);
+	emit16(0);
+	uint8_t flags[2] = { palfile ? ANIM_FLAG_PALETTE : 0, (uint8_t) delay };
+	emit(flags, 2);
+	if (palfile) {
+		uint8_t pal[1 + 3 * 256];
+		FILE *pf = fopen(palfile, "rb");
+		if (!pf || fread(&pal[1], 3 * 256, 1, pf) != 1) {
+			fprintf(stderr, "Can't read palette %s\n", palfile);
+			return 1;
+		}
+		fclose(pf);
+		pal[0] = 0;
+		emit(pal, sizeof(pal));
+	}
+	size_t header = buf_len;
+
+	uint8_t frame[_WS_FB_SIZE], prev[_WS_FB_SIZE];
+	uint8_t coded[pxc_encode_bound(_WS_FB_SIZE)];
+	unsigned int frames = 0, keys = 0;
+	while (fread(frame, _WS_FB_SIZE, 1, in) == 1) {
+		if (frames == 0xffff) {
+			fprintf(stderr, "Too many frames, truncating\n");
+			break;
+		}
+		bool key = frames == 0 || (keyint > 0 && frames % keyint == 0);
+		size_t len = pxc_encode(frame, key ? NULL : prev, _WS_FB_SIZE, coded);
+		emit(coded, len);
+		memcpy(prev, frame, _WS_FB_SIZE);
+		keys += key;
+		frames++;
+	}
+	if (in != stdin) {
+		fclose(in);
+	}
+	if (frames == 0) {
+		fprintf(stderr, "No frames\n");
+		return 1;
+	}
+	buf[6] = (uint8_t) frames;
+	buf[7] = (uint8_t) (frames >> 8);
+
+	// verify by playing back the whole animation, and add up the decoding
+	// cost on AVR with the estimates from pxcodec.h
+	anim_t anim;
+	if (!anim_open(&anim, buf)) {
+		fprintf(stderr, "Verification failed: invalid header\n");
+		return 1;
+	}
+	uint64_t cycles = 0;
+	uint32_t cycles_max = 0;
+	for (unsigned int i = 0; i < frames; i++) {
+		ws_virtual_cycles = 0;
+		if (!anim_next(&anim)) {
+			fprintf(stderr, "Verification failed: invalid frame %u\n", i);
+			return 1;
+		}
+		cycles += ws_virtual_cycles;
+		if (ws_virtual_cycles > cycles_max) {
+			cycles_max = ws_virtual_cycles;
+		}
+	}
+	if (anim.pos != buf + buf_len || memcmp(ws_fb, prev, _WS_FB_SIZE) != 0) {
+		fprintf(stderr, "Verification failed: output mismatch\n");
+		return 1;
+	}
+
+	size_t raw = (size_t) frames * _WS_FB_SIZE;
+	size_t data = buf_len - header;
+	fprintf(stderr, "%u frames (%u key frames), %zu bytes raw, %zu bytes encoded + %zu bytes header\n", frames, keys, raw, data, header);
+	fprintf(stderr, "compression ratio %.2f:1, %.1f bytes/frame\n", (double) raw / data, (double) data / frames);
+	fprintf(stderr, "estimated decoding cycles per frame on AVR: avg %.0f, max %lu\n", (double) cycles / frames, (unsigned long) cycles_max);
+
+	FILE *out = stdout;
+	if (output) {
+		out = fopen(output, "w");
+		if (!out) {
+			perror(output);
+			return 1;
+		}
+	}
+	fprintf(out, "// %ux%u animation, %u frames, generated by animenc\n", WS_WIDTH, WS_HEIGHT, frames);
+	fprintf(out, "const PROGMEM uint8_t %s[] = {", var);
+	for (size_t i = 0; i < buf_len; i++) {
+		fprintf(out, "%s0x%02x,", i % 16 ? "" : "\n\t", buf[i]);
+	}
+	fprintf(out, "\n};\n");
+	if (out != stdout) {
+		fclose(out);
+	}
+	free(buf);
+	return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Spectrum bar effect
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "bars.h"
+#include "tinymath.h"
+
+// full height: log2(128) = 7 in Q8.8
+#define _BARS_LOG_RANGE (7 * 256)
+
+void bars_init(bars_t *bars, uint8_t low, uint8_t high, uint8_t marker, uint8_t fall) {
+	bars->low = low;
+	bars->high = high;
+	bars->marker = marker;
+	bars->fall = fall;
+	memset(bars->peak, 0, sizeof(bars->peak));
+	memset(bars->hold, 0, sizeof(bars->hold));
+}
+
+// Bar height in 1/256 pixels for a level
+static uint16_t _bars_height(uint8_t level) {
+	if (level <= 1) {
+		return 0;
+	}
+	int16_t l = log2_fix16((uint32_t) level << 16);
+	uint32_t height = (uint32_t) l * WS_HEIGHT * 256 / _BARS_LOG_RANGE;
+	return height > WS_HEIGHT * 256 ? WS_HEIGHT * 256 : (uint16_t) height;
+}
+
+void bars_render(bars_t *bars, const uint8_t *levels, uint8_t nbands) {
+	for (ws_coord_t x = 0; x < WS_WIDTH; x++) {
+		uint16_t height = _bars_height(levels[(uint16_t) x * nbands / WS_WIDTH]);
+		// peaks jump up, hold, then fall
+		if (height >= bars->peak[x]) {
+			bars->peak[x] = height;
+			bars->hold[x] = BARS_PEAK_HOLD;
+		} else if (bars->hold[x] > 0) {
+			bars->hold[x]--;
+		} else {
+			bars->peak[x] = bars->peak[x] > bars->fall ? bars->peak[x] - bars->fall : 0;
+		}
+		ws_coord_t full = height >> 8;
+		uint8_t partial = (uint8_t) height;
+		ws_coord_t marker = bars->peak[x] >> 8;
+		if (marker >= WS_HEIGHT) {
+			marker = WS_HEIGHT - 1;
+		}
+		// r counts rows from the bottom
+		for (ws_coord_t r = 0; r < WS_HEIGHT; r++) {
+			uint8_t index = 0;
+			if (bars->peak[x] > 0 && r == marker) {
+				index = bars->marker;
+			} else if (r <= full) {
+				index = bars->low + (int16_t) (bars->high - bars->low) * r / (WS_HEIGHT > 1 ? WS_HEIGHT - 1 : 1);
+				if (r == full) {
+					index = blend_fix_u8(0, index, partial);
+				}
+			}
+			ws_set_pixel(x, WS_HEIGHT - 1 - r, index);
+		}
+	}
+}
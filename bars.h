@@ -0,0 +1,63 @@
+/*
+ * Spectrum bar effect
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _BARS_H
+#define _BARS_H
+
+#include <stdint.h>
+#include "config.h"
+#include "ws2812.h"
+
+// Supported configuration variables:
+// BARS_PEAK_HOLD: Number of frames a peak marker stays up before it falls.
+// Defaults to 20.
+#ifndef BARS_PEAK_HOLD
+#define BARS_PEAK_HOLD 20
+#endif
+
+// Spectrum bars, growing from the bottom row.
+// Bar heights follow the log of the band level (42dB over the whole
+// display height), with a partial pixel on top. Each column shows one band,
+// or several columns share a band if there are fewer bands than columns.
+// The top pixel is blended towards index 0, so this needs a palette that
+// goes from dark to bright.
+typedef struct {
+	// palette indices of the bottom and top row and the peak marker
+	uint8_t low, high, marker;
+	// peak marker fall speed, in 1/256 pixels per frame
+	uint8_t fall;
+	// peak heights in 1/256 pixels and hold counters, per column
+	uint16_t peak[WS_WIDTH];
+	uint8_t hold[WS_WIDTH];
+} bars_t;
+
+// Sets up the bar colours and clears the peaks.
+void bars_init(bars_t *bars, uint8_t low, uint8_t high, uint8_t marker, uint8_t fall);
+
+// Renders one frame from nbands levels (0..127) into the frame buffer.
+void bars_render(bars_t *bars, const uint8_t *levels, uint8_t nbands);
+
+#endif /*_BARS_H*/
@@ -0,0 +1,204 @@
+/*
+ * Sprite blitter
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "blit.h"
+#include "tinymath.h"
+
+#ifdef __AVR_ARCH__
+#define _blit_memcpy memcpy_P
+#else
+#define _blit_memcpy memcpy
+#endif
+
+// Start of the pixel data of a frame, wrapping frame numbers past the end
+static const uint8_t *_blit_frame_data(const uint8_t *sprite, uint8_t frame) {
+	uint8_t frames = blit_frames(sprite);
+	if (frame >= frames && frames > 0) {
+		frame %= frames;
+	}
+	uint16_t size = BLIT_STRIDE(blit_width(sprite), pgm_read_byte(&sprite[2])) * blit_height(sprite);
+	return sprite + BLIT_HEADER_SIZE + frame * size;
+}
+
+// Copies rows of 8bpp pixels
+static void _blit_rows_8(const uint8_t *src, uint8_t stride, uint8_t *dst, uint8_t rows, uint8_t cols, uint8_t offset, int16_t key) {
+	if (key < 0 && offset == 0) {
+		// straight copy
+		do {
+			_blit_memcpy(dst, src, cols);
+			src += stride;
+			dst += WS_WIDTH;
+		} while (--rows);
+	} else {
+		uint8_t k = (uint8_t) key;
+		bool keyed = key >= 0;
+		do {
+			const uint8_t *s = src;
+			uint8_t *d = dst;
+			uint8_t n = cols;
+			do {
+				uint8_t v = pgm_read_byte(s++);
+				if (!keyed || v != k) {
+					*d = v + offset;
+				}
+				d++;
+			} while (--n);
+			src += stride;
+			dst += WS_WIDTH;
+		} while (--rows);
+	}
+}
+
+// Unpacks rows of 1, 2 or 4bpp pixels, starting at pixel skip of the first byte.
+// Inlined into a separate copy for each bit depth, so all shifts are constant.
+// With key 0, the rest of a byte is skipped as soon as it has no set bits left.
+static inline __attribute__((always_inline)) void _blit_rows_packed(const uint8_t *src, uint8_t stride, uint8_t *dst, uint8_t rows, uint8_t cols, uint8_t skip, const uint8_t bpp, uint8_t offset, int16_t key) {
+	const uint8_t ppb = 8 / bpp;
+	const uint8_t shift = 8 - bpp;
+	uint8_t k = (uint8_t) key;
+	bool keyed = key >= 0;
+	bool zero_key = key == 0;
+	do {
+		const uint8_t *s = src;
+		uint8_t *d = dst;
+		uint8_t n = cols;
+		uint8_t bits = pgm_read_byte(s++) << (skip * bpp);
+		uint8_t left = ppb - skip;
+		for (;;) {
+			if (zero_key && bits == 0) {
+				if (n <= left) {
+					break;
+				}
+				d += left;
+				n -= left;
+			} else {
+				uint8_t m = n < left ? n : left;
+				n -= m;
+				do {
+					uint8_t v = bits >> shift;
+					if (!keyed || v != k) {
+						*d = v + offset;
+					}
+					d++;
+					bits <<= bpp;
+				} while (--m);
+				if (n == 0) {
+					break;
+				}
+			}
+			bits = pgm_read_byte(s++);
+			left = ppb;
+		}
+		src += stride;
+		dst += WS_WIDTH;
+	} while (--rows);
+}
+
+void blit_bitmap(const uint8_t *data, uint8_t width, uint8_t height, uint8_t bpp, int16_t x, int16_t y, uint8_t offset, int16_t key) {
+	_ws_count_cycles(BLIT_CYCLES_SETUP);
+	int16_t x1 = x + width;
+	int16_t y1 = y + height;
+	if (x >= WS_WIDTH || y >= WS_HEIGHT || x1 <= 0 || y1 <= 0) {
+		return;
+	}
+	if (width == 0 || height == 0 || (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8)) {
+		return;
+	}
+	if (key > 255) {
+		key = BLIT_OPAQUE;
+	}
+	// clip to the display, col0 and row0 are the first visible pixel of the bitmap
+	uint8_t col0 = 0;
+	uint8_t row0 = 0;
+	if (x < 0) {
+		col0 = (uint8_t) -x;
+		x = 0;
+	}
+	if (y < 0) {
+		row0 = (uint8_t) -y;
+		y = 0;
+	}
+	if (x1 > WS_WIDTH) {
+		x1 = WS_WIDTH;
+	}
+	if (y1 > WS_HEIGHT) {
+		y1 = WS_HEIGHT;
+	}
+	uint8_t cols = (uint8_t) (x1 - x);
+	uint8_t rows = (uint8_t) (y1 - y);
+	uint8_t stride = BLIT_STRIDE(width, bpp);
+	uint16_t bit0 = (uint16_t) col0 * bpp;
+	const uint8_t *src = data + (uint16_t) row0 * stride + (bit0 >> 3);
+	uint8_t *dst = &ws_fb[ws_get_pixel_index(x, y, WS_WIDTH)];
+	uint8_t skip = (bit0 & 7) / bpp;
+	_ws_count_cycles(rows * (BLIT_CYCLES_ROW + cols * (bpp < 8 ? BLIT_CYCLES_PIXEL_PACKED
+		: key < 0 && offset == 0 ? BLIT_CYCLES_PIXEL_MEMCPY : BLIT_CYCLES_PIXEL_8BPP)));
+	switch (bpp) {
+	case 1:
+		_blit_rows_packed(src, stride, dst, rows, cols, skip, 1, offset, key);
+		break;
+	case 2:
+		_blit_rows_packed(src, stride, dst, rows, cols, skip, 2, offset, key);
+		break;
+	case 4:
+		_blit_rows_packed(src, stride, dst, rows, cols, skip, 4, offset, key);
+		break;
+	default:
+		_blit_rows_8(src, stride, dst, rows, cols, offset, key);
+		break;
+	}
+}
+
+void blit_sprite_frame(const uint8_t *sprite, uint8_t frame, int16_t x, int16_t y, uint8_t offset, int16_t key) {
+	blit_bitmap(_blit_frame_data(sprite, frame), blit_width(sprite), blit_height(sprite), pgm_read_byte(&sprite[2]), x, y, offset, key);
+}
+
+void blit_tilemap(const uint8_t *sheet, const uint8_t *map, uint8_t map_width, uint8_t map_height, int16_t x, int16_t y, uint8_t offset) {
+	uint8_t width = blit_width(sheet);
+	uint8_t height = blit_height(sheet);
+	uint8_t bpp = pgm_read_byte(&sheet[2]);
+	for (uint8_t row = 0; row < map_height; row++, y += height, map += map_width) {
+		if (y >= WS_HEIGHT) {
+			break;
+		}
+		if (y + height <= 0) {
+			continue;
+		}
+		int16_t tx = x;
+		for (uint8_t col = 0; col < map_width; col++, tx += width) {
+			if (tx >= WS_WIDTH) {
+				break;
+			}
+			if (tx + width <= 0) {
+				continue;
+			}
+			blit_bitmap(_blit_frame_data(sheet, map[col]), width, height, bpp, tx, y, offset, BLIT_OPAQUE);
+		}
+	}
+}
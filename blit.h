@@ -0,0 +1,131 @@
+/*
+ * Sprite blitter
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _BLIT_H
+#define _BLIT_H
+
+#include <stdint.h>
+#include "config.h"
+#include "ws2812.h"
+#include "tinymath.h"
+
+// Copies packed bitmaps from flash into the frame buffer.
+//
+// A sprite is a PROGMEM byte array that starts with a header of
+// BLIT_HEADER_SIZE bytes (width, height, bits per pixel, number of frames),
+// followed by the pixel data of each frame. Use BLIT_HEADER() to write it:
+//
+//   const PROGMEM uint8_t arrow[] = {
+//     BLIT_HEADER(4, 3, 1, 1),
+//     0x20, 0xf0, 0x20,
+//   };
+//
+// Pixels are packed most significant bits first, with 1, 2, 4 or 8 bits per
+// pixel. Each row starts on a new byte, so a row takes BLIT_STRIDE(width, bpp)
+// bytes and a frame height times as many. Frames follow each other directly,
+// which makes a sprite sheet of equally sized animation frames or tiles.
+//
+// Each pixel value v is written to the frame buffer as v + offset (modulo
+// 256), so the same sprite can be drawn with different parts of the palette.
+// Pixels equal to the transparent key (before adding the offset) are left
+// alone. Pass BLIT_OPAQUE to draw all pixels.
+//
+// Coordinates are signed and may lie outside the display. The visible part
+// of the sprite is worked out once per blit, the row loops don't do any
+// bounds checks.
+//
+// Rough cycle estimates for avr-gcc -Os on a 16MHz ATmega:
+//
+// format                      setup    per row    per pixel
+// 8bpp, opaque, offset 0      ~80      ~30        ~7 (memcpy_P)
+// 8bpp                        ~80      ~30        ~12
+// 1/2/4bpp                    ~80      ~30        ~14
+// 1/2/4bpp, key 0             ~80      ~30        ~14, ~10 per empty byte
+//
+// Typical sprites:
+//
+// sprite                      cycles
+// 3x5 font glyph, key 0       ~450
+// 8x8, 1bpp, key 0            ~1200
+// 8x8, 8bpp, opaque           ~800
+// 16x16, 4bpp, key 0          ~4100
+// 16x16, 8bpp, key 0          ~3600
+//
+// Clipped rows and columns cost nothing but the setup, except for the bits
+// that need to be shifted out at the start of each row of a packed format.
+//
+// The virtual display charges the same figures, without the empty bytes:
+#define BLIT_CYCLES_SETUP 80
+#define BLIT_CYCLES_ROW 30
+#define BLIT_CYCLES_PIXEL_MEMCPY 7
+#define BLIT_CYCLES_PIXEL_8BPP 12
+#define BLIT_CYCLES_PIXEL_PACKED 14
+
+// Sprite header size in bytes
+#define BLIT_HEADER_SIZE 4
+// Writes a sprite header
+#define BLIT_HEADER(width, height, bpp, frames) (width), (height), (bpp), (frames)
+// Number of bytes in a row of pixels
+#define BLIT_STRIDE(width, bpp) (((width) * (bpp) + 7) / 8)
+// Transparent key that matches no pixel value
+#define BLIT_OPAQUE -1
+
+// Width of a sprite
+static inline uint8_t blit_width(const uint8_t *sprite) {
+	return pgm_read_byte(&sprite[0]);
+}
+
+// Height of a sprite
+static inline uint8_t blit_height(const uint8_t *sprite) {
+	return pgm_read_byte(&sprite[1]);
+}
+
+// Number of frames in a sprite
+static inline uint8_t blit_frames(const uint8_t *sprite) {
+	return pgm_read_byte(&sprite[3]);
+}
+
+// Draws a headerless bitmap from flash with the top left corner at x,y.
+// bpp must be 1, 2, 4 or 8, other values draw nothing.
+void blit_bitmap(const uint8_t *data, uint8_t width, uint8_t height, uint8_t bpp, int16_t x, int16_t y, uint8_t offset, int16_t key);
+
+// Draws one frame of a sprite with the top left corner at x,y.
+// Frame numbers past the end wrap around, so a running counter animates the
+// sprite in a loop.
+void blit_sprite_frame(const uint8_t *sprite, uint8_t frame, int16_t x, int16_t y, uint8_t offset, int16_t key);
+
+// Draws the first frame of a sprite with the top left corner at x,y
+static inline void blit_sprite(const uint8_t *sprite, int16_t x, int16_t y, uint8_t offset, int16_t key) {
+	blit_sprite_frame(sprite, 0, x, y, offset, key);
+}
+
+// Draws a map of tiles with the top left corner at x,y.
+// map holds map_width * map_height frame numbers of the tile sheet in RAM,
+// row by row. Tiles are drawn opaque. Tiles that are completely off the
+// display are skipped without touching the sheet.
+void blit_tilemap(const uint8_t *sheet, const uint8_t *map, uint8_t map_width, uint8_t map_height, int16_t x, int16_t y, uint8_t offset);
+
+#endif /*_BLIT_H*/
@@ -0,0 +1,258 @@
+/*
+ * Sprite blitter test program
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Compile with: gcc -Wall -O1 -g -fsanitize=address,undefined -o blittest blittest.c
+ * To be used on the host system, not a µC.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+// Own configuration instead of config.h: a 30x10 display, wider than the
+// largest test bitmaps are tall, so sprites are clipped on every side.
+// blit.c is built in with it.
+#define _CONFIG_H
+#define PAL_MODE PAL_MODE_CAL
+#define PAL_COMPUTE test_palette
+#define WS_WIDTH 30
+#define WS_HEIGHT 10
+#define WS_PORT D
+#define WS_FIRST_PIN 2
+#include "blit.c"
+
+// Compares blit_bitmap(), blit_sprite_frame() and blit_tilemap() with a plain
+// per-pixel reference that unpacks and clips each pixel on its own, for all
+// bit depths, transparent keys and palette offsets. Exits with an error if
+// any pixel differs or anything outside of the frame buffer or the bitmap
+// was touched (the latter needs the address sanitizer).
+//
+// The row loops have fast paths, which are counted to make sure the random
+// tests reach them: straight copies of opaque 8bpp rows without an offset,
+// and bytes of packed formats that are skipped as a whole with key 0.
+
+#define TEST_BLITS 200000
+#define TEST_SPRITES 20000
+#define TEST_TILEMAPS 20000
+// largest test bitmap
+#define TEST_MAX_WIDTH 40
+#define TEST_MAX_HEIGHT 16
+
+rgb_t test_palette(uint8_t index) {
+	rgb_t ret = { index, index, index };
+	return ret;
+}
+
+uint8_t ws_fb[_WS_FB_SIZE];
+static uint8_t ref[_WS_FB_SIZE];
+
+// visible blits through each fast path
+static unsigned long test_copies, test_zero_bytes;
+
+// Returns pixel col, row of a headerless bitmap
+static uint8_t ref_pixel(const uint8_t *data, uint8_t width, uint8_t bpp, int32_t col, int32_t row) {
+	int32_t bit = row * BLIT_STRIDE(width, bpp) * 8 + col * bpp;
+	return (data[bit / 8] >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1);
+}
+
+static void ref_bitmap(const uint8_t *data, uint8_t width, uint8_t height, uint8_t bpp, int32_t x, int32_t y, uint8_t offset, int16_t key) {
+	if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) {
+		return;
+	}
+	for (int32_t row = 0; row < height; row++) {
+		for (int32_t col = 0; col < width; col++) {
+			int32_t px = x + col, py = y + row;
+			if (px < 0 || py < 0 || px >= WS_WIDTH || py >= WS_HEIGHT) {
+				continue;
+			}
+			uint8_t v = ref_pixel(data, width, bpp, col, row);
+			if (key >= 0 && key <= 255 && v == key) {
+				continue;
+			}
+			ref[py * WS_WIDTH + px] = v + offset;
+		}
+	}
+}
+
+// Counts the fast paths a visible blit goes through
+static void test_count_paths(const uint8_t *data, uint8_t width, uint8_t height, uint8_t bpp, int32_t x, int32_t y, uint8_t offset, int16_t key) {
+	if (x >= WS_WIDTH || y >= WS_HEIGHT || x + width <= 0 || y + height <= 0 || width == 0 || height == 0) {
+		return;
+	}
+	if (bpp == 8 && key < 0 && offset == 0) {
+		test_copies++;
+	}
+	if (bpp < 8 && key == 0) {
+		uint8_t stride = BLIT_STRIDE(width, bpp);
+		for (uint16_t i = 0; i < (uint16_t) stride * height; i++) {
+			if (data[i] == 0) {
+				test_zero_bytes++;
+				break;
+			}
+		}
+	}
+}
+
+// Random pixel data, with many empty bytes for key 0 to skip
+static void test_data(uint8_t *data, uint16_t size) {
+	for (uint16_t i = 0; i < size; i++) {
+		data[i] = rand() % 3 == 0 ? 0 : rand();
+	}
+}
+
+static void test_background(void) {
+	for (unsigned i = 0; i < _WS_FB_SIZE; i++) {
+		ws_fb[i] = ref[i] = rand();
+	}
+}
+
+static int16_t test_key(uint8_t bpp) {
+	switch (rand() % 5) {
+	case 0:
+		return BLIT_OPAQUE;
+	case 1:
+		// out of range keys are treated as opaque
+		return 256 + rand() % 100;
+	case 2:
+		return 0;
+	default:
+		return rand() % (1 << bpp);
+	}
+}
+
+static uint8_t test_bpp(void) {
+	static const uint8_t bpps[] = { 1, 2, 4, 8 };
+	return bpps[rand() % 4];
+}
+
+// One bitmap of exactly the right size on the heap, so the address
+// sanitizer catches reads past its end.
+static bool test_blit(void) {
+	uint8_t bpp = test_bpp();
+	// an invalid bit depth now and then, which must draw nothing
+	if (rand() % 100 == 0) {
+		bpp = 3;
+	}
+	uint8_t width = rand() % (TEST_MAX_WIDTH + 1), height = rand() % (TEST_MAX_HEIGHT + 1);
+	uint16_t size = BLIT_STRIDE(width, bpp) * height;
+	uint8_t *data = malloc(size ? size : 1);
+	test_data(data, size);
+	int32_t x = rand() % (WS_WIDTH + 2 * TEST_MAX_WIDTH) - TEST_MAX_WIDTH;
+	int32_t y = rand() % (WS_HEIGHT + 2 * TEST_MAX_HEIGHT) - TEST_MAX_HEIGHT;
+	// far away now and then, anywhere in the coordinate range
+	if (rand() % 50 == 0) {
+		x = rand() % 65000 - 32500;
+		y = rand() % 65000 - 32500;
+	}
+	uint8_t offset = rand() % 3 == 0 ? 0 : rand();
+	int16_t key = test_key(bpp);
+	test_background();
+	blit_bitmap(data, width, height, bpp, x, y, offset, key);
+	ref_bitmap(data, width, height, bpp, x, y, offset, key);
+	test_count_paths(data, width, height, bpp, x, y, offset, key);
+	free(data);
+	return memcmp(ws_fb, ref, _WS_FB_SIZE) == 0;
+}
+
+// Builds a random sprite sheet on the heap
+static uint8_t *test_sheet(uint8_t *width, uint8_t *height, uint8_t *bpp, uint8_t *frames) {
+	*bpp = test_bpp();
+	*width = 1 + rand() % 12;
+	*height = 1 + rand() % 8;
+	*frames = 1 + rand() % 6;
+	uint16_t size = BLIT_STRIDE(*width, *bpp) * *height * *frames;
+	uint8_t *sheet = malloc(BLIT_HEADER_SIZE + size);
+	uint8_t header[] = { BLIT_HEADER(*width, *height, *bpp, *frames) };
+	memcpy(sheet, header, BLIT_HEADER_SIZE);
+	test_data(&sheet[BLIT_HEADER_SIZE], size);
+	return sheet;
+}
+
+// Frame numbers past the end wrap around
+static bool test_sprite(void) {
+	uint8_t width, height, bpp, frames;
+	uint8_t *sheet = test_sheet(&width, &height, &bpp, &frames);
+	uint8_t frame = rand();
+	int32_t x = rand() % (WS_WIDTH + 24) - 12, y = rand() % (WS_HEIGHT + 16) - 8;
+	uint8_t offset = rand();
+	int16_t key = test_key(bpp);
+	uint16_t size = BLIT_STRIDE(width, bpp) * height;
+	test_background();
+	blit_sprite_frame(sheet, frame, x, y, offset, key);
+	ref_bitmap(&sheet[BLIT_HEADER_SIZE + frame % frames * size], width, height, bpp, x, y, offset, key);
+	free(sheet);
+	return memcmp(ws_fb, ref, _WS_FB_SIZE) == 0;
+}
+
+// A map larger than the display, drawn opaque tile by tile
+static bool test_tilemap(void) {
+	uint8_t width, height, bpp, frames;
+	uint8_t *sheet = test_sheet(&width, &height, &bpp, &frames);
+	uint8_t map_width = 1 + rand() % 10, map_height = 1 + rand() % 6;
+	uint8_t map[10 * 6];
+	for (uint8_t i = 0; i < map_width * map_height; i++) {
+		map[i] = rand();
+	}
+	int32_t x = rand() % (WS_WIDTH + 2 * 10 * width) - 10 * width;
+	int32_t y = rand() % (WS_HEIGHT + 2 * 6 * height) - 6 * height;
+	uint8_t offset = rand();
+	uint16_t size = BLIT_STRIDE(width, bpp) * height;
+	test_background();
+	blit_tilemap(sheet, map, map_width, map_height, x, y, offset);
+	for (uint8_t row = 0; row < map_height; row++) {
+		for (uint8_t col = 0; col < map_width; col++) {
+			uint8_t frame = map[row * map_width + col] % frames;
+			ref_bitmap(&sheet[BLIT_HEADER_SIZE + frame * size], width, height, bpp, x + col * width, y + row * height, offset, BLIT_OPAQUE);
+		}
+	}
+	free(sheet);
+	return memcmp(ws_fb, ref, _WS_FB_SIZE) == 0;
+}
+
+int main(void) {
+	srand(1);
+	unsigned blit_bad = 0, sprite_bad = 0, tilemap_bad = 0;
+	for (unsigned i = 0; i < TEST_BLITS; i++) {
+		blit_bad += !test_blit();
+	}
+	for (unsigned i = 0; i < TEST_SPRITES; i++) {
+		sprite_bad += !test_sprite();
+	}
+	for (unsigned i = 0; i < TEST_TILEMAPS; i++) {
+		tilemap_bad += !test_tilemap();
+	}
+	printf("%-12s %6u, mismatches %u\n", "bitmap", TEST_BLITS, blit_bad);
+	printf("%-12s %6u, mismatches %u\n", "sprite", TEST_SPRITES, sprite_bad);
+	printf("%-12s %6u, mismatches %u\n", "tilemap", TEST_TILEMAPS, tilemap_bad);
+	printf("fast paths: %lu straight copies, %lu with empty bytes under key 0\n", test_copies, test_zero_bytes);
+	bool ok = blit_bad == 0 && sprite_bad == 0 && tilemap_bad == 0;
+	if (test_copies == 0 || test_zero_bytes == 0) {
+		printf("a fast path wasn't tested\n");
+		ok = false;
+	}
+	return ok ? 0 : 1;
+}
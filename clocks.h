@@ -0,0 +1,67 @@
+#define _WS_ENCODING_BIT 1
+#define _WS_ENCODING_BYTE 2
+#if WS_DRIVER == WS_DRIVER_WS2812
+#if F_CPU == 8000000UL
+// byte encoding: T0H 3 cycles (0.375us), T1H 6 (0.750us), bit 10 (1.250us)
+#define _WS_ENCODING _WS_ENCODING_BYTE
+#define _WS_PAD_A 1
+#define _WS_PAD_B 1
+#define _WS_PAD_C 0
+#define _WS_CYCLES_BIT 10
+#elif F_CPU == 12000000UL
+// byte encoding: T0H 5 cycles (0.417us), T1H 10 (0.833us), bit 15 (1.250us)
+#define _WS_ENCODING _WS_ENCODING_BYTE
+#define _WS_PAD_A 3
+#define _WS_PAD_B 3
+#define _WS_PAD_C 1
+#define _WS_CYCLES_BIT 15
+#elif F_CPU == 16000000UL
+// bit encoding: T0H 7 cycles (0.438us), T1H 13 (0.812us), bit ~28 (1.750us)
+#define _WS_ENCODING _WS_ENCODING_BIT
+#define _WS_PAD_A 6
+#define _WS_PAD_B 5
+#define _WS_PAD_C 7
+#define _WS_CYCLES_BIT 28
+#elif F_CPU == 20000000UL
+// bit encoding: T0H 9 cycles (0.450us), T1H 16 (0.800us), bit ~33 (1.650us)
+#define _WS_ENCODING _WS_ENCODING_BIT
+#define _WS_PAD_A 8
+#define _WS_PAD_B 6
+#define _WS_PAD_C 9
+#define _WS_CYCLES_BIT 33
+#else
+#error No WS2812 timing for this F_CPU, add it with genclocks.pl
+#endif
+#elif WS_DRIVER == WS_DRIVER_SK6812
+#if F_CPU == 8000000UL
+// byte encoding: T0H 2 cycles (0.250us), T1H 5 (0.625us), bit 10 (1.250us)
+#define _WS_ENCODING _WS_ENCODING_BYTE
+#define _WS_PAD_A 0
+#define _WS_PAD_B 1
+#define _WS_PAD_C 1
+#define _WS_CYCLES_BIT 10
+#elif F_CPU == 12000000UL
+// byte encoding: T0H 4 cycles (0.333us), T1H 7 (0.583us), bit 15 (1.250us)
+#define _WS_ENCODING _WS_ENCODING_BYTE
+#define _WS_PAD_A 2
+#define _WS_PAD_B 1
+#define _WS_PAD_C 4
+#define _WS_CYCLES_BIT 15
+#elif F_CPU == 16000000UL
+// bit encoding: T0H 5 cycles (0.312us), T1H 10 (0.625us), bit ~28 (1.750us)
+#define _WS_ENCODING _WS_ENCODING_BIT
+#define _WS_PAD_A 4
+#define _WS_PAD_B 4
+#define _WS_PAD_C 10
+#define _WS_CYCLES_BIT 28
+#elif F_CPU == 20000000UL
+// bit encoding: T0H 6 cycles (0.300us), T1H 12 (0.600us), bit ~33 (1.650us)
+#define _WS_ENCODING _WS_ENCODING_BIT
+#define _WS_PAD_A 5
+#define _WS_PAD_B 5
+#define _WS_PAD_C 13
+#define _WS_CYCLES_BIT 33
+#else
+#error No SK6812 timing for this F_CPU, add it with genclocks.pl
+#endif
+#endif
@@ -0,0 +1,3 @@
+#define DIST_TABLE_WIDTH 5
+#define DIST_TABLE_HEIGHT 4
+#define DIST_TABLE {40,29,24,29,40,33,18,8,18,33,33,18,8,18,33,40,29,24,29,40,}
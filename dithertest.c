@@ -0,0 +1,142 @@
+/*
+ * Temporal dithering test program
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Compile with: gcc -Wall -O0 -g -o dithertest dithertest.c
+ * To be used on the host system, not a µC.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+// Own configuration instead of config.h: a 16x16 display with a computed,
+// dithered palette. Every pixel shows its own palette entry.
+#define _CONFIG_H
+#define PAL_MODE PAL_MODE_CAL
+#define PAL_COMPUTE test_palette
+#define PAL_DITHER
+#define WS_WIDTH 16
+#define WS_HEIGHT 16
+#define WS_PORT D
+#define WS_FIRST_PIN 2
+#include "ws2812.h"
+
+// Checks that the average of the dithered output over many frames matches
+// the 16 bit palette, going through the same code as the LED drivers.
+// All 65536 channel values are tested, 256 at a time.
+
+#define TEST_FRAMES 256
+// short windows, aligned and sliding
+#define TEST_SHORT 16
+
+uint8_t ws_fb[_WS_FB_SIZE];
+
+// first value of the current batch
+static uint16_t test_base;
+
+// channel value of a palette entry in the current batch
+static uint16_t test_value(uint8_t index, uint8_t channel) {
+	uint16_t value = test_base + index;
+	// spread the values differently over the channels
+	return channel == 0 ? value : channel == 1 ? (uint16_t) (value * 251) : (uint16_t) ~value;
+}
+
+rgb16_t test_palette(uint8_t index) {
+	return rgb16_mk(test_value(index, 0), test_value(index, 1), test_value(index, 2));
+}
+
+static uint8_t channel(rgb_t color, uint8_t c) {
+	return c == 0 ? color.r : c == 1 ? color.g : color.b;
+}
+
+int main() {
+	// error of the average, in 8 bit steps
+	double full = 0, aligned = 0, sliding = 0;
+	// the same for plain rounding
+	double rounded = 0;
+	static uint8_t out[TEST_FRAMES][_WS_FB_SIZE][3];
+	
+	for (uint32_t base = 0; base < 65536; base += _WS_FB_SIZE) {
+		test_base = (uint16_t) base;
+		for (ws_index_t p = 0; p < _WS_FB_SIZE; p++) {
+			ws_fb[p] = (uint8_t) p;
+		}
+		for (uint16_t f = 0; f < TEST_FRAMES; f++) {
+			uint8_t dither = ws_dither_next();
+			for (ws_index_t p = 0; p < _WS_FB_SIZE; p++) {
+				rgb_t color = ws_pixel_color(p, dither);
+				for (uint8_t c = 0; c < 3; c++) {
+					out[f][p][c] = channel(color, c);
+				}
+			}
+		}
+		for (ws_index_t p = 0; p < _WS_FB_SIZE; p++) {
+			rgb_t round = pal_lookup((uint8_t) p);
+			for (uint8_t c = 0; c < 3; c++) {
+				uint16_t value = test_value((uint8_t) p, c);
+				// saturated values can't be reached, they're capped at 255
+				double target = value >= 0xff00 ? 255.0 : value / 256.0;
+				double e = fabs(channel(round, c) - target);
+				if (e > rounded) {
+					rounded = e;
+				}
+				// sums over the first f frames
+				uint32_t sums[TEST_FRAMES + 1];
+				sums[0] = 0;
+				for (uint16_t f = 0; f < TEST_FRAMES; f++) {
+					sums[f + 1] = sums[f] + out[f][p][c];
+				}
+				e = fabs((double) sums[TEST_FRAMES] / TEST_FRAMES - target);
+				if (e > full) {
+					full = e;
+				}
+				for (uint16_t f = 0; f + TEST_SHORT <= TEST_FRAMES; f++) {
+					e = fabs((double) (sums[f + TEST_SHORT] - sums[f]) / TEST_SHORT - target);
+					if (f % TEST_SHORT == 0 && e > aligned) {
+						aligned = e;
+					}
+					if (e > sliding) {
+						sliding = e;
+					}
+				}
+			}
+		}
+	}
+	
+	printf("max. error of the average, in 8 bit steps:\n");
+	printf("  rounding, no dithering:        %.4f\n", rounded);
+	printf("  %3u frames:                    %.4f\n", TEST_FRAMES, full);
+	printf("  %3u frames, aligned:           %.4f\n", TEST_SHORT, aligned);
+	printf("  %3u frames, any:               %.4f\n", TEST_SHORT, sliding);
+	// exact over the full cycle, within one 16 bit step for aligned windows
+	if (full > 1e-9 || aligned > 1.0 / TEST_SHORT) {
+		printf("FAIL\n");
+		return EXIT_FAILURE;
+	}
+	printf("ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,506 @@
+/*
+ * Drawing primitives
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "draw.h"
+#include "tinymath.h"
+
+// Division rounding towards negative infinity, d > 0
+static int32_t _draw_div_floor(int32_t n, int32_t d) {
+	return n >= 0 ? n / d : -((-n + d - 1) / d);
+}
+
+// Division rounding towards positive infinity, d > 0
+static int32_t _draw_div_ceil(int32_t n, int32_t d) {
+	return -_draw_div_floor(-n, d);
+}
+
+// Restricts the step range imin..imax of a line to the steps i where
+// lo <= floor((a + b * i) / c) <= hi, with c > 0.
+// Returns false if no step is left.
+static bool _draw_clip_steps(int32_t a, int32_t b, int32_t c, int16_t lo, int16_t hi, int16_t *imin, int16_t *imax) {
+	// b * i >= lower and b * i <= upper
+	int32_t lower = (int32_t) lo * c - a;
+	int32_t upper = ((int32_t) hi + 1) * c - 1 - a;
+	int32_t first, last;
+	if (b > 0) {
+		first = _draw_div_ceil(lower, b);
+		last = _draw_div_floor(upper, b);
+	} else if (b < 0) {
+		first = _draw_div_ceil(-upper, -b);
+		last = _draw_div_floor(-lower, -b);
+	} else {
+		if (lower > 0 || upper < 0) {
+			return false;
+		}
+		return *imin <= *imax;
+	}
+	// check for an empty range before narrowing, first and last can be far
+	// outside of the int16_t range for lines that miss the display
+	if (first > *imax || last < *imin || first > last) {
+		return false;
+	}
+	if (first > *imin) {
+		*imin = (int16_t) first;
+	}
+	if (last < *imax) {
+		*imax = (int16_t) last;
+	}
+	return *imin <= *imax;
+}
+
+// Draws a horizontal run without clipping
+static inline void _draw_span(int16_t x0, int16_t x1, int16_t y, uint8_t index) {
+	_ws_count_cycles(DRAW_CYCLES_SPAN + DRAW_CYCLES_SPAN_PIXEL * (x1 - x0 + 1));
+	memset(&ws_fb[ws_get_pixel_index(x0, y, WS_WIDTH)], index, x1 - x0 + 1);
+}
+
+void draw_clear(uint8_t index) {
+	_ws_count_cycles(DRAW_CYCLES_SPAN_PIXEL * (uint32_t) _WS_FB_SIZE);
+	memset(ws_fb, index, _WS_FB_SIZE);
+}
+
+void draw_hline(int16_t x0, int16_t x1, int16_t y, uint8_t index) {
+	_ws_count_cycles(DRAW_CYCLES_HLINE);
+	if (x0 > x1) {
+		int16_t t = x0;
+		x0 = x1;
+		x1 = t;
+	}
+	if (y < 0 || y >= WS_HEIGHT || x1 < 0 || x0 >= WS_WIDTH) {
+		return;
+	}
+	if (x0 < 0) {
+		x0 = 0;
+	}
+	if (x1 >= WS_WIDTH) {
+		x1 = WS_WIDTH - 1;
+	}
+	_draw_span(x0, x1, y, index);
+}
+
+void draw_vline(int16_t x, int16_t y0, int16_t y1, uint8_t index) {
+	_ws_count_cycles(DRAW_CYCLES_VLINE);
+	if (y0 > y1) {
+		int16_t t = y0;
+		y0 = y1;
+		y1 = t;
+	}
+	if (x < 0 || x >= WS_WIDTH || y1 < 0 || y0 >= WS_HEIGHT) {
+		return;
+	}
+	if (y0 < 0) {
+		y0 = 0;
+	}
+	if (y1 >= WS_HEIGHT) {
+		y1 = WS_HEIGHT - 1;
+	}
+	_ws_count_cycles(DRAW_CYCLES_VLINE_PIXEL * (y1 - y0 + 1));
+	uint8_t *pixel = &ws_fb[ws_get_pixel_index(x, y0, WS_WIDTH)];
+	for (int16_t y = y0; y <= y1; y++) {
+		*pixel = index;
+		pixel += WS_WIDTH;
+	}
+}
+
+void draw_rect(int16_t x, int16_t y, int16_t width, int16_t height, uint8_t index) {
+	if (width <= 0 || height <= 0) {
+		return;
+	}
+	int16_t x1 = x + width - 1;
+	int16_t y1 = y + height - 1;
+	draw_hline(x, x1, y, index);
+	draw_hline(x, x1, y1, index);
+	if (height > 2) {
+		draw_vline(x, y + 1, y1 - 1, index);
+		draw_vline(x1, y + 1, y1 - 1, index);
+	}
+}
+
+void draw_fill_rect(int16_t x, int16_t y, int16_t width, int16_t height, uint8_t index) {
+	_ws_count_cycles(DRAW_CYCLES_FILL_RECT);
+	if (width <= 0 || height <= 0) {
+		return;
+	}
+	int16_t x1 = x + width - 1;
+	int16_t y1 = y + height - 1;
+	if (x1 < 0 || y1 < 0 || x >= WS_WIDTH || y >= WS_HEIGHT) {
+		return;
+	}
+	if (x < 0) {
+		x = 0;
+	}
+	if (y < 0) {
+		y = 0;
+	}
+	if (x1 >= WS_WIDTH) {
+		x1 = WS_WIDTH - 1;
+	}
+	if (y1 >= WS_HEIGHT) {
+		y1 = WS_HEIGHT - 1;
+	}
+	for (int16_t row = y; row <= y1; row++) {
+		_draw_span(x, x1, row, index);
+	}
+}
+
+// Line setup shared by draw_line() and draw_line_aa().
+// Lines are walked along the major axis (the one with the larger extent),
+// in positive direction. The minor axis coordinate is derived from the step.
+typedef struct {
+	// start point and extent along the major and minor axes
+	int16_t m0, n0, dm, dn;
+	// frame buffer strides of one step along each axis
+	int16_t mstride, nstride;
+	// largest coordinate on the minor axis
+	int16_t nmax;
+	// step range that is visible along the major axis
+	int16_t imin, imax;
+} _draw_line_t;
+
+static bool _draw_line_setup(_draw_line_t *line, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+	int16_t dx = x1 - x0;
+	int16_t dy = y1 - y0;
+	int16_t mmax;
+	if (abs(dy) > abs(dx)) {
+		line->m0 = y0;
+		line->n0 = x0;
+		line->dm = dy;
+		line->dn = dx;
+		line->mstride = WS_WIDTH;
+		line->nstride = 1;
+		mmax = WS_HEIGHT - 1;
+		line->nmax = WS_WIDTH - 1;
+	} else {
+		line->m0 = x0;
+		line->n0 = y0;
+		line->dm = dx;
+		line->dn = dy;
+		line->mstride = 1;
+		line->nstride = WS_WIDTH;
+		mmax = WS_WIDTH - 1;
+		line->nmax = WS_HEIGHT - 1;
+	}
+	if (line->dm < 0) {
+		line->m0 += line->dm;
+		line->n0 += line->dn;
+		line->dm = -line->dm;
+		line->dn = -line->dn;
+	}
+	// visible range along the major axis
+	line->imin = line->m0 < 0 ? -line->m0 : 0;
+	line->imax = mmax - line->m0 < line->dm ? mmax - line->m0 : line->dm;
+	return line->imin <= line->imax;
+}
+
+void draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t index) {
+	_draw_line_t line;
+	_ws_count_cycles(DRAW_CYCLES_LINE);
+	if (!_draw_line_setup(&line, x0, y0, x1, y1)) {
+		return;
+	}
+	// the minor coordinate at step i is n0 + sn * q(i), with
+	// q(i) = floor((2 * i * |dn| + dm) / (2 * dm)), i.e. i * dn / dm rounded
+	int16_t adn = abs(line.dn);
+	int16_t nstride = line.nstride;
+	int16_t qmin, qmax;
+	if (line.dn < 0) {
+		nstride = -nstride;
+		qmin = line.n0 - line.nmax;
+		qmax = line.n0;
+	} else {
+		qmin = -line.n0;
+		qmax = line.nmax - line.n0;
+	}
+	int32_t twodm = (int32_t) line.dm * 2;
+	if (twodm == 0) {
+		// a single point
+		twodm = 1;
+	}
+	if (!_draw_clip_steps(line.dm, (int32_t) adn * 2, twodm, qmin, qmax, &line.imin, &line.imax)) {
+		return;
+	}
+	// error term and minor coordinate of the first visible step
+	int32_t num = line.dm + (int32_t) adn * 2 * line.imin;
+	int16_t q = num / twodm;
+	int32_t err = num - (int32_t) q * twodm;
+	int16_t n = line.dn < 0 ? line.n0 - q : line.n0 + q;
+	_ws_count_cycles(DRAW_CYCLES_LINE_PIXEL * (uint32_t) (line.imax - line.imin + 1));
+	uint8_t *pixel = &ws_fb[(ws_index_t) ((line.m0 + line.imin) * line.mstride + n * line.nstride)];
+	for (int16_t i = line.imin; i <= line.imax; i++) {
+		*pixel = index;
+		pixel += line.mstride;
+		err += adn * 2;
+		if (err >= twodm) {
+			err -= twodm;
+			pixel += nstride;
+		}
+	}
+}
+
+// Advances the minor coordinate of an anti-aliased line by one step:
+// step and rem are the quotient and remainder of dn * 256 / dm, err
+// collects the remainders.
+static inline void _draw_wu_next(int32_t *pos, int16_t *err, int16_t step, int16_t rem, int16_t dm) {
+	*pos += step;
+	*err += rem;
+	if (*err >= dm) {
+		*err -= dm;
+		(*pos)++;
+	}
+}
+
+// Draws steps first..last of an anti-aliased line, one pixel pair per step.
+// The minor coordinate of step i in 8.8 fixed point is
+// pos = n0 * 256 + floor(i * dn * 256 / dm), stepped exactly with step and
+// rem, so long lines don't drift. Each step draws the pixel at the integer
+// part of pos (weighted 1 - fraction) and the next one on the minor axis
+// (weighted fraction).
+// mask selects both (3), or only the first (1) or second (2) pixel.
+static void _draw_wu_run(const _draw_line_t *line, int16_t first, int16_t last, int16_t step, int16_t rem, uint8_t index, uint8_t mask) {
+	_ws_count_cycles((mask == 3 ? DRAW_CYCLES_LINE_AA_PAIR : DRAW_CYCLES_LINE_AA_PIXEL) * (uint32_t) (last - first + 1));
+	uint8_t *base = &ws_fb[0] + (line->m0 + first) * line->mstride;
+	int16_t dm = line->dm;
+	// first >= 0 and 0 <= rem < dm, so this is floor(first * dn * 256 / dm)
+	int32_t num = (int32_t) first * rem;
+	int16_t carry = dm ? (int16_t) (num / dm) : 0;
+	int16_t err = (int16_t) (num - (int32_t) carry * dm);
+	int32_t pos = (int32_t) line->n0 * 256 + (int32_t) first * step + carry;
+	// split into three loops, so there are no tests inside
+	if (mask == 3) {
+		for (int16_t i = first; i <= last; i++) {
+			uint8_t frac = (uint8_t) pos;
+			uint8_t *pixel = base + (int16_t) (pos >> 8) * line->nstride;
+			pixel[0] = blend_fix_u8(pixel[0], index, 255 - frac);
+			pixel[line->nstride] = blend_fix_u8(pixel[line->nstride], index, frac);
+			base += line->mstride;
+			_draw_wu_next(&pos, &err, step, rem, dm);
+		}
+	} else if (mask == 1) {
+		for (int16_t i = first; i <= last; i++) {
+			uint8_t *pixel = base + (int16_t) (pos >> 8) * line->nstride;
+			*pixel = blend_fix_u8(*pixel, index, 255 - (uint8_t) pos);
+			base += line->mstride;
+			_draw_wu_next(&pos, &err, step, rem, dm);
+		}
+	} else {
+		for (int16_t i = first; i <= last; i++) {
+			uint8_t *pixel = base + ((int16_t) (pos >> 8) + 1) * line->nstride;
+			*pixel = blend_fix_u8(*pixel, index, (uint8_t) pos);
+			base += line->mstride;
+			_draw_wu_next(&pos, &err, step, rem, dm);
+		}
+	}
+}
+
+void draw_line_aa(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t index) {
+	_draw_line_t line;
+	_ws_count_cycles(DRAW_CYCLES_LINE_AA);
+	if (!_draw_line_setup(&line, x0, y0, x1, y1)) {
+		return;
+	}
+	// quotient and remainder of the minor coordinate's 8.8 step, see _draw_wu_run()
+	int16_t step = 0, rem = 0;
+	if (line.dm) {
+		step = (int16_t) _draw_div_floor((int32_t) line.dn * 256, line.dm);
+		rem = (int16_t) ((int32_t) line.dn * 256 - (int32_t) step * line.dm);
+	}
+	// the first pixel of the pair of step i is at n0 + floor(i * dn / dm)
+	int16_t dm = line.dm ? line.dm : 1;
+	int32_t n0 = (int32_t) line.n0 * dm;
+	// the run where the first pixel of the pair is off the display
+	int16_t first = line.imin, last = line.imax;
+	if (_draw_clip_steps(n0, line.dn, dm, -1, -1, &first, &last)) {
+		_draw_wu_run(&line, first, last, step, rem, index, 2);
+	}
+	// the run where both pixels are visible
+	first = line.imin;
+	last = line.imax;
+	if (_draw_clip_steps(n0, line.dn, dm, 0, line.nmax - 1, &first, &last)) {
+		_draw_wu_run(&line, first, last, step, rem, index, 3);
+	}
+	// the run where the second pixel of the pair is off the display
+	first = line.imin;
+	last = line.imax;
+	if (_draw_clip_steps(n0, line.dn, dm, line.nmax, line.nmax, &first, &last)) {
+		_draw_wu_run(&line, first, last, step, rem, index, 1);
+	}
+}
+
+// Draws the left and right halves of a circle row, from the center
+// offset inner to outer on each side. Clips once per span.
+static void _draw_circle_row(int16_t cx, int16_t y, int16_t inner, int16_t outer, uint8_t index) {
+	if (inner <= 0) {
+		draw_hline(cx - outer, cx + outer, y, index);
+	} else {
+		draw_hline(cx - outer, cx - inner, y, index);
+		draw_hline(cx + inner, cx + outer, y, index);
+	}
+}
+
+// Walks the rows of a circle. The half width of row k is the largest w with
+// w^2 + k^2 <= r^2 + r, i.e. all pixels whose center is less than r + 1/2 away
+// from the center, the same criterion the midpoint algorithm uses.
+// w only shrinks with growing k, so it is updated incrementally.
+static void _draw_circle_rows(int16_t cx, int16_t cy, uint8_t r, uint8_t index, bool fill) {
+	uint16_t t = (uint16_t) r * r + r;
+	int16_t w = r;
+	uint16_t w2 = (uint16_t) r * r;
+	_ws_count_cycles(DRAW_CYCLES_CIRCLE);
+	for (int16_t k = 0; k <= r; k++) {
+		// two rows, one above and one below the center
+		_ws_count_cycles(2 * DRAW_CYCLES_CIRCLE_ROW);
+		// half width of the next row
+		int16_t next = -1;
+		if (k < r) {
+			t -= 2 * k + 1;
+			next = w;
+			uint16_t n2 = w2;
+			while (n2 > t) {
+				n2 -= 2 * next - 1;
+				next--;
+			}
+			w2 = n2;
+		}
+		// the outline covers the part of the row that sticks out beyond the next row
+		int16_t inner = fill ? 0 : (next + 1 < w ? next + 1 : w);
+		_draw_circle_row(cx, cy + k, inner, w, index);
+		if (k > 0) {
+			_draw_circle_row(cx, cy - k, inner, w, index);
+		}
+		w = next;
+	}
+}
+
+void draw_circle(int16_t cx, int16_t cy, uint8_t r, uint8_t index) {
+	_draw_circle_rows(cx, cy, r, index, false);
+}
+
+void draw_fill_circle(int16_t cx, int16_t cy, uint8_t r, uint8_t index) {
+	_draw_circle_rows(cx, cy, r, index, true);
+}
+
+// Polygon edge, stepped once per row
+typedef struct {
+	// the edge covers rows top..bottom - 1
+	int16_t top, bottom;
+	// x position on the current row: x + rem / height, with 0 <= rem < height
+	int16_t x, rem;
+	// step per row: step + drem / height, with 0 <= drem < height
+	int16_t step, drem;
+	int16_t height;
+} _draw_edge_t;
+
+void draw_fill_poly(const draw_point_t *points, uint8_t count, uint8_t index) {
+	if (count < 3 || count > DRAW_POLY_MAX) {
+		return;
+	}
+	_draw_edge_t edges[DRAW_POLY_MAX];
+	uint8_t nedges = 0;
+	int16_t top = points[0].y, bottom = points[0].y;
+	for (uint8_t i = 0; i < count; i++) {
+		const draw_point_t *a = &points[i];
+		const draw_point_t *b = &points[i + 1 < count ? i + 1 : 0];
+		if (a->y == b->y) {
+			// horizontal edges are covered by the neighbouring edges
+			continue;
+		}
+		if (a->y > b->y) {
+			const draw_point_t *t = a;
+			a = b;
+			b = t;
+		}
+		_draw_edge_t *edge = &edges[nedges++];
+		_ws_count_cycles(DRAW_CYCLES_POLY_EDGE);
+		edge->top = a->y;
+		edge->bottom = b->y;
+		// exact rational stepping, so crossings stay exact no matter how long the edge is
+		edge->height = b->y - a->y;
+		edge->step = (int16_t) _draw_div_floor(b->x - a->x, edge->height);
+		edge->drem = (b->x - a->x) - edge->step * edge->height;
+		edge->x = a->x;
+		edge->rem = 0;
+		if (a->y < top) {
+			top = a->y;
+		}
+		if (b->y > bottom) {
+			bottom = b->y;
+		}
+	}
+	// visible rows
+	if (top < 0) {
+		top = 0;
+	}
+	if (bottom > WS_HEIGHT) {
+		bottom = WS_HEIGHT;
+	}
+	// move the edges that cross the first visible row to it
+	for (uint8_t e = 0; e < nedges; e++) {
+		_draw_edge_t *edge = &edges[e];
+		if (edge->top < top && edge->bottom > top) {
+			int32_t num = (int32_t) (top - edge->top) * (edge->step * edge->height + edge->drem);
+			int16_t q = (int16_t) _draw_div_floor(num, edge->height);
+			edge->x += q;
+			edge->rem = (int16_t) (num - (int32_t) q * edge->height);
+		}
+	}
+	for (int16_t y = top; y < bottom; y++) {
+		_ws_count_cycles(DRAW_CYCLES_POLY_EDGE_ROW * nedges);
+		// collect crossings with this row, sorted by x
+		int16_t crossings[DRAW_POLY_MAX];
+		uint8_t n = 0;
+		for (uint8_t e = 0; e < nedges; e++) {
+			_draw_edge_t *edge = &edges[e];
+			if (y >= edge->top && y < edge->bottom) {
+				// first pixel whose center is at or right of the crossing
+				int16_t x = edge->rem > 0 ? edge->x + 1 : edge->x;
+				uint8_t j = n++;
+				while (j > 0 && crossings[j - 1] > x) {
+					crossings[j] = crossings[j - 1];
+					j--;
+				}
+				crossings[j] = x;
+				edge->x += edge->step;
+				edge->rem += edge->drem;
+				if (edge->rem >= edge->height) {
+					edge->rem -= edge->height;
+					edge->x++;
+				}
+			}
+		}
+		// fill between pairs of crossings
+		for (uint8_t j = 0; j + 1 < n; j += 2) {
+			int16_t x0 = crossings[j] < 0 ? 0 : crossings[j];
+			int16_t x1 = crossings[j + 1] > WS_WIDTH ? WS_WIDTH : crossings[j + 1];
+			if (x0 < x1) {
+				_draw_span(x0, x1 - 1, y, index);
+			}
+		}
+	}
+}
@@ -0,0 +1,131 @@
+/*
+ * Drawing primitives
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _DRAW_H
+#define _DRAW_H
+
+#include <stdint.h>
+#include "config.h"
+#include "ws2812.h"
+
+// Supported configuration variables:
+// DRAW_POLY_MAX: Maximum number of vertices of a filled polygon.
+// Each vertex costs 12 bytes of stack while filling.
+// Defaults to 8.
+#ifndef DRAW_POLY_MAX
+#define DRAW_POLY_MAX 8
+#endif
+
+// Drawing primitives operating directly on the frame buffer.
+//
+// Coordinates are signed and may lie outside the display, anything outside is
+// cut off. Clipping is done once per primitive (or once per span for circles
+// and polygons), the inner loops write to the frame buffer without any bounds
+// checks. Keep coordinates within -8192..8191.
+//
+// Colors are palette indices. Anti-aliased lines blend the index with
+// blend_fix_u8(), which only makes sense if the palette is an intensity ramp
+// (i.e. index 0 is the background and higher indices are brighter).
+//
+// Rough cycle estimates for avr-gcc -Os on a 16MHz ATmega:
+//
+// function             setup    per pixel
+// draw_hline()         ~40      ~2 (memset)
+// draw_vline()         ~40      ~8
+// draw_fill_rect()     ~60      ~2, plus ~25 per row
+// draw_line()          ~500     ~14
+// draw_line_aa()       ~900     ~50 (two pixels)
+// draw_circle()        ~40      ~40 per row, plus the spans
+// draw_fill_circle()   ~40      ~40 per row, plus the spans
+// draw_fill_poly()     ~250 per edge, ~30 per edge and row plus the spans
+//
+// Line setup is dominated by the clipping divisions. In exchange, a line
+// that is mostly off the display costs no more than a short one.
+//
+// The same estimates, split up the way the virtual display charges them
+// (see _ws_count_cycles() in ws2812.h):
+// a span written with memset(), per span and per pixel
+#define DRAW_CYCLES_SPAN 25
+#define DRAW_CYCLES_SPAN_PIXEL 2
+// clipping in draw_hline(), on top of the span
+#define DRAW_CYCLES_HLINE 15
+#define DRAW_CYCLES_VLINE 40
+#define DRAW_CYCLES_VLINE_PIXEL 8
+// clipping in draw_fill_rect(), on top of one span per row
+#define DRAW_CYCLES_FILL_RECT 35
+#define DRAW_CYCLES_LINE 500
+#define DRAW_CYCLES_LINE_PIXEL 14
+#define DRAW_CYCLES_LINE_AA 900
+// per step, for a pixel pair and for the single pixels at the end points
+#define DRAW_CYCLES_LINE_AA_PAIR 50
+#define DRAW_CYCLES_LINE_AA_PIXEL 30
+// per row, on top of the spans
+#define DRAW_CYCLES_CIRCLE 40
+#define DRAW_CYCLES_CIRCLE_ROW 40
+#define DRAW_CYCLES_POLY_EDGE 250
+#define DRAW_CYCLES_POLY_EDGE_ROW 30
+
+// A polygon vertex
+typedef struct {
+	int16_t x, y;
+} draw_point_t;
+
+// Fills the whole frame buffer with one color
+void draw_clear(uint8_t index);
+
+// Draws a horizontal line from x0 to x1 inclusive
+void draw_hline(int16_t x0, int16_t x1, int16_t y, uint8_t index);
+
+// Draws a vertical line from y0 to y1 inclusive
+void draw_vline(int16_t x, int16_t y0, int16_t y1, uint8_t index);
+
+// Draws the outline of a rectangle with the top left corner at x,y
+void draw_rect(int16_t x, int16_t y, int16_t width, int16_t height, uint8_t index);
+
+// Fills a rectangle with the top left corner at x,y
+void draw_fill_rect(int16_t x, int16_t y, int16_t width, int16_t height, uint8_t index);
+
+// Draws a line from x0,y0 to x1,y1 inclusive (Bresenham)
+void draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t index);
+
+// Draws an anti-aliased line from x0,y0 to x1,y1 inclusive (Wu).
+// Each step along the line covers two pixels, weighted by their distance
+// from the ideal line.
+void draw_line_aa(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t index);
+
+// Draws the outline of a circle with radius r around cx,cy (midpoint criterion)
+void draw_circle(int16_t cx, int16_t cy, uint8_t r, uint8_t index);
+
+// Fills a circle with radius r around cx,cy.
+// Covers exactly the pixels inside the outline drawn by draw_circle().
+void draw_fill_circle(int16_t cx, int16_t cy, uint8_t r, uint8_t index);
+
+// Fills a polygon with up to DRAW_POLY_MAX vertices, using the even-odd rule.
+// Vertices are pixel centers. Pixels on the right and bottom edges are left
+// out, so polygons sharing an edge don't overlap.
+void draw_fill_poly(const draw_point_t *points, uint8_t count, uint8_t index);
+
+#endif /*_DRAW_H*/
@@ -0,0 +1,308 @@
+/*
+ * Drawing primitives test program
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Compile with: gcc -Wall -O1 -g -fsanitize=address,undefined -o drawtest drawtest.c -lm
+ * To be used on the host system, not a µC.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// Own configuration instead of config.h: a 30x10 display, so lines have
+// room to cross it in all directions. draw.c is built in with it.
+#define _CONFIG_H
+#define PAL_MODE PAL_MODE_CAL
+#define PAL_COMPUTE test_palette
+#define WS_WIDTH 30
+#define WS_HEIGHT 10
+#define WS_PORT D
+#define WS_FIRST_PIN 2
+#include "draw.c"
+
+// Compares every primitive with a plain per-pixel reference that clips
+// each pixel on its own, for shapes near the display and far away from it.
+// Exits with an error if any pixel differs or anything outside of the frame
+// buffer was touched (the latter needs the address sanitizer).
+
+#define TEST_NEAR 50000
+#define TEST_FAR 10000
+// coordinate range of the far shapes, see draw.h
+#define TEST_RANGE 8192
+
+rgb_t test_palette(uint8_t index) {
+	rgb_t ret = { index, index, index };
+	return ret;
+}
+
+uint8_t ws_fb[_WS_FB_SIZE];
+static uint8_t ref[_WS_FB_SIZE];
+
+static void ref_plot(int32_t x, int32_t y, uint8_t index) {
+	if (x >= 0 && y >= 0 && x < WS_WIDTH && y < WS_HEIGHT) {
+		ref[y * WS_WIDTH + x] = index;
+	}
+}
+
+static void ref_blend(int32_t x, int32_t y, uint8_t index, uint8_t alpha) {
+	if (x >= 0 && y >= 0 && x < WS_WIDTH && y < WS_HEIGHT) {
+		ref[y * WS_WIDTH + x] = blend_fix_u8(ref[y * WS_WIDTH + x], index, alpha);
+	}
+}
+
+// Bresenham and Wu lines, step by step along the major axis. Only the steps
+// within the display on the major axis are walked, the minor axis is
+// clipped per pixel. The Wu line's minor coordinate is worked out in floating
+// point for each step, then cut to 8.8 fixed point.
+static void ref_line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t index, bool aa) {
+	int32_t dx = x1 - x0, dy = y1 - y0;
+	bool steep = labs(dy) > labs(dx);
+	int32_t m0 = steep ? y0 : x0, n0 = steep ? x0 : y0;
+	int32_t dm = steep ? dy : dx, dn = steep ? dx : dy;
+	int32_t mmax = steep ? WS_HEIGHT - 1 : WS_WIDTH - 1;
+	if (dm < 0) {
+		m0 += dm;
+		n0 += dn;
+		dm = -dm;
+		dn = -dn;
+	}
+	int32_t first = m0 < 0 ? -m0 : 0;
+	int32_t last = mmax - m0 < dm ? mmax - m0 : dm;
+	for (int32_t i = first; i <= last; i++) {
+		int32_t m = m0 + i;
+		if (aa) {
+			double exact = n0 + (dm ? (double) dn * i / dm : 0);
+			int64_t pos = (int64_t) floor(exact * 256);
+			int32_t n = (int32_t) (pos >> 8);
+			uint8_t frac = pos & 255;
+			if (steep) {
+				ref_blend(n, m, index, 255 - frac);
+				ref_blend(n + 1, m, index, frac);
+			} else {
+				ref_blend(m, n, index, 255 - frac);
+				ref_blend(m, n + 1, index, frac);
+			}
+		} else {
+			int32_t q = dm ? (2 * i * labs(dn) + dm) / (2 * dm) : 0;
+			int32_t n = dn < 0 ? n0 - q : n0 + q;
+			if (steep) {
+				ref_plot(n, m, index);
+			} else {
+				ref_plot(m, n, index);
+			}
+		}
+	}
+}
+
+static void ref_fill_rect(int32_t x, int32_t y, int32_t width, int32_t height, uint8_t index) {
+	for (int32_t py = 0; py < WS_HEIGHT; py++) {
+		for (int32_t px = 0; px < WS_WIDTH; px++) {
+			if (px >= x && px < x + width && py >= y && py < y + height) {
+				ref_plot(px, py, index);
+			}
+		}
+	}
+}
+
+static void ref_rect(int32_t x, int32_t y, int32_t width, int32_t height, uint8_t index) {
+	for (int32_t py = 0; py < WS_HEIGHT; py++) {
+		for (int32_t px = 0; px < WS_WIDTH; px++) {
+			if (px >= x && px < x + width && py >= y && py < y + height && (px == x || px == x + width - 1 || py == y || py == y + height - 1)) {
+				ref_plot(px, py, index);
+			}
+		}
+	}
+}
+
+// half width of circle row k, -1 if the row is outside
+static int32_t ref_circle_width(int32_t r, int32_t k) {
+	if (k > r) {
+		return -1;
+	}
+	int32_t w = 0;
+	while ((w + 1) * (w + 1) + k * k <= r * r + r) {
+		w++;
+	}
+	return w;
+}
+
+// a pixel is on the outline if it is inside and a neighbour on the same
+// column or row is outside
+static void ref_circle(int32_t cx, int32_t cy, int32_t r, uint8_t index, bool fill) {
+	for (int32_t k = -r; k <= r; k++) {
+		int32_t w = ref_circle_width(r, labs(k));
+		int32_t next = ref_circle_width(r, labs(k) + 1);
+		for (int32_t x = -w; x <= w; x++) {
+			if (fill || labs(x) > next || labs(x) == w) {
+				ref_plot(cx + x, cy + k, index);
+			}
+		}
+	}
+}
+
+// even-odd rule at the pixel centers, right and bottom edges left out
+static void ref_fill_poly(const draw_point_t *points, uint8_t count, uint8_t index) {
+	for (int32_t y = 0; y < WS_HEIGHT; y++) {
+		for (int32_t x = 0; x < WS_WIDTH; x++) {
+			int crossings = 0;
+			for (uint8_t i = 0; i < count; i++) {
+				draw_point_t a = points[i], b = points[(i + 1) % count];
+				if (a.y == b.y) {
+					continue;
+				}
+				if (a.y > b.y) {
+					draw_point_t t = a;
+					a = b;
+					b = t;
+				}
+				if (y < a.y || y >= b.y) {
+					continue;
+				}
+				// crossing left of or at the pixel center: x - a.x >= (y - a.y) * (b.x - a.x) / (b.y - a.y)
+				if ((int64_t) (x - a.x) * (b.y - a.y) >= (int64_t) (y - a.y) * (b.x - a.x)) {
+					crossings++;
+				}
+			}
+			if (crossings & 1) {
+				ref_plot(x, y, index);
+			}
+		}
+	}
+}
+
+static int32_t test_coord(int32_t range) {
+	return rand() % (2 * range) - range;
+}
+
+static const char *test_names[] = { "line", "line_aa", "rect", "fill_rect", "circle", "fill_circle", "fill_poly" };
+#define TEST_KINDS (sizeof(test_names) / sizeof(test_names[0]))
+
+// Draws one random shape of the given kind with both implementations.
+// near shapes lie around the display, far ones anywhere in the coordinate range.
+static void test_shape(unsigned kind, bool far) {
+	int32_t range = far ? TEST_RANGE : WS_WIDTH * 2;
+	int32_t x0 = test_coord(range), y0 = test_coord(range);
+	int32_t x1 = test_coord(range), y1 = test_coord(range);
+	if (!far) {
+		x0 += WS_WIDTH / 2;
+		x1 += WS_WIDTH / 2;
+	}
+	uint8_t index = rand();
+	switch (kind) {
+	case 0:
+		draw_line(x0, y0, x1, y1, index);
+		ref_line(x0, y0, x1, y1, index, false);
+		break;
+	case 1:
+		draw_line_aa(x0, y0, x1, y1, index);
+		ref_line(x0, y0, x1, y1, index, true);
+		break;
+	case 2: {
+		int32_t width = rand() % (range / 2) - 3, height = rand() % (range / 2) - 3;
+		draw_rect(x0, y0, width, height, index);
+		ref_rect(x0, y0, width, height, index);
+	} break;
+	case 3: {
+		int32_t width = rand() % (range / 2) - 3, height = rand() % (range / 2) - 3;
+		draw_fill_rect(x0, y0, width, height, index);
+		ref_fill_rect(x0, y0, width, height, index);
+	} break;
+	case 4:
+	case 5: {
+		// the radius is 8 bit, so keep the center close enough to matter
+		uint8_t r = rand() % (far ? 256 : 25);
+		x0 = x0 % (r + WS_WIDTH);
+		y0 = y0 % (r + WS_HEIGHT);
+		if (kind == 4) {
+			draw_circle(x0, y0, r, index);
+		} else {
+			draw_fill_circle(x0, y0, r, index);
+		}
+		ref_circle(x0, y0, r, index, kind == 5);
+	} break;
+	default: {
+		draw_point_t points[DRAW_POLY_MAX];
+		uint8_t count = 3 + rand() % (DRAW_POLY_MAX - 2);
+		for (uint8_t i = 0; i < count; i++) {
+			points[i].x = test_coord(range) + (far ? 0 : WS_WIDTH / 2);
+			points[i].y = test_coord(range);
+		}
+		draw_fill_poly(points, count, index);
+		ref_fill_poly(points, count, index);
+	} break;
+	}
+}
+
+// Runs one shape on a random background and compares the results
+static bool test_run(unsigned kind, bool far) {
+	for (unsigned i = 0; i < _WS_FB_SIZE; i++) {
+		ws_fb[i] = ref[i] = rand();
+	}
+	test_shape(kind, far);
+	return memcmp(ws_fb, ref, _WS_FB_SIZE) == 0;
+}
+
+// Lines that used to wrap around the step range and write outside of the
+// frame buffer
+static bool test_regressions(void) {
+	bool ok = true;
+	memset(ws_fb, 0, _WS_FB_SIZE);
+	memset(ref, 0, _WS_FB_SIZE);
+	draw_line(0, 500, 2000, 520, 1);
+	ref_line(0, 500, 2000, 520, 1, false);
+	ok = ok && memcmp(ws_fb, ref, _WS_FB_SIZE) == 0;
+	draw_line_aa(200, 0, 201, 255, 2);
+	ref_line(200, 0, 201, 255, 2, true);
+	ok = ok && memcmp(ws_fb, ref, _WS_FB_SIZE) == 0;
+	draw_line_aa(-8192, -8192, 8191, 8191, 3);
+	ref_line(-8192, -8192, 8191, 8191, 3, true);
+	ok = ok && memcmp(ws_fb, ref, _WS_FB_SIZE) == 0;
+	// a long, shallow line whose gradient used to be truncated to 0
+	draw_line_aa(-8000, 0, 8000, 3, 200);
+	ref_line(-8000, 0, 8000, 3, 200, true);
+	ok = ok && memcmp(ws_fb, ref, _WS_FB_SIZE) == 0;
+	printf("%-12s %s\n", "regressions", ok ? "ok" : "mismatch");
+	return ok;
+}
+
+int main(void) {
+	bool ok = test_regressions();
+	srand(1);
+	for (unsigned kind = 0; kind < TEST_KINDS; kind++) {
+		unsigned near_bad = 0, far_bad = 0;
+		for (unsigned i = 0; i < TEST_NEAR; i++) {
+			near_bad += !test_run(kind, false);
+		}
+		for (unsigned i = 0; i < TEST_FAR; i++) {
+			far_bad += !test_run(kind, true);
+		}
+		printf("%-12s %6u near, %6u far, mismatches %u near, %u far\n", test_names[kind], TEST_NEAR, TEST_FAR, near_bad, far_bad);
+		ok = ok && near_bad == 0 && far_bad == 0;
+	}
+	return ok ? 0 : 1;
+}
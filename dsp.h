@@ -30,6 +30,7 @@
 #include <stdint.h>
 #include <math.h>
 #include "tinymath.h"
+#include "tiny_table.h"
 
 // calculate the sampling period from the sampling frequency
 // dt = 1/fs
@@ -44,6 +45,94 @@
 #define dsp_iir_lowpass_alpha(fc, dt) (uint8_t) (255.0 * ((2.0 * M_PI * (dt) * (fc)) / (2.0 * M_PI * (dt) * (fc) + 1)))
 #define dsp_iir_highpass_alpha(fc, dt) (uint8_t) (255.0 * (1.0 / (2.0 * M_PI * (dt) * (fc) + 1)))
 
+// run-time coefficient lookup
+// these don't need any floating point math and are fast enough to modulate
+// the corner frequency at audio rate.
+//
+// the corner frequency is given as a log frequency parameter lf in Q8.8:
+// fc = IIR_ALPHA_FMIN * 2^(lf / 256 / IIR_ALPHA_STEPS)
+// i.e. 24 steps per octave above 20Hz, up to about 31kHz.
+// the coefficients are read from a table for the sampling rate DSP_SAMPLE_RATE
+// and interpolated linearly. the 8 bit results match the floating point
+// macros above within 1 LSB over the whole range, the 16 bit result is
+// within 3 LSB of the exact value.
+
+// DSP_SAMPLE_RATE: sampling rate of the coefficient table (Hz)
+// One of 8000, 11025, 16000, 22050, 32000, 44100, 48000.
+// Defaults to 44100.
+#ifndef DSP_SAMPLE_RATE
+#define DSP_SAMPLE_RATE 44100
+#endif
+
+extern const PROGMEM uint16_t dsp_iir_alpha_table[];
+
+// convert a corner frequency in Hz to the log frequency parameter
+// floating point, should only be used in constant expressions
+#define dsp_lf(fc) (uint16_t) (log2((double) (fc) / IIR_ALPHA_FMIN) * IIR_ALPHA_STEPS * 256.0 + 0.5)
+
+// low-pass coefficient in Q0.16 fixed point
+// the high-pass coefficient is 65536 minus this value
+static inline uint16_t dsp_iir_alpha16(uint16_t lf) {
+	uint8_t i = lf >> 8;
+	uint8_t f = (uint8_t) lf;
+	uint16_t a0 = pgm_read_word(&dsp_iir_alpha_table[i]);
+	uint16_t a1 = pgm_read_word(&dsp_iir_alpha_table[i + 1]);
+	// the table slope is < 512, so this fits into 16 bits
+	return a0 + (((a1 - a0) >> 1) * f >> 7);
+}
+
+// run-time version of dsp_iir_lowpass_alpha()
+static inline uint8_t dsp_iir_lowpass_alpha_lf(uint16_t lf) {
+	return (uint8_t) (((uint32_t) dsp_iir_alpha16(lf) * 255) >> 16);
+}
+
+// run-time version of dsp_iir_highpass_alpha()
+static inline uint8_t dsp_iir_highpass_alpha_lf(uint16_t lf) {
+	return (uint8_t) (((65536 - (uint32_t) dsp_iir_alpha16(lf)) * 255) >> 16);
+}
+
+// parameter smoothing, to avoid zipper noise when a parameter jumps
+// moves current towards target by 1/2^shift of the distance, and at least by 1
+// call once per sample (or block) with the raw parameter as target
+static inline uint16_t dsp_smooth(uint16_t current, uint16_t target, uint8_t shift) {
+	int32_t diff = (int32_t) target - current;
+	int32_t step = diff >> shift;
+	if (step == 0 && diff != 0) {
+		step = diff > 0 ? 1 : -1;
+	}
+	return (uint16_t) (current + step);
+}
+
+// phase accumulator oscillator
+// the phase wraps around at 65536, one full period of the waveform.
+typedef struct {
+	uint16_t phase;
+	uint16_t step;
+} dsp_osc_t;
+
+// phase step per sample for frequency f at sampling rate fs
+// floating point, should only be used in constant expressions
+#define dsp_osc_step(f, fs) (uint16_t) (65536.0 * (f) / (fs) + 0.5)
+
+static inline void dsp_osc_init(dsp_osc_t *osc, uint16_t step) {
+	osc->phase = 0;
+	osc->step = step;
+}
+
+// sine wave, amplitude 126
+static inline int8_t dsp_osc_sine(dsp_osc_t *osc) {
+	int8_t sample = fastsin8(osc->phase >> 8) * 2;
+	osc->phase += osc->step;
+	return sample;
+}
+
+// square wave, amplitude 127
+static inline int8_t dsp_osc_square(dsp_osc_t *osc) {
+	int8_t sample = osc->phase & 0x8000 ? -127 : 127;
+	osc->phase += osc->step;
+	return sample;
+}
+
 // fixed-point volume scaling
 static inline int8_t dsp_sample_scale(int8_t sample, uint8_t volume) {
 	return mul_fix_su8(sample, volume);
@@ -0,0 +1,189 @@
+/*
+ * FIR filters
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "fir.h"
+
+// Returns coefficient i of the full, symmetric set
+static inline int16_t _fir16_coeff(const fir16_t *fir, uint8_t i) {
+	uint8_t half = (fir->taps + 1) / 2;
+	return (int16_t) pgm_read_word(&fir->coeffs[i < half ? i : fir->taps - 1 - i]);
+}
+
+static inline int8_t _fir8_coeff(const fir8_t *fir, uint8_t i) {
+	uint8_t half = (fir->taps + 1) / 2;
+	return (int8_t) pgm_read_byte(&fir->coeffs[i < half ? i : fir->taps - 1 - i]);
+}
+
+static inline int16_t _fir_clamp16(int32_t value) {
+	if (value > INT16_MAX) {
+		return INT16_MAX;
+	}
+	if (value < INT16_MIN) {
+		return INT16_MIN;
+	}
+	return (int16_t) value;
+}
+
+static inline int8_t _fir_clamp8(int16_t value) {
+	if (value > INT8_MAX) {
+		return INT8_MAX;
+	}
+	if (value < INT8_MIN) {
+		return INT8_MIN;
+	}
+	return (int8_t) value;
+}
+
+void fir16_init(fir16_t *fir, const int16_t *coeffs, uint8_t taps, int16_t *line, uint16_t length) {
+	fir->coeffs = coeffs;
+	fir->taps = taps;
+	fir->mask = length - 1;
+	fir->pos = 0;
+	fir->phase = 0;
+	fir->line = line;
+	memset(line, 0, length * sizeof(line[0]));
+}
+
+int16_t fir16_output(const fir16_t *fir) {
+	const int16_t *line = fir->line;
+	uint8_t mask = fir->mask;
+	// newest and oldest sample, walking towards the center
+	uint8_t a = fir->pos;
+	uint8_t b = fir->pos - (fir->taps - 1);
+	int32_t acc = 0;
+	for (uint8_t i = 0; i < fir->taps / 2; i++) {
+		// fold the two samples sharing coefficient i, halved to stay in 16 bits
+		int16_t sum = (int16_t) (((int32_t) line[a & mask] + line[b & mask]) >> 1);
+		acc += (int32_t) sum * (int16_t) pgm_read_word(&fir->coeffs[i]);
+		a--;
+		b++;
+	}
+	if (fir->taps & 1) {
+		// the center tap, halved like the others
+		acc += ((int32_t) line[a & mask] * (int16_t) pgm_read_word(&fir->coeffs[fir->taps / 2])) >> 1;
+	}
+	// Q15, minus one bit for the halved sums
+	return _fir_clamp16((acc + (1L << 13)) >> 14);
+}
+
+void fir16_block(fir16_t *fir, const int16_t *in, int16_t *out, uint8_t n) {
+	for (uint8_t i = 0; i < n; i++) {
+		out[i] = fir16_put(fir, in[i]);
+	}
+}
+
+uint8_t fir16_decimate(fir16_t *fir, const int16_t *in, int16_t *out, uint8_t n, uint8_t factor) {
+	uint8_t count = 0;
+	for (uint8_t i = 0; i < n; i++) {
+		fir16_push(fir, in[i]);
+		if (++fir->phase >= factor) {
+			fir->phase = 0;
+			out[count++] = fir16_output(fir);
+		}
+	}
+	return count;
+}
+
+void fir16_interpolate(fir16_t *fir, const int16_t *in, int16_t *out, uint8_t n, uint8_t factor) {
+	for (uint8_t i = 0; i < n; i++) {
+		fir16_push(fir, in[i]);
+		// output p only sees the coefficients p, p + factor, p + 2 * factor...
+		// all others fall on inserted zeros
+		for (uint8_t p = 0; p < factor; p++) {
+			int32_t acc = 0;
+			uint8_t s = fir->pos;
+			for (uint8_t k = p; k < fir->taps; k += factor) {
+				acc += (int32_t) fir->line[s & fir->mask] * _fir16_coeff(fir, k);
+				s--;
+			}
+			*out++ = _fir_clamp16((acc * factor + (1L << 14)) >> 15);
+		}
+	}
+}
+
+void fir8_init(fir8_t *fir, const int8_t *coeffs, uint8_t taps, int8_t *line, uint16_t length) {
+	fir->coeffs = coeffs;
+	fir->taps = taps;
+	fir->mask = length - 1;
+	fir->pos = 0;
+	fir->phase = 0;
+	fir->line = line;
+	memset(line, 0, length * sizeof(line[0]));
+}
+
+int8_t fir8_output(const fir8_t *fir) {
+	const int8_t *line = fir->line;
+	uint8_t mask = fir->mask;
+	uint8_t a = fir->pos;
+	uint8_t b = fir->pos - (fir->taps - 1);
+	int16_t acc = 0;
+	for (uint8_t i = 0; i < fir->taps / 2; i++) {
+		// halving the folded sum keeps it at 8 bits, so one 8x8 multiply does
+		int8_t sum = (int8_t) (((int16_t) line[a & mask] + line[b & mask]) >> 1);
+		acc += mul_us_s8(sum, (int8_t) pgm_read_byte(&fir->coeffs[i]));
+		a--;
+		b++;
+	}
+	if (fir->taps & 1) {
+		acc += mul_us_s8(line[a & mask], (int8_t) pgm_read_byte(&fir->coeffs[fir->taps / 2])) >> 1;
+	}
+	return _fir_clamp8((acc + (1 << 5)) >> 6);
+}
+
+void fir8_block(fir8_t *fir, const int8_t *in, int8_t *out, uint8_t n) {
+	for (uint8_t i = 0; i < n; i++) {
+		out[i] = fir8_put(fir, in[i]);
+	}
+}
+
+uint8_t fir8_decimate(fir8_t *fir, const int8_t *in, int8_t *out, uint8_t n, uint8_t factor) {
+	uint8_t count = 0;
+	for (uint8_t i = 0; i < n; i++) {
+		fir8_push(fir, in[i]);
+		if (++fir->phase >= factor) {
+			fir->phase = 0;
+			out[count++] = fir8_output(fir);
+		}
+	}
+	return count;
+}
+
+void fir8_interpolate(fir8_t *fir, const int8_t *in, int8_t *out, uint8_t n, uint8_t factor) {
+	for (uint8_t i = 0; i < n; i++) {
+		fir8_push(fir, in[i]);
+		for (uint8_t p = 0; p < factor; p++) {
+			int16_t acc = 0;
+			uint8_t s = fir->pos;
+			for (uint8_t k = p; k < fir->taps; k += factor) {
+				acc += mul_us_s8(fir->line[s & fir->mask], _fir8_coeff(fir, k));
+				s--;
+			}
+			*out++ = _fir_clamp8(((int32_t) acc * factor + (1 << 6)) >> 7);
+		}
+	}
+}
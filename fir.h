@@ -0,0 +1,144 @@
+/*
+ * FIR filters
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _FIR_H
+#define _FIR_H
+
+#include <stdint.h>
+#include "tinymath.h"
+
+// Finite impulse response filters with symmetric (linear phase) coefficients.
+//
+// Coefficients come from genfir.pl, which writes NAME_TAPS and the first half
+// of the coefficients (plus the center tap for odd lengths) as NAME_Q15 for
+// 16 bit filters and NAME_Q7 for 8 bit filters. They must reside in ROM:
+//   static const PROGMEM int16_t bass_coeffs[] = FIR_BASS_Q15;
+//
+// The delay line is a ring buffer with a power-of-two length of at least
+// the number of taps, indexed with a mask instead of a modulo. Since the
+// coefficients are symmetric, the two samples sharing a coefficient are added
+// first, which halves the number of multiplications. The sum is halved to
+// stay in range, which costs half an LSB of precision.
+//
+// Rough cycle estimates for avr-gcc -Os on a 16MHz ATmega:
+//
+// function             per tap    fixed
+// fir8_put()           ~8         ~60
+// fir16_put()          ~25        ~90
+// fir*_interpolate()   ~2x        per output, no folding
+//
+// e.g. a 31 tap int8 filter takes about 310 cycles per sample, so a
+// 16MHz ATmega can run it at up to 50kHz with nothing else to do.
+
+// 16 bit filter state, Q15 coefficients
+typedef struct {
+	// first half of the coefficients in ROM
+	const int16_t *coeffs;
+	// number of taps
+	uint8_t taps;
+	// delay line length - 1
+	uint8_t mask;
+	// position of the newest sample
+	uint8_t pos;
+	// decimation phase
+	uint8_t phase;
+	// the delay line
+	int16_t *line;
+} fir16_t;
+
+// 8 bit filter state, Q7 coefficients
+typedef struct {
+	const int8_t *coeffs;
+	uint8_t taps;
+	uint8_t mask;
+	uint8_t pos;
+	uint8_t phase;
+	int8_t *line;
+} fir8_t;
+
+// Sets up a filter. line must hold length samples, where length is a power
+// of two (up to 256) and at least taps. Any other length is undefined
+// behaviour and not checked: the delay line skips or overwrites samples,
+// and a length of 0 reaches outside of line.
+// The delay line is cleared.
+void fir16_init(fir16_t *fir, const int16_t *coeffs, uint8_t taps, int16_t *line, uint16_t length);
+
+// Adds a sample to the delay line, without computing an output.
+static inline void fir16_push(fir16_t *fir, int16_t x) {
+	fir->pos = (fir->pos + 1) & fir->mask;
+	fir->line[fir->pos] = x;
+}
+
+// Computes the output for the current contents of the delay line.
+int16_t fir16_output(const fir16_t *fir);
+
+// Adds a sample and returns the filtered output.
+static inline int16_t fir16_put(fir16_t *fir, int16_t x) {
+	fir16_push(fir, x);
+	return fir16_output(fir);
+}
+
+// Filters n samples. in and out may be the same buffer.
+void fir16_block(fir16_t *fir, const int16_t *in, int16_t *out, uint8_t n);
+
+// Filters and decimates: only every factor-th output is computed.
+// Keeps track of the phase between calls, so n needn't be a multiple of factor.
+// Returns the number of samples written to out.
+// For a clean result, the filter should cut off below fs / (2 * factor).
+uint8_t fir16_decimate(fir16_t *fir, const int16_t *in, int16_t *out, uint8_t n, uint8_t factor);
+
+// Interpolates: inserts factor - 1 zeros after each input sample and filters.
+// Only the non-zero samples are multiplied (polyphase). The gain is multiplied
+// by factor to make up for the zeros. out must hold n * factor samples.
+// For a clean result, the filter should cut off below fs / (2 * factor),
+// where fs is the output rate.
+void fir16_interpolate(fir16_t *fir, const int16_t *in, int16_t *out, uint8_t n, uint8_t factor);
+
+// 8 bit versions of the above, with the same restrictions on length.
+// The accumulator is 16 bits wide. This is enough as long as the sum of the
+// absolute coefficient values stays below 2.0, which is true for the usual
+// low-pass, high-pass and band-pass filters.
+void fir8_init(fir8_t *fir, const int8_t *coeffs, uint8_t taps, int8_t *line, uint16_t length);
+
+static inline void fir8_push(fir8_t *fir, int8_t x) {
+	fir->pos = (fir->pos + 1) & fir->mask;
+	fir->line[fir->pos] = x;
+}
+
+int8_t fir8_output(const fir8_t *fir);
+
+static inline int8_t fir8_put(fir8_t *fir, int8_t x) {
+	fir8_push(fir, x);
+	return fir8_output(fir);
+}
+
+void fir8_block(fir8_t *fir, const int8_t *in, int8_t *out, uint8_t n);
+
+uint8_t fir8_decimate(fir8_t *fir, const int8_t *in, int8_t *out, uint8_t n, uint8_t factor);
+
+void fir8_interpolate(fir8_t *fir, const int8_t *in, int8_t *out, uint8_t n, uint8_t factor);
+
+#endif /*_FIR_H*/
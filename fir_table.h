@@ -0,0 +1,6 @@
+#define FIR_HALFBAND_TAPS 31
+#define FIR_HALFBAND_Q15 {-56,0,96,0,-221,0,462,0,-878,0,1609,0,-3176,0,10342,16412,}
+#define FIR_HALFBAND_Q7 {0,0,0,0,-1,0,2,0,-3,0,6,0,-12,0,40,64,}
+#define FIR_SMOOTH_TAPS 15
+#define FIR_SMOOTH_Q15 {144,310,789,1620,2698,3784,4593,4892,}
+#define FIR_SMOOTH_Q7 {1,1,3,6,11,15,18,18,}
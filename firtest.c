@@ -0,0 +1,266 @@
+/*
+ * FIR filter test program
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Compile with: gcc -Wall -O0 -g -o firtest firtest.c fir.c tinymath.c -lm
+ * To be used on the host system, not a µC.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "fir.h"
+#include "fir_table.h"
+
+// Checks the FIR filters in fir.c against a double precision reference
+// with the same (quantised) coefficients, and the decimating and
+// interpolating variants against the plain filter.
+
+// number of samples per test signal
+#define FT_SAMPLES 4000
+// delay line length, enough for all example filters
+#define FT_LENGTH 32
+// limit for the difference of the interpolated output to the reference,
+// in LSB: only the final rounding, the sums aren't folded
+#define FT_MAX_ERROR_INTERPOLATE (0.5 + 1e-9)
+
+static const PROGMEM int16_t halfband16[] = FIR_HALFBAND_Q15;
+static const PROGMEM int16_t smooth16[] = FIR_SMOOTH_Q15;
+static const PROGMEM int8_t halfband8[] = FIR_HALFBAND_Q7;
+static const PROGMEM int8_t smooth8[] = FIR_SMOOTH_Q7;
+
+static unsigned int failures;
+
+static void check(bool ok, const char *what) {
+	if (!ok) {
+		printf("  FAILED: %s\n", what);
+		failures++;
+	}
+}
+
+// Fills a buffer with random samples in -amplitude..amplitude.
+static void noise16(int16_t *x, unsigned int n, int amplitude) {
+	for (unsigned int i = 0; i < n; i++) {
+		x[i] = (int16_t) (rand() % (2 * amplitude + 1) - amplitude);
+	}
+}
+
+static void noise8(int8_t *x, unsigned int n, int amplitude) {
+	for (unsigned int i = 0; i < n; i++) {
+		x[i] = (int8_t) (rand() % (2 * amplitude + 1) - amplitude);
+	}
+}
+
+// Returns coefficient k of the full, symmetric set, as a fraction.
+static double coeff(const void *half, bool q15, uint8_t taps, uint8_t k) {
+	uint8_t i = k < (taps + 1) / 2 ? k : taps - 1 - k;
+	return q15 ? ((const int16_t *) half)[i] / 32768.0 : ((const int8_t *) half)[i] / 128.0;
+}
+
+// Returns the limit for the difference of the filter output to the
+// reference, in LSB. On top of the final rounding, each folded pair loses
+// up to half an input LSB when the sum is halved, which costs up to the
+// pair's coefficient at the output. The halved center tap loses up to one
+// LSB of the accumulator.
+static double max_error(const void *half, bool q15, uint8_t taps) {
+	double limit = 0.5 + (q15 ? 1.0 / (1 << 14) : 1.0 / (1 << 6));
+	for (uint8_t k = 0; k < taps / 2; k++) {
+		limit += fabs(coeff(half, q15, taps, k));
+	}
+	return limit;
+}
+
+// Output i of the reference filter, with gain applied to every coefficient.
+// up > 1 filters the input with up - 1 zeros inserted after each sample.
+static double reference(const double *x, unsigned int i, const void *half, bool q15, uint8_t taps, unsigned int up) {
+	double y = 0;
+	for (uint8_t k = 0; k < taps && k <= i; k++) {
+		if ((i - k) % up == 0) {
+			y += x[(i - k) / up] * coeff(half, q15, taps, k) * up;
+		}
+	}
+	return y;
+}
+
+static void test16(const char *name, const int16_t *half, uint8_t taps) {
+	static int16_t x[FT_SAMPLES], y[FT_SAMPLES], d[FT_SAMPLES], u[4 * FT_SAMPLES];
+	static double xd[FT_SAMPLES];
+	int16_t line[FT_LENGTH];
+	fir16_t fir;
+	printf("%s, 16 bit, %u taps\n", name, taps);
+
+	// full scale noise would clip, keep the output in range
+	noise16(x, FT_SAMPLES, 16000);
+	for (unsigned int i = 0; i < FT_SAMPLES; i++) {
+		xd[i] = x[i];
+	}
+	fir16_init(&fir, half, taps, line, FT_LENGTH);
+	fir16_block(&fir, x, y, 200);
+	for (unsigned int i = 200; i < FT_SAMPLES; i++) {
+		y[i] = fir16_put(&fir, x[i]);
+	}
+	double worst = 0;
+	for (unsigned int i = 0; i < FT_SAMPLES; i++) {
+		double e = fabs(y[i] - reference(xd, i, half, true, taps, 1));
+		if (e > worst) {
+			worst = e;
+		}
+	}
+	double limit = max_error(half, true, taps);
+	printf("  filter: max. error %.2f LSB, limit %.2f\n", worst, limit);
+	check(worst <= limit, "filter output differs from the reference");
+
+	// decimation, in blocks that don't line up with the factor
+	for (uint8_t factor = 2; factor <= 5; factor++) {
+		fir16_init(&fir, half, taps, line, FT_LENGTH);
+		unsigned int count = 0;
+		for (unsigned int i = 0; i < FT_SAMPLES; i += 77) {
+			uint8_t n = FT_SAMPLES - i < 77 ? FT_SAMPLES - i : 77;
+			count += fir16_decimate(&fir, &x[i], &d[count], n, factor);
+		}
+		bool same = count == FT_SAMPLES / factor;
+		for (unsigned int i = 0; same && i < count; i++) {
+			same = d[i] == y[(i + 1) * factor - 1];
+		}
+		printf("  decimate by %u: %u outputs, %s\n", factor, count, same ? "same as every n-th output" : "mismatch");
+		check(same, "decimated output differs from the filter output");
+	}
+
+	// interpolation
+	for (uint8_t factor = 2; factor <= 4; factor++) {
+		noise16(x, FT_SAMPLES, 16000 / factor);
+		for (unsigned int i = 0; i < FT_SAMPLES; i++) {
+			xd[i] = x[i];
+		}
+		fir16_init(&fir, half, taps, line, FT_LENGTH);
+		for (unsigned int i = 0; i < FT_SAMPLES; i += 100) {
+			fir16_interpolate(&fir, &x[i], &u[i * factor], 100, factor);
+		}
+		worst = 0;
+		for (unsigned int i = 0; i < FT_SAMPLES * factor; i++) {
+			double e = fabs(u[i] - reference(xd, i, half, true, taps, factor));
+			if (e > worst) {
+				worst = e;
+			}
+		}
+		printf("  interpolate by %u: max. error %.2f LSB\n", factor, worst);
+		check(worst <= FT_MAX_ERROR_INTERPOLATE, "interpolated output differs from the reference");
+	}
+
+	// the DC gain is exact
+	fir16_init(&fir, half, taps, line, FT_LENGTH);
+	int16_t dc = 0;
+	for (unsigned int i = 0; i < FT_LENGTH; i++) {
+		dc = fir16_put(&fir, 12345);
+	}
+	printf("  DC: 12345 -> %d\n", dc);
+	check(dc == 12345, "DC gain is not 1");
+}
+
+static void test8(const char *name, const int8_t *half, uint8_t taps) {
+	static int8_t x[FT_SAMPLES], y[FT_SAMPLES], d[FT_SAMPLES], u[4 * FT_SAMPLES];
+	static double xd[FT_SAMPLES];
+	int8_t line[FT_LENGTH];
+	fir8_t fir;
+	printf("%s, 8 bit, %u taps\n", name, taps);
+
+	noise8(x, FT_SAMPLES, 60);
+	for (unsigned int i = 0; i < FT_SAMPLES; i++) {
+		xd[i] = x[i];
+	}
+	fir8_init(&fir, half, taps, line, FT_LENGTH);
+	fir8_block(&fir, x, y, 200);
+	for (unsigned int i = 200; i < FT_SAMPLES; i++) {
+		y[i] = fir8_put(&fir, x[i]);
+	}
+	double worst = 0;
+	for (unsigned int i = 0; i < FT_SAMPLES; i++) {
+		double e = fabs(y[i] - reference(xd, i, half, false, taps, 1));
+		if (e > worst) {
+			worst = e;
+		}
+	}
+	double limit = max_error(half, false, taps);
+	printf("  filter: max. error %.2f LSB, limit %.2f\n", worst, limit);
+	check(worst <= limit, "filter output differs from the reference");
+
+	for (uint8_t factor = 2; factor <= 5; factor++) {
+		fir8_init(&fir, half, taps, line, FT_LENGTH);
+		unsigned int count = 0;
+		for (unsigned int i = 0; i < FT_SAMPLES; i += 77) {
+			uint8_t n = FT_SAMPLES - i < 77 ? FT_SAMPLES - i : 77;
+			count += fir8_decimate(&fir, &x[i], &d[count], n, factor);
+		}
+		bool same = count == FT_SAMPLES / factor;
+		for (unsigned int i = 0; same && i < count; i++) {
+			same = d[i] == y[(i + 1) * factor - 1];
+		}
+		printf("  decimate by %u: %u outputs, %s\n", factor, count, same ? "same as every n-th output" : "mismatch");
+		check(same, "decimated output differs from the filter output");
+	}
+
+	for (uint8_t factor = 2; factor <= 4; factor++) {
+		noise8(x, FT_SAMPLES, 60 / factor);
+		for (unsigned int i = 0; i < FT_SAMPLES; i++) {
+			xd[i] = x[i];
+		}
+		fir8_init(&fir, half, taps, line, FT_LENGTH);
+		for (unsigned int i = 0; i < FT_SAMPLES; i += 100) {
+			fir8_interpolate(&fir, &x[i], &u[i * factor], 100, factor);
+		}
+		worst = 0;
+		for (unsigned int i = 0; i < FT_SAMPLES * factor; i++) {
+			double e = fabs(u[i] - reference(xd, i, half, false, taps, factor));
+			if (e > worst) {
+				worst = e;
+			}
+		}
+		printf("  interpolate by %u: max. error %.2f LSB\n", factor, worst);
+		check(worst <= FT_MAX_ERROR_INTERPOLATE, "interpolated output differs from the reference");
+	}
+
+	fir8_init(&fir, half, taps, line, FT_LENGTH);
+	int8_t dc = 0;
+	for (unsigned int i = 0; i < FT_LENGTH; i++) {
+		dc = fir8_put(&fir, 100);
+	}
+	printf("  DC: 100 -> %d\n", dc);
+	check(dc == 100, "DC gain is not 1");
+}
+
+int main() {
+	srand(1);
+	test16("FIR_HALFBAND", halfband16, FIR_HALFBAND_TAPS);
+	test16("FIR_SMOOTH", smooth16, FIR_SMOOTH_TAPS);
+	test8("FIR_HALFBAND", halfband8, FIR_HALFBAND_TAPS);
+	test8("FIR_SMOOTH", smooth8, FIR_SMOOTH_TAPS);
+	if (failures) {
+		printf("%u checks failed\n", failures);
+		return 1;
+	}
+	printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * Bitmap font
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "font.h"
+#include "blit.h"
+#include "tinymath.h"
+
+#ifdef __AVR_ARCH__
+#define _font_strlen strlen_P
+#else
+#define _font_strlen strlen
+#endif
+
+#define _FONT_FIRST 32
+#define _FONT_LAST 127
+
+// Glyphs for 32..127, FONT_HEIGHT rows each, MSB is the leftmost pixel
+static const PROGMEM uint8_t font_glyphs[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, // space
+	0x40, 0x40, 0x40, 0x00, 0x40, // '!'
+	0xa0, 0xa0, 0x00, 0x00, 0x00, // '"'
+	0xa0, 0xe0, 0xa0, 0xe0, 0xa0, // '#'
+	0x60, 0xc0, 0x40, 0x60, 0xc0, // '$'
+	0x80, 0x20, 0x40, 0x80, 0x20, // '%'
+	0x40, 0xa0, 0x40, 0xa0, 0x60, // '&'
+	0x40, 0x40, 0x00, 0x00, 0x00, // '\''
+	0x20, 0x40, 0x40, 0x40, 0x20, // '('
+	0x80, 0x40, 0x40, 0x40, 0x80, // ')'
+	0x00, 0xa0, 0x40, 0xa0, 0x00, // '*'
+	0x00, 0x40, 0xe0, 0x40, 0x00, // '+'
+	0x00, 0x00, 0x00, 0x40, 0x80, // ','
+	0x00, 0x00, 0xe0, 0x00, 0x00, // '-'
+	0x00, 0x00, 0x00, 0x00, 0x40, // '.'
+	0x20, 0x20, 0x40, 0x80, 0x80, // '/'
+	0xe0, 0xa0, 0xa0, 0xa0, 0xe0, // '0'
+	0x40, 0xc0, 0x40, 0x40, 0xe0, // '1'
+	0xc0, 0x20, 0x40, 0x80, 0xe0, // '2'
+	0xc0, 0x20, 0x40, 0x20, 0xc0, // '3'
+	0xa0, 0xa0, 0xe0, 0x20, 0x20, // '4'
+	0xe0, 0x80, 0xc0, 0x20, 0xc0, // '5'
+	0x60, 0x80, 0xe0, 0xa0, 0xe0, // '6'
+	0xe0, 0x20, 0x40, 0x40, 0x40, // '7'
+	0xe0, 0xa0, 0xe0, 0xa0, 0xe0, // '8'
+	0xe0, 0xa0, 0xe0, 0x20, 0xc0, // '9'
+	0x00, 0x40, 0x00, 0x40, 0x00, // ':'
+	0x00, 0x40, 0x00, 0x40, 0x80, // ';'
+	0x20, 0x40, 0x80, 0x40, 0x20, // '<'
+	0x00, 0xe0, 0x00, 0xe0, 0x00, // '='
+	0x80, 0x40, 0x20, 0x40, 0x80, // '>'
+	0xc0, 0x20, 0x40, 0x00, 0x40, // '?'
+	0x40, 0xa0, 0xa0, 0x80, 0x60, // '@'
+	0x40, 0xa0, 0xe0, 0xa0, 0xa0, // 'A'
+	0xc0, 0xa0, 0xc0, 0xa0, 0xc0, // 'B'
+	0x60, 0x80, 0x80, 0x80, 0x60, // 'C'
+	0xc0, 0xa0, 0xa0, 0xa0, 0xc0, // 'D'
+	0xe0, 0x80, 0xc0, 0x80, 0xe0, // 'E'
+	0xe0, 0x80, 0xc0, 0x80, 0x80, // 'F'
+	0x60, 0x80, 0xa0, 0xa0, 0x60, // 'G'
+	0xa0, 0xa0, 0xe0, 0xa0, 0xa0, // 'H'
+	0xe0, 0x40, 0x40, 0x40, 0xe0, // 'I'
+	0x20, 0x20, 0x20, 0xa0, 0x40, // 'J'
+	0xa0, 0xa0, 0xc0, 0xa0, 0xa0, // 'K'
+	0x80, 0x80, 0x80, 0x80, 0xe0, // 'L'
+	0xa0, 0xe0, 0xe0, 0xa0, 0xa0, // 'M'
+	0xc0, 0xa0, 0xa0, 0xa0, 0xa0, // 'N'
+	0x40, 0xa0, 0xa0, 0xa0, 0x40, // 'O'
+	0xc0, 0xa0, 0xc0, 0x80, 0x80, // 'P'
+	0x40, 0xa0, 0xa0, 0xc0, 0x60, // 'Q'
+	0xc0, 0xa0, 0xc0, 0xa0, 0xa0, // 'R'
+	0x60, 0x80, 0x40, 0x20, 0xc0, // 'S'
+	0xe0, 0x40, 0x40, 0x40, 0x40, // 'T'
+	0xa0, 0xa0, 0xa0, 0xa0, 0xe0, // 'U'
+	0xa0, 0xa0, 0xa0, 0x40, 0x40, // 'V'
+	0xa0, 0xa0, 0xe0, 0xe0, 0xa0, // 'W'
+	0xa0, 0xa0, 0x40, 0xa0, 0xa0, // 'X'
+	0xa0, 0xa0, 0x40, 0x40, 0x40, // 'Y'
+	0xe0, 0x20, 0x40, 0x80, 0xe0, // 'Z'
+	0x60, 0x40, 0x40, 0x40, 0x60, // '['
+	0x80, 0x80, 0x40, 0x20, 0x20, // '\\'
+	0xc0, 0x40, 0x40, 0x40, 0xc0, // ']'
+	0x40, 0xa0, 0x00, 0x00, 0x00, // '^'
+	0x00, 0x00, 0x00, 0x00, 0xe0, // '_'
+	0x80, 0x40, 0x00, 0x00, 0x00, // '`'
+	0x00, 0x60, 0xa0, 0xa0, 0x60, // 'a'
+	0x80, 0xc0, 0xa0, 0xa0, 0xc0, // 'b'
+	0x00, 0x60, 0x80, 0x80, 0x60, // 'c'
+	0x20, 0x60, 0xa0, 0xa0, 0x60, // 'd'
+	0x00, 0x40, 0xe0, 0x80, 0x60, // 'e'
+	0x20, 0x40, 0xe0, 0x40, 0x40, // 'f'
+	0x00, 0x60, 0xa0, 0x60, 0xc0, // 'g'
+	0x80, 0xc0, 0xa0, 0xa0, 0xa0, // 'h'
+	0x40, 0x00, 0x40, 0x40, 0x40, // 'i'
+	0x20, 0x00, 0x20, 0xa0, 0x40, // 'j'
+	0x80, 0xa0, 0xc0, 0xc0, 0xa0, // 'k'
+	0xc0, 0x40, 0x40, 0x40, 0xe0, // 'l'
+	0x00, 0xe0, 0xe0, 0xa0, 0xa0, // 'm'
+	0x00, 0xc0, 0xa0, 0xa0, 0xa0, // 'n'
+	0x00, 0x40, 0xa0, 0xa0, 0x40, // 'o'
+	0x00, 0xc0, 0xa0, 0xc0, 0x80, // 'p'
+	0x00, 0x60, 0xa0, 0x60, 0x20, // 'q'
+	0x00, 0x60, 0x80, 0x80, 0x80, // 'r'
+	0x00, 0x60, 0xc0, 0x20, 0xc0, // 's'
+	0x40, 0xe0, 0x40, 0x40, 0x20, // 't'
+	0x00, 0xa0, 0xa0, 0xa0, 0x60, // 'u'
+	0x00, 0xa0, 0xa0, 0x40, 0x40, // 'v'
+	0x00, 0xa0, 0xe0, 0xe0, 0x40, // 'w'
+	0x00, 0xa0, 0x40, 0x40, 0xa0, // 'x'
+	0x00, 0xa0, 0xa0, 0x40, 0x80, // 'y'
+	0x00, 0xe0, 0x60, 0xc0, 0xe0, // 'z'
+	0x60, 0x40, 0xc0, 0x40, 0x60, // '{'
+	0x40, 0x40, 0x40, 0x40, 0x40, // '|'
+	0xc0, 0x40, 0x60, 0x40, 0xc0, // '}'
+	0x00, 0x60, 0xc0, 0x00, 0x00, // '~'
+	0xe0, 0xe0, 0xe0, 0xe0, 0xe0, // box
+};
+
+static inline char _font_read(const char *p, bool progmem) {
+	return progmem ? (char) pgm_read_byte(p) : *p;
+}
+
+void font_char(int16_t x, int16_t y, char c, uint8_t color) {
+	uint8_t i = (uint8_t) c;
+	if (i < _FONT_FIRST || i > _FONT_LAST) {
+		i = _FONT_LAST;
+	}
+	// pixels are 1, so they end up as color, and 0 is transparent
+	blit_bitmap(&font_glyphs[(i - _FONT_FIRST) * FONT_HEIGHT], FONT_WIDTH, FONT_HEIGHT, 1, x, y, color - 1, 0);
+}
+
+static int16_t _font_text(int16_t x, int16_t y, const char *text, uint8_t color, bool progmem) {
+	if (y >= WS_HEIGHT || y + FONT_HEIGHT <= 0) {
+		// nothing to draw, just measure
+		return x + FONT_ADVANCE * (progmem ? _font_strlen(text) : strlen(text));
+	}
+	char c;
+	while ((c = _font_read(text++, progmem)) != 0) {
+		if (x < WS_WIDTH && x + FONT_WIDTH > 0) {
+			font_char(x, y, c, color);
+		}
+		x += FONT_ADVANCE;
+	}
+	return x;
+}
+
+int16_t font_text(int16_t x, int16_t y, const char *text, uint8_t color) {
+	return _font_text(x, y, text, color, false);
+}
+
+int16_t font_text_P(int16_t x, int16_t y, const char *text, uint8_t color) {
+	return _font_text(x, y, text, color, true);
+}
+
+static int16_t _font_width(uint16_t length) {
+	return length > 0 ? FONT_ADVANCE * length - 1 : 0;
+}
+
+int16_t font_width(const char *text) {
+	return _font_width(strlen(text));
+}
+
+int16_t font_width_P(const char *text) {
+	return _font_width(_font_strlen(text));
+}
+
+void font_scroll_init(font_scroll_t *scroll, const char *text, bool progmem, int16_t y, uint8_t color, uint16_t speed) {
+	scroll->text = text;
+	scroll->progmem = progmem;
+	scroll->width = progmem ? font_width_P(text) : font_width(text);
+	scroll->x = WS_WIDTH;
+	scroll->frac = 0;
+	scroll->speed = speed;
+	scroll->y = y;
+	scroll->color = color;
+}
+
+bool font_scroll_step(font_scroll_t *scroll) {
+	_font_text(scroll->x, scroll->y, scroll->text, scroll->color, scroll->progmem);
+	uint16_t step = scroll->frac + scroll->speed;
+	scroll->frac = (uint8_t) step;
+	scroll->x -= step >> 8;
+	if (scroll->x + scroll->width <= 0) {
+		scroll->x = WS_WIDTH;
+		scroll->frac = 0;
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,90 @@
+/*
+ * Bitmap font
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _FONT_H
+#define _FONT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "blit.h"
+
+// A 3x5 pixel font for printable ASCII characters, drawn with the blitter.
+//
+// Glyphs are 1bpp bitmaps with one byte per row. Set pixels are drawn in
+// the given color, the background is left alone. Characters outside of
+// 32..126 are drawn as a filled box.
+//
+// Drawing a character costs about 450 cycles, characters that are completely
+// off the display are skipped for about 30.
+
+// Glyph size and spacing in pixels
+#define FONT_WIDTH 3
+#define FONT_HEIGHT 5
+#define FONT_ADVANCE (FONT_WIDTH + 1)
+
+// Smooth scrolling text
+typedef struct {
+	// Text in RAM or flash
+	const char *text;
+	bool progmem;
+	// Width of the text in pixels
+	int16_t width;
+	// Current left edge, integer part and fraction
+	int16_t x;
+	uint8_t frac;
+	// Pixels per step in Q8.8
+	uint16_t speed;
+	int16_t y;
+	uint8_t color;
+} font_scroll_t;
+
+// Draws a character with the top left corner at x,y
+void font_char(int16_t x, int16_t y, char c, uint8_t color);
+
+// Draws a string with the top left corner at x,y.
+// Returns the x coordinate after the last character.
+int16_t font_text(int16_t x, int16_t y, const char *text, uint8_t color);
+
+// Same as font_text(), but reads the string from flash
+int16_t font_text_P(int16_t x, int16_t y, const char *text, uint8_t color);
+
+// Width of a string in pixels, without the spacing after the last character
+int16_t font_width(const char *text);
+
+// Same as font_width(), but reads the string from flash
+int16_t font_width_P(const char *text);
+
+// Sets up a scroller that moves text from the right edge of the display to
+// the left, by speed / 256 pixels per step
+void font_scroll_init(font_scroll_t *scroll, const char *text, bool progmem, int16_t y, uint8_t color, uint16_t speed);
+
+// Draws the scrolling text at the current position and moves it on.
+// The text is drawn over the frame buffer, clear its rows first.
+// Returns true when the text has left the display and starts over.
+bool font_scroll_step(font_scroll_t *scroll);
+
+#endif /*_FONT_H*/
@@ -0,0 +1,171 @@
+#!/usr/bin/perl
+
+# LED bit timing generator
+# Copyright © 2017 Gregor Riepl <onitake@gmail.com>
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+#     Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#    
+#     Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+use strict;
+use warnings;
+use IO::File;
+use Getopt::Long;
+use POSIX qw(ceil floor);
+
+my ($ofile, $loop) = ('clocks.h', 7);
+my @clocks = (8, 12, 16, 20);
+sub usage($) {
+	print("Usage: genclocks [-o <output_file>] [-l <cycles>] [<MHz> ...]\n");
+	print("-o  Names the output header file (default: $ofile)\n");
+	print("-l  Cycles spent in the bit loop outside the asm block (default: $loop)\n");
+	print("-h  This help\n");
+	print("Generates bit timing for each CPU clock (default: @clocks MHz).\n");
+	exit(1) if ($_[0]);
+}
+GetOptions(
+	"output=s" => \$ofile,
+	"loop=i" => \$loop,
+	"help" => sub { usage(1); },
+) or usage(1);
+@clocks = @ARGV if (@ARGV);
+
+# LED timing in us: nominal high and low times, the tolerance of the high
+# times and the longest bit period.
+# The WS2812 data sheet timings are wrong and inconsistent (t1 != t0).
+# The correct timings are courtesy of Adafruit. Thanks!
+# The SK6812 needs shorter high times, T0H = 0.3us and T1H = 0.6us.
+# Both accept a bit period of 1.25us +-0.6us.
+my @drivers = (
+	{ name => 'WS2812', t0h => 0.4375, t0l => 0.8125, t1h => 0.8125, t1l => 0.4375, tol => 0.15, max => 1.85 },
+	{ name => 'SK6812', t0h => 0.3125, t0l => 0.9375, t1h => 0.625, t1l => 0.625, tol => 0.15, max => 1.85 },
+);
+
+# There are two encodings, both of them send every bit as high, pattern, low
+# with out instructions:
+#
+# bit:  one asm block per bit, the pattern is computed in C in between.
+#       out high; A; out pattern; B; out low; C; loop
+#       T0H = A + 1, T1H = A + B + 2, bit = A + B + C + 3 + loop overhead.
+#       The loop overhead is only estimated (-l), it just adds to the low
+#       time. C pads T1L on its own, so the low time has some slack.
+# byte: one asm loop per byte, the pattern is taken from the data with a
+#       skip. Needs far fewer cycles and is cycle exact.
+#       out high; A; sbrs; out low; lsl; B; out low; C; dec; brne
+#       T0H = A + 2, T1H = A + B + 4, bit = A + B + C + 8.
+#
+# The bit encoding leaves more room for the pattern computation (e.g. for
+# parallel chains), so it is used whenever it is fast enough.
+
+# nearest cycle count
+sub cycles($$) {
+	my ($t, $f) = @_;
+	return int($t * $f + 0.5);
+}
+
+# high time cycle counts within the tolerance, nearest to the nominal value first
+sub candidates($$$) {
+	my ($t, $tol, $f) = @_;
+	my $n = $t * $f;
+	return sort { abs($a - $n) <=> abs($b - $n) } (ceil(($t - $tol) * $f) .. floor(($t + $tol) * $f));
+}
+
+# finds the high times (h0, h1) closest to nominal with at least the given
+# number of cycles in both phases
+sub highs($$$$) {
+	my ($d, $f, $min0, $min1) = @_;
+	my ($best, $error);
+	for my $h0 (candidates($d->{t0h}, $d->{tol}, $f)) {
+		for my $h1 (candidates($d->{t1h}, $d->{tol}, $f)) {
+			next if ($h0 < $min0 || $h1 - $h0 < $min1);
+			my $e = abs($h0 - $d->{t0h} * $f) + abs($h1 - $d->{t1h} * $f);
+			($best, $error) = ([$h0, $h1], $e) if (!defined($error) || $e < $error);
+		}
+	}
+	return $best ? @$best : ();
+}
+
+sub bit_encoding($$) {
+	my ($d, $f) = @_;
+	my ($h0, $h1) = highs($d, $f, 1, 1);
+	return undef if (!defined($h0));
+	my ($a, $b, $c) = ($h0 - 1, $h1 - $h0 - 1, cycles($d->{t1l}, $f));
+	my $bit = $a + $b + $c + 3 + $loop;
+	return undef if ($bit > $d->{max} * $f);
+	return { name => 'BIT', pads => [$a, $b, $c], h0 => $h0, h1 => $h1, bit => $bit };
+}
+
+sub byte_encoding($$) {
+	my ($d, $f) = @_;
+	my ($h0, $h1) = highs($d, $f, 2, 2);
+	return undef if (!defined($h0));
+	my ($a, $b) = ($h0 - 2, $h1 - $h0 - 2);
+	# low times at least nominal: T1L = C + 4, T0L = B + C + 6
+	my $c = cycles($d->{t1l}, $f) - 4;
+	$c = cycles($d->{t0l}, $f) - 6 - $b if (cycles($d->{t0l}, $f) - 6 - $b > $c);
+	$c = 0 if ($c < 0);
+	my $bit = $a + $b + $c + 8;
+	return undef if ($bit > $d->{max} * $f);
+	return { name => 'BYTE', pads => [$a, $b, $c], h0 => $h0, h1 => $h1, bit => $bit };
+}
+
+print("Writing to $ofile\n");
+my $out = IO::File->new($ofile, 'w') || die("Can't open $ofile");
+
+print($out "#define _WS_ENCODING_BIT 1\n");
+print($out "#define _WS_ENCODING_BYTE 2\n");
+my $first = 1;
+for my $d (@drivers) {
+	my $name = $d->{name};
+	printf($out "#%s WS_DRIVER == WS_DRIVER_%s\n", $first ? 'if' : 'elif', $name);
+	$first = 0;
+	my $else = 'if';
+	for my $mhz (@clocks) {
+		my $hz = $mhz * 1000000;
+		printf($out "#%s F_CPU == %dUL\n", $else, $hz);
+		$else = 'elif';
+		my $e = bit_encoding($d, $mhz) || byte_encoding($d, $mhz);
+		if (!$e) {
+			print($out "#error $name timing can't be met at ${mhz}MHz\n");
+			print("$name at ${mhz}MHz: not possible\n");
+			next;
+		}
+		# the bit encoding's period includes the estimated loop overhead
+		my $approx = $e->{name} eq 'BIT' ? '~' : '';
+		my $info = sprintf("%s encoding: T0H %d cycles (%.3fus), T1H %d (%.3fus), bit %s%d (%.3fus)",
+			lc($e->{name}), $e->{h0}, $e->{h0} / $mhz, $e->{h1}, $e->{h1} / $mhz, $approx, $e->{bit}, $e->{bit} / $mhz);
+		print($out "// $info\n");
+		print("$name at ${mhz}MHz: $info\n");
+		print($out "#define _WS_ENCODING _WS_ENCODING_$e->{name}\n");
+		my @pads = @{$e->{pads}};
+		for my $p ('A', 'B', 'C') {
+			printf($out "#define _WS_PAD_%s %d\n", $p, shift(@pads));
+		}
+		print($out "#define _WS_CYCLES_BIT $e->{bit}\n");
+	}
+	print($out "#else\n");
+	print($out "#error No $name timing for this F_CPU, add it with genclocks.pl\n");
+	print($out "#endif\n");
+}
+print($out "#endif\n");
+
+$out->close();
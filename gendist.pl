@@ -0,0 +1,80 @@
+#!/usr/bin/perl
+
+# Distance map generator for the plasma effect engine
+# Copyright © 2017 Gregor Riepl <onitake@gmail.com>
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+#     Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#    
+#     Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+use strict;
+use warnings;
+use IO::File;
+use Getopt::Long;
+
+my ($ofile, $cfile, $var, $scale) = ('dist_table.h', 'config.h', 'DIST_TABLE', 16);
+my ($width, $height);
+sub usage($) {
+	print("Usage: gendist [-o <output_file>] [-c <config_file>] [-W <width>] [-H <height>]\n");
+	print("-o  Names the output header file (default: $ofile)\n");
+	print("-c  Reads WS_WIDTH and WS_HEIGHT from this file (default: $cfile)\n");
+	print("-W  Display width, overrides the config file\n");
+	print("-H  Display height, overrides the config file\n");
+	print("-h  This help\n");
+	exit(1) if ($_[0]);
+}
+GetOptions(
+	"output=s" => \$ofile,
+	"config=s" => \$cfile,
+	"W=i" => \$width,
+	"H=i" => \$height,
+	"help" => sub { usage(1); },
+) or usage(1);
+
+if (!defined($width) || !defined($height)) {
+	my $in = IO::File->new($cfile, 'r') || die("Can't open $cfile");
+	while (my $line = <$in>) {
+		$width = $1 if (!defined($width) && $line =~ /^\s*#define\s+WS_WIDTH\s+(\d+)/);
+		$height = $1 if (!defined($height) && $line =~ /^\s*#define\s+WS_HEIGHT\s+(\d+)/);
+	}
+	$in->close();
+}
+die("Display size not found, use -W and -H") if (!defined($width) || !defined($height));
+
+print("Writing ${width}x${height} map to $ofile\n");
+my $out = IO::File->new($ofile, 'w') || die("Can't open $ofile");
+
+# distance from the display center in 1/scale pixels, wrapped to 8 bit
+# the wrap is harmless as long as the value is only used as an angle
+# multiplied by an integer spatial frequency.
+my ($cx, $cy) = (($width - 1) / 2, ($height - 1) / 2);
+print($out "#define ${var}_WIDTH $width\n");
+print($out "#define ${var}_HEIGHT $height\n");
+print($out "#define ${var} {");
+for (my $y = 0; $y < $height; $y++) {
+	for (my $x = 0; $x < $width; $x++) {
+		my $d = sqrt(($x - $cx) ** 2 + ($y - $cy) ** 2) * $scale;
+		printf($out "%d,", int($d + 0.5) % 256);
+	}
+}
+print($out "}\n");
+
+$out->close();
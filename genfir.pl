@@ -0,0 +1,151 @@
+#!/usr/bin/perl
+
+# FIR filter coefficient generator
+# Copyright © 2017 Gregor Riepl <onitake@gmail.com>
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+#     Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#    
+#     Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+# ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+use strict;
+use warnings;
+use IO::File;
+use Getopt::Long;
+use Math::Trig;
+
+my ($ofile, $rate, $window) = ('fir_table.h', undef, 'hamming');
+sub usage($) {
+	print("Usage: genfir [-o <output_file>] [-r <rate>] [-w <window>] <name>:<type>:<taps>:<f1>[:<f2>] ...\n");
+	print("-o  Names the output header file (default: $ofile)\n");
+	print("-r  Sampling rate in Hz, frequencies are in Hz if given.\n");
+	print("    Otherwise, they are fractions of the sampling rate (0..0.5).\n");
+	print("-w  Window function: hamming, blackman or rectangular (default: $window)\n");
+	print("-h  This help\n");
+	print("Filter types: lowpass:<taps>:<fc>, highpass:<taps>:<fc>, bandpass:<taps>:<f1>:<f2>\n");
+	print("Example: genfir -r 44100 FIR_BASS:lowpass:31:200\n");
+	exit(1) if ($_[0]);
+}
+GetOptions(
+	"output=s" => \$ofile,
+	"rate=f" => \$rate,
+	"window=s" => \$window,
+	"help" => sub { usage(1); },
+) or usage(1);
+usage(1) if (!@ARGV);
+
+my %windows = (
+	hamming => sub { 0.54 - 0.46 * cos(2 * pi * $_[0]) },
+	blackman => sub { 0.42 - 0.5 * cos(2 * pi * $_[0]) + 0.08 * cos(4 * pi * $_[0]) },
+	rectangular => sub { 1 },
+);
+die("Unknown window $window") if (!$windows{$window});
+
+# ideal low-pass impulse response, cutoff fc (fraction of the sampling rate)
+sub sinc_lowpass($$) {
+	my ($fc, $t) = @_;
+	return 2 * $fc if ($t == 0);
+	return sin(2 * pi * $fc * $t) / (pi * $t);
+}
+
+# gain of a filter at frequency f (fraction of the sampling rate)
+sub gain($$) {
+	my ($h, $f) = @_;
+	my ($re, $im) = (0, 0);
+	for (my $i = 0; $i < @$h; $i++) {
+		$re += $h->[$i] * cos(2 * pi * $f * $i);
+		$im += $h->[$i] * sin(2 * pi * $f * $i);
+	}
+	return sqrt($re ** 2 + $im ** 2);
+}
+
+# quantises to integers with the given scale, keeping the sum of all
+# coefficients (i.e. the dc gain) as close to the exact value as possible
+# by correcting the center tap
+sub quantise($$$) {
+	my ($h, $scale, $max) = @_;
+	my @q = map { int($_ * $scale + ($_ < 0 ? -0.5 : 0.5)) } @$h;
+	my $exact = 0;
+	$exact += $_ * $scale for (@$h);
+	my $sum = 0;
+	$sum += $_ for (@q);
+	my $c = int($#q / 2);
+	my $diff = int($exact + ($exact < 0 ? -0.5 : 0.5)) - $sum;
+	if ($diff % 2 == 0 && $#q % 2 == 1) {
+		# even number of taps: two center taps, correct both
+		$q[$c] += $diff / 2;
+		$q[$c + 1] += $diff / 2;
+	} elsif ($#q % 2 == 0) {
+		$q[$c] += $diff;
+	}
+	for (@q) {
+		$_ = $max if ($_ > $max);
+		$_ = -$max - 1 if ($_ < -$max - 1);
+	}
+	return @q;
+}
+
+print("Writing to $ofile\n");
+my $out = IO::File->new($ofile, 'w') || die("Can't open $ofile");
+
+for my $spec (@ARGV) {
+	my ($name, $type, $taps, $f1, $f2) = split(/:/, $spec);
+	die("Invalid filter specification $spec") if (!defined($f1) || $taps !~ /^\d+$/ || $taps < 2 || $taps > 255);
+	$f1 /= $rate if ($rate);
+	$f2 /= $rate if ($rate && defined($f2));
+	die("$name: frequencies must be below half the sampling rate") if ($f1 >= 0.5 || (defined($f2) && $f2 >= 0.5));
+	my $mid = ($taps - 1) / 2;
+	my (@h, $norm);
+	for (my $i = 0; $i < $taps; $i++) {
+		my $t = $i - $mid;
+		my $w = $windows{$window}->($taps > 1 ? $i / ($taps - 1) : 0);
+		my $v;
+		if ($type eq 'lowpass') {
+			$v = sinc_lowpass($f1, $t);
+		} elsif ($type eq 'highpass') {
+			die("$name: a high-pass filter needs an odd number of taps") if ($taps % 2 == 0);
+			$v = ($t == 0 ? 1 : 0) - sinc_lowpass($f1, $t);
+		} elsif ($type eq 'bandpass') {
+			die("$name: a band-pass filter needs two frequencies") if (!defined($f2));
+			$v = sinc_lowpass($f2, $t) - sinc_lowpass($f1, $t);
+		} else {
+			die("$name: unknown filter type $type");
+		}
+		push(@h, $v * $w);
+	}
+	# unity gain in the pass band
+	if ($type eq 'lowpass') {
+		$norm = gain(\@h, 0);
+	} elsif ($type eq 'highpass') {
+		$norm = gain(\@h, 0.5);
+	} else {
+		$norm = gain(\@h, ($f1 + $f2) / 2);
+	}
+	@h = map { $_ / $norm } @h;
+	# only the first half (plus the center tap) is stored, the rest is symmetric
+	my $half = int(($taps + 1) / 2);
+	my @q15 = quantise(\@h, 32768, 32767);
+	my @q7 = quantise(\@h, 128, 127);
+	print($out "#define ${name}_TAPS $taps\n");
+	print($out "#define ${name}_Q15 {", join(',', @q15[0 .. $half - 1]), ",}\n");
+	print($out "#define ${name}_Q7 {", join(',', @q7[0 .. $half - 1]), ",}\n");
+}
+
+$out->close();
@@ -56,4 +56,75 @@ for my $steps (8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384) {
 	print($out "}\n");
 }
 
+# helper: print one table with a given number of intervals (steps + 1 entries)
+sub table($$$) {
+	my ($name, $steps, $func) = @_;
+	print($out "#define ${name}_${steps} {");
+	for (my $i = 0; $i <= $steps; $i++) {
+		printf($out "%.0f,", $func->($i / $steps));
+	}
+	print($out "}\n");
+}
+
+# reciprocal of the normalised divisor 128..256, 2^23 / d (Q16, saturated)
+table('RECIP_TABLE', 128, sub { my $d = 128 + $_[0] * 128; my $r = 2 ** 23 / $d; $r > 65535 ? 65535 : $r; });
+# first octant arctangent, angle units of 1/4 step (1024 steps per turn)
+table('ATAN_TABLE', 64, sub { atan($_[0]) * 512 / pi; });
+# log2(1 + x) in Q1.15
+table('LOG2_TABLE', 64, sub { log(1 + $_[0]) / log(2) * 32768; });
+# 2^x in Q2.14
+table('EXP2_TABLE', 64, sub { 2 ** $_[0] * 16384; });
+
+# quarter sine wave in Q15, for the fft twiddle factors and goertzel coefficients
+table('SIN_Q15_TABLE', 64, sub { sin($_[0] * pi / 2) * 32767; });
+
+# one-pole iir filter coefficients, indexed by log frequency
+# fc = fmin * 2^(i / steps), alpha = w / (w + 1) with w = 2 pi fc / fs (Q0.16, saturated)
+my ($fmin, $fsteps) = (20, 24);
+print($out "#define IIR_ALPHA_FMIN $fmin\n");
+print($out "#define IIR_ALPHA_STEPS $fsteps\n");
+for my $rate (8000, 11025, 16000, 22050, 32000, 44100, 48000) {
+	print($out "#define IIR_ALPHA_TABLE_${rate} {");
+	for (my $i = 0; $i <= 256; $i++) {
+		my $w = 2 * pi * $fmin * 2 ** ($i / $fsteps) / $rate;
+		my $a = $w / ($w + 1) * 65536;
+		printf($out "%.0f,", $a > 65535 ? 65535 : $a);
+	}
+	print($out "}\n");
+}
+
+# lfsr jump-ahead table: x^(-2^k) mod p for the galois lfsr in lfsr.c
+# the lfsr step is a multiplication by the toggle mask m = x^-1 mod p,
+# where p = 1 + x * m(x) = x^32 + x^22 + x^2 + x + 1
+my $plow = 0x00400007;
+sub lfsr_mulmod($$) {
+	my ($a, $b) = @_;
+	my $r = 0;
+	for (my $i = 31; $i >= 0; $i--) {
+		my $carry = $r & 0x80000000;
+		$r = ($r << 1) & 0xffffffff;
+		$r ^= $plow if ($carry);
+		$r ^= $a if (($b >> $i) & 1);
+	}
+	return $r;
+}
+print($out "#define LFSR_JUMP_TABLE {");
+my $j = 0x80200003;
+for (my $k = 0; $k < 32; $k++) {
+	printf($out "0x%08x,", $j);
+	$j = lfsr_mulmod($j, $j);
+}
+print($out "}\n");
+
+# noise permutation table: fisher-yates shuffle of 0..255 driven by a fixed lcg,
+# so the table (and every noise pattern) is the same on each run
+my @perm = (0 .. 255);
+my $seed = 1;
+for (my $i = 255; $i > 0; $i--) {
+	$seed = ($seed * 1103515245 + 12345) & 0x7fffffff;
+	my $k = ($seed >> 16) % ($i + 1);
+	@perm[$i, $k] = @perm[$k, $i];
+}
+print($out "#define NOISE_PERM_TABLE {", join(',', @perm), ",}\n");
+
 $out->close();
@@ -25,54 +25,111 @@
  */
 
 #include "lfsr.h"
+#include "tinymath.h"
+#include "tiny_table.h"
 
-static uint32_t lfsr __attribute__((section(".noinit")));
+// toggle mask for the galois counter
+// p = x³¹ + x²¹ + x¹ + x⁰
+#define _LFSR_MASK 0x80200003
+// reduction polynomial for jump-ahead
+// in polynomial terms, one step multiplies the state by the toggle mask
+// modulo x³² + x²² + x² + x¹ + x⁰ (i.e. 1 + x * mask)
+#define _LFSR_POLY 0x00400007
 
-uint8_t lfsr_shift() {
+static const PROGMEM uint32_t lfsr_jump_table[] = LFSR_JUMP_TABLE;
+
+static lfsr_t lfsr_global __attribute__((section(".noinit")));
+
+static inline uint8_t _lfsr_shift(lfsr_t *lfsr) {
 	// operate in galois counting mode, it's more efficient
-	uint8_t lsb = (uint8_t) lfsr & 1;   // get lsb (i.e., the output bit)
-	lfsr >>= 1;                         // shift register
-	if (lsb) {                          // if the output bit is 1, apply toggle mask (i.e. polynomial)
-		// p = x³¹ + x²¹ + x¹ + x⁰
-		lfsr ^= 0x80200003;
+	uint8_t lsb = (uint8_t) lfsr->state & 1; // get lsb (i.e., the output bit)
+	lfsr->state >>= 1;                       // shift register
+	if (lsb) {                               // if the output bit is 1, apply toggle mask (i.e. polynomial)
+		lfsr->state ^= _LFSR_MASK;
 	}
 	return lsb;
 }
 
-void lfsr_init(uint32_t seed) {
+void lfsr_init_r(lfsr_t *lfsr, uint32_t seed) {
 	// avoid lockup state
 	if (seed == 0) {
-		lfsr = 1;
+		lfsr->state = 1;
 	} else {
-		lfsr = seed;
+		lfsr->state = seed;
 	}
 	// pre-clock one full cycle
 	for (uint8_t i = 0; i < 32; i++) {
-		lfsr_shift();
+		_lfsr_shift(lfsr);
 	}
 }
 
-uint8_t lfsr_get_bit() {
+uint8_t lfsr_get_bit_r(lfsr_t *lfsr) {
 	// a single bit is equal to the output of the lfsr
-	return lfsr_shift();
+	return _lfsr_shift(lfsr);
 }
 
-uint8_t lfsr_get_byte() {
+uint8_t lfsr_get_byte_r(lfsr_t *lfsr) {
 	// clock in 8 bits
 	uint8_t ret = 0;
 	for (uint8_t i = 0; i < 8; i++) {
-		uint8_t bit = lfsr_shift();
+		uint8_t bit = _lfsr_shift(lfsr);
 		ret |= bit << (7 - i);
 	}
 	return ret;
 }
 
-uint16_t lfsr_get_short() {
+uint16_t lfsr_get_short_r(lfsr_t *lfsr) {
 	// clock in 16 bits
 	uint16_t ret = 0;
 	for (uint8_t i = 0; i < 16; i++) {
-		uint16_t bit = lfsr_shift();
+		uint16_t bit = _lfsr_shift(lfsr);
 		ret |= bit << (15 - i);
 	}
 	return ret;
 }
+
+// carry-less multiplication modulo the lfsr polynomial
+static uint32_t _lfsr_mulmod(uint32_t a, uint32_t b) {
+	uint32_t r = 0;
+	for (uint8_t i = 0; i < 32; i++) {
+		uint8_t carry = (r & 0x80000000) != 0;
+		r <<= 1;
+		if (carry) {
+			r ^= _LFSR_POLY;
+		}
+		if (b & 0x80000000) {
+			r ^= a;
+		}
+		b <<= 1;
+	}
+	return r;
+}
+
+void lfsr_jump_r(lfsr_t *lfsr, uint8_t k) {
+	// the table holds mask^(2^k), multiplying by it is equivalent to 2^k steps
+	lfsr->state = _lfsr_mulmod(lfsr->state, pgm_read_dword(&lfsr_jump_table[k & 31]));
+}
+
+void lfsr_advance_r(lfsr_t *lfsr, uint32_t n) {
+	for (uint8_t k = 0; n != 0; k++, n >>= 1) {
+		if (n & 1) {
+			lfsr_jump_r(lfsr, k);
+		}
+	}
+}
+
+void lfsr_init(uint32_t seed) {
+	lfsr_init_r(&lfsr_global, seed);
+}
+
+uint8_t lfsr_get_bit() {
+	return lfsr_get_bit_r(&lfsr_global);
+}
+
+uint8_t lfsr_get_byte() {
+	return lfsr_get_byte_r(&lfsr_global);
+}
+
+uint16_t lfsr_get_short() {
+	return lfsr_get_short_r(&lfsr_global);
+}
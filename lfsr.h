@@ -29,6 +29,33 @@
 
 #include <stdint.h>
 
+// LFSR state. Each instance is an independent random stream.
+typedef struct {
+	uint32_t state;
+} lfsr_t;
+
+// Reentrant interface, operates on an explicit state object.
+
+// Seeds a state. A seed of 0 is replaced by 1, to avoid the lockup state.
+void lfsr_init_r(lfsr_t *lfsr, uint32_t seed);
+
+uint8_t lfsr_get_bit_r(lfsr_t *lfsr);
+
+uint8_t lfsr_get_byte_r(lfsr_t *lfsr);
+
+uint16_t lfsr_get_short_r(lfsr_t *lfsr);
+
+// Advances a state by 2^k steps (k = 0..31) in constant time.
+// Every generated bit is one step, so a byte takes 8 steps.
+// Useful to split one seed into non-overlapping sub-streams,
+// e.g. stream n starts n * 2^k steps after the seed.
+void lfsr_jump_r(lfsr_t *lfsr, uint8_t k);
+
+// Advances a state by n steps, using one jump per set bit in n.
+void lfsr_advance_r(lfsr_t *lfsr, uint32_t n);
+
+// Shared interface, operates on a single global state.
+
 void lfsr_init(uint32_t seed);
 
 uint8_t lfsr_get_bit();
@@ -28,27 +28,51 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef __AVR_ARCH__
 #include <avr/io.h>
 #include <util/delay.h>
+#endif
 #include "config.h"
 #include "ws2812.h"
 #include "lfsr.h"
 #include "tinymath.h"
+#include "sched.h"
+#ifdef UART_BAUD
+#include <avr/interrupt.h>
+#include "uart.h"
+#include "stream.h"
+#endif
+#ifdef ADC_CHANNEL
+#include <avr/interrupt.h>
+#include "adc.h"
+#include "spectrum.h"
+#include "bars.h"
+#endif
+
+#ifdef PAL_DITHER
+// The dithered palette keeps the fractional part of the blend.
+typedef rgb16_t map_rgb_t;
+#define MAP_SCALE 1
+#else
+typedef rgb_t map_rgb_t;
+#define MAP_SCALE 256
+#endif
 
 // Blends two colors together.
 // Equivalent to: a * (1.0 - v) + b * v
 // v ranges from 0 to 255 and is mapped to 0.0..1.0.
-// No floating point arithmetic is used and the result is mapped back to 0..255.
-static inline __attribute__((always_inline)) rgb_t rgb_mix(rgb_t a, rgb_t b, uint8_t v) {
+// No floating point arithmetic is used and the result is mapped back to 0..255
+// (or 0..65535 with dithering).
+static inline __attribute__((always_inline)) map_rgb_t rgb_mix(rgb_t a, rgb_t b, uint8_t v) {
 	uint8_t dv = 255 - v;
-	rgb_t d;
-	d.r = (uint8_t) ((a.r * (uint16_t) dv + b.r * (uint16_t) v) / 256);
-	d.g = (uint8_t) ((a.g * (uint16_t) dv + b.g * (uint16_t) v) / 256);
-	d.b = (uint8_t) ((a.b * (uint16_t) dv + b.b * (uint16_t) v) / 256);
+	map_rgb_t d;
+	d.r = (a.r * (uint16_t) dv + b.r * (uint16_t) v) / MAP_SCALE;
+	d.g = (a.g * (uint16_t) dv + b.g * (uint16_t) v) / MAP_SCALE;
+	d.b = (a.b * (uint16_t) dv + b.b * (uint16_t) v) / MAP_SCALE;
 	return d;
 }
 
-rgb_t map_color(uint8_t index) {
+map_rgb_t map_color(uint8_t index) {
 	// not quite what the name says rgb-wise, but these LEDs have a terrible
 	// color spectrum.
 	static const rgb_t black = { 0, 0, 0 };
@@ -76,40 +100,181 @@ rgb_t map_color(uint8_t index) {
 	}
 }
 
+// Frame rate of the built-in effect (Hz)
+#ifndef FRAME_RATE
+#define FRAME_RATE 50
+#endif
+#if 1000 / FRAME_RATE * SCHED_TICKS_PER_MS >= 32768
+#error FRAME_RATE is too low for the scheduler clock
+#endif
+#define FRAME_PERIOD SCHED_MS(1000 / FRAME_RATE)
+
+// The main loop is made of two tasks: one that fills the frame buffer
+// (the built-in effect, the UART stream or the spectrum analyser), and one
+// that sends it to the LEDs. frame_ready hands the frame buffer over from
+// the first to the second and back.
+static bool frame_ready;
+
+// Sends each completed frame.
+static uint8_t scan_task(sched_task_t *task) {
+	PT_BEGIN(&task->pt);
+	PT_WAIT_UNTIL(&task->pt, frame_ready);
+	ws_scan_fb();
+	frame_ready = false;
+	PT_END(&task->pt);
+}
+
+#ifdef UART_BAUD
+// Displays frames streamed over the UART instead of the built-in effect.
+static uint8_t stream_task(sched_task_t *task) {
+	static uint8_t status;
+	PT_BEGIN(&task->pt);
+	// tell the sender we're ready
+	uart_put(STREAM_ACK);
+	while (true) {
+		PT_WAIT_UNTIL(&task->pt, uart_available());
+		status = stream_feed(uart_get());
+		if (status == STREAM_NONE) {
+			continue;
+		}
+		// bytes lost in the driver invalidate the packet as well
+		if (uart_get_errors()) {
+			status = STREAM_ERROR;
+		}
+		if (status == STREAM_SHOW) {
+			// acknowledge once the frame is out
+			frame_ready = true;
+			PT_WAIT_WHILE(&task->pt, frame_ready);
+		}
+		uart_put(status == STREAM_ERROR ? STREAM_NAK : STREAM_ACK);
+	}
+	PT_END(&task->pt);
+}
+#endif
+
+#ifdef ADC_CHANNEL
+// Number of spectrum bands. The Goertzel filters must finish a block before
+// the next one is sampled, which limits this to about 8 bands at 16MHz.
+#define SPECTRUM_BANDS (WS_WIDTH < 8 ? WS_WIDTH : 8)
+// Number of ADC blocks per measurement.
+// More blocks give narrower filters, which separate the low bands better.
+#define SPECTRUM_BLOCKS 4
+// Band frequency range (Hz)
+#define SPECTRUM_FMIN 100
+#define SPECTRUM_FMAX (ADC_SAMPLE_RATE / 4)
+// Measurements per second
+#define SPECTRUM_RATE ((double) ADC_SAMPLE_RATE / ADC_BLOCK / SPECTRUM_BLOCKS)
+
+// Shows the spectrum of the ADC input instead of the built-in effect.
+static uint8_t spectrum_task(sched_task_t *task) {
+	static spec_goertzel_t bank[SPECTRUM_BANDS];
+	static bars_t bars;
+	static uint8_t smooth[SPECTRUM_BANDS];
+	static uint8_t log2n;
+	static uint8_t blocks;
+	static const int8_t *samples;
+	PT_BEGIN(&task->pt);
+	uint16_t freqs[SPECTRUM_BANDS];
+	spec_log_bands(freqs, SPECTRUM_BANDS, SPECTRUM_FMIN, SPECTRUM_FMAX);
+	for (uint8_t b = 0; b < SPECTRUM_BANDS; b++) {
+		spec_goertzel_init(&bank[b], freqs[b], ADC_SAMPLE_RATE);
+	}
+	for (uint16_t n = ADC_BLOCK * SPECTRUM_BLOCKS; n > 1; n >>= 1) {
+		log2n++;
+	}
+	bars_init(&bars, 16, 160, 255, 24);
+	adc_init();
+	while (true) {
+		PT_WAIT_UNTIL(&task->pt, (samples = adc_get_block()) != 0);
+		spec_goertzel_block(bank, SPECTRUM_BANDS, samples, ADC_BLOCK);
+		if (++blocks < SPECTRUM_BLOCKS) {
+			continue;
+		}
+		blocks = 0;
+		uint8_t levels[SPECTRUM_BANDS];
+		spec_goertzel_levels(bank, SPECTRUM_BANDS, log2n, levels);
+		spec_smooth(smooth, levels, SPECTRUM_BANDS, dsp_iir_lowpass_alpha(30, 1.0 / SPECTRUM_RATE), dsp_iir_lowpass_alpha(3, 1.0 / SPECTRUM_RATE));
+		// drop the frame rather than stall the analysis if the last one
+		// isn't out yet
+		if (!frame_ready) {
+			bars_render(&bars, smooth, SPECTRUM_BANDS);
+			frame_ready = true;
+		}
+	}
+	PT_END(&task->pt);
+}
+#endif
+
+#if !defined(UART_BAUD) && !defined(ADC_CHANNEL)
+// Renders the built-in fire effect, one row per call.
+static uint8_t effect_task(sched_task_t *task) {
+	static ws_coord_t y;
+	PT_BEGIN(&task->pt);
+	// the frame buffer is ours once the last frame is out
+	PT_WAIT_WHILE(&task->pt, frame_ready);
+	
+	// spawn a new spark at the bottom row
+#if WS_WIDTH > 255
+	ws_coord_t p = lfsr_get_short() % WS_WIDTH;
+#else
+	uint8_t p = lfsr_get_byte();
+	//uint8_t p = rand();
+	p %= WS_WIDTH;
+#endif
+	ws_set_pixel(p, WS_HEIGHT - 1, add_sat_u8(ws_get_pixel(p, WS_HEIGHT - 1), 8));
+	
+	for (y = WS_HEIGHT; y-- > 0;) {
+		for (ws_coord_t x = 0; x < WS_WIDTH; x++) {
+			// weighted blur
+			uint8_t c = ws_get_pixel(x, y);
+			uint8_t xm = x > 0 ? ws_get_pixel(x - 1, y) : 0;
+			uint8_t xp = x < WS_WIDTH - 1 ? ws_get_pixel(x + 1, y) : 0;
+			uint8_t ym = y > 0 ? ws_get_pixel(x, y - 1) : 0;
+			uint8_t yp = y < WS_HEIGHT - 1 ? ws_get_pixel(x, y + 1) : c;
+			uint16_t a = c * 127;
+			a += xm * 31;
+			a += xp * 31;
+			a += ym * 7;
+			a += yp * 63;
+			
+			// look up the new color and assign it
+			ws_set_pixel(x, y, (uint8_t) (a / 256));
+		}
+		// a complete row is a safe point to let the other tasks in
+		PT_YIELD(&task->pt);
+	}
+	
+	frame_ready = true;
+	PT_END(&task->pt);
+}
+#endif
+
 int main() {
+	static sched_task_t scan, source;
+	
 	pal_init();
 	ws_init();
-	
 	lfsr_init(0);
 	//srand(0);
+	sched_init();
 	
-	while (true) {
-		// spawn a new spark at the bottom row
-		uint8_t p = lfsr_get_byte();
-		//uint8_t p = rand();
-		p %= WS_WIDTH;
-		ws_set_pixel(p, WS_HEIGHT - 1, add_sat_u8(ws_get_pixel(p, WS_HEIGHT - 1), 8));
-		
-		for (uint8_t y = WS_HEIGHT; y-- > 0;) {
-			for (uint8_t x = 0; x < WS_WIDTH; x++) {
-				// weighted blur
-				uint8_t c = ws_get_pixel(x, y);
-				uint8_t xm = x > 0 ? ws_get_pixel(x - 1, y) : 0;
-				uint8_t xp = x < WS_WIDTH - 1 ? ws_get_pixel(x + 1, y) : 0;
-				uint8_t ym = y > 0 ? ws_get_pixel(x, y - 1) : 0;
-				uint8_t yp = y < WS_HEIGHT - 1 ? ws_get_pixel(x, y + 1) : c;
-				uint16_t a = c * 127;
-				a += xm * 31;
-				a += xp * 31;
-				a += ym * 7;
-				a += yp * 63;
-				
-				// look up the new color and assign it
-				ws_set_pixel(x, y, (uint8_t) (a / 256));
-			}
-		}
-		
-		ws_scan_fb();
-		//_delay_ms(150);
-	}
+	sched_task_init(&scan, scan_task, NULL, 0, FRAME_PERIOD);
+	sched_add(&scan);
+#if defined(UART_BAUD)
+	uart_init();
+	stream_init();
+	// poll before the receive buffer fills up
+	sched_task_init(&source, stream_task, NULL, 0, SCHED_US(UART_RX_BUFFER / 2 * 10000000UL / UART_BAUD));
+#elif defined(ADC_CHANNEL)
+	// poll at least once per block
+	sched_task_init(&source, spectrum_task, NULL, 0, SCHED_US(ADC_BLOCK * 1000000UL / ADC_SAMPLE_RATE));
+#else
+	sched_task_init(&source, effect_task, NULL, FRAME_PERIOD, FRAME_PERIOD);
+#endif
+	sched_add(&source);
+#if defined(UART_BAUD) || defined(ADC_CHANNEL)
+	sei();
+#endif
+	
+	sched_run();
 }
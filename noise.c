@@ -0,0 +1,259 @@
+/*
+ * Coherent noise generator
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "noise.h"
+#include "tinymath.h"
+#include "tiny_table.h"
+
+// Permutation of 0..255, used as a hash function for the lattice points
+static const PROGMEM uint8_t noise_perm[] = NOISE_PERM_TABLE;
+
+// Normalisation factors for octave sums, 64 / (1 - 2^-octaves).
+// The sum is halved before it is scaled, see _noise_fbm_sum().
+static const PROGMEM uint8_t noise_fbm_norm[NOISE_MAX_OCTAVES] = { 128, 85, 73, 68, 66, 65, 64, 64 };
+
+static inline uint8_t _noise_perm(uint8_t index) {
+	return pgm_read_byte(&noise_perm[index]);
+}
+
+// Smoothstep 3f^2 - 2f^3, written as a blend between f^2 and 1 - (1 - f)^2
+static inline uint8_t _noise_smooth(uint8_t f) {
+	return blend_fix_u8(mul_fix_u8(f, f), 255 - mul_fix_u8(255 - f, 255 - f), f);
+}
+
+static inline int8_t _noise_clamp_s8(int16_t value) {
+	if (value > 127) {
+		return 127;
+	}
+	if (value < -127) {
+		return -127;
+	}
+	return (int8_t) value;
+}
+
+// Maps a signed noise value to the output range.
+// Gradient noise rarely gets near the theoretical maximum, so it is scaled up.
+static inline uint8_t _noise_output(int8_t value) {
+	return (uint8_t) (_noise_clamp_s8((int16_t) value * 2) + 128);
+}
+
+// Selects one of Perlin's 12 edge gradients with the low 4 bits of a hash.
+// Returns the x component (as 64 for 1/2, since all dot products are halved)
+// in slope and the dot product of the y and z components with fy, fz in offset.
+static void _noise_gradient(uint8_t hash, int8_t fy, int8_t fz, int8_t *slope, int8_t *offset) {
+	uint8_t h = hash & 15;
+	int8_t gx = 0;
+	int16_t yz = 0;
+	// first component: x for h < 8, y otherwise
+	if (h < 8) {
+		gx = h & 1 ? -64 : 64;
+	} else {
+		yz = h & 1 ? -fy : fy;
+	}
+	// second component: y for h < 4, x for 12 and 14, z otherwise
+	if (h < 4) {
+		yz += h & 2 ? -fy : fy;
+	} else if (h == 12 || h == 14) {
+		gx = h & 2 ? -64 : 64;
+	} else {
+		yz += h & 2 ? -fz : fz;
+	}
+	*slope = gx;
+	*offset = (int8_t) (yz / 2);
+}
+
+// Interpolates the four lattice points of the column at cx over y and z.
+static void _noise_column(const noise_row_t *row, _noise_column_t *column, uint8_t cx) {
+	uint8_t p = _noise_perm(cx);
+	uint8_t py0 = _noise_perm(p + row->cy);
+	uint8_t py1 = _noise_perm(p + row->cy + 1);
+	// with z on a lattice plane, the second plane doesn't contribute
+	bool flat = row->fz == 0;
+	uint8_t h00 = _noise_perm(py0 + row->cz);
+	uint8_t h10 = _noise_perm(py1 + row->cz);
+	uint8_t h01 = 0, h11 = 0;
+	if (!flat) {
+		h01 = _noise_perm(py0 + row->cz + 1);
+		h11 = _noise_perm(py1 + row->cz + 1);
+	}
+
+	if (row->type == NOISE_VALUE) {
+		uint8_t value = blend_fix_u8(h00, h10, row->sy);
+		if (!flat) {
+			value = blend_fix_u8(value, blend_fix_u8(h01, h11, row->sy), row->sz);
+		}
+		column->value = value;
+	} else {
+		int8_t fy1 = row->fy - 128;
+		int8_t fz1 = row->fz - 128;
+		int8_t s0, o0, s1, o1;
+		_noise_gradient(h00, row->fy, row->fz, &s0, &o0);
+		_noise_gradient(h10, fy1, row->fz, &s1, &o1);
+		int8_t slope = blend_fix_su8(s0, s1, row->sy);
+		int8_t offset = blend_fix_su8(o0, o1, row->sy);
+		if (!flat) {
+			_noise_gradient(h01, row->fy, fz1, &s0, &o0);
+			_noise_gradient(h11, fy1, fz1, &s1, &o1);
+			slope = blend_fix_su8(slope, blend_fix_su8(s0, s1, row->sy), row->sz);
+			offset = blend_fix_su8(offset, blend_fix_su8(o0, o1, row->sy), row->sz);
+		}
+		column->slope = slope;
+		column->offset = offset;
+	}
+}
+
+// Completes the dot product of a column with the x distance f (Q1.7)
+static inline int8_t _noise_dot(const _noise_column_t *column, int8_t f) {
+	return _noise_clamp_s8((mul_us_s8(column->slope, f) >> 7) + column->offset);
+}
+
+void noise_row_begin(noise_row_t *row, uint8_t type, uint16_t x, uint16_t dx, uint16_t y, uint16_t z) {
+	row->type = type;
+	row->x = x;
+	row->dx = dx;
+	row->cy = y >> 8;
+	row->cz = z >> 8;
+	row->sy = _noise_smooth((uint8_t) y);
+	row->sz = _noise_smooth((uint8_t) z);
+	row->fy = (uint8_t) y >> 1;
+	row->fz = (uint8_t) z >> 1;
+	row->cx = x >> 8;
+	_noise_column(row, &row->column[0], row->cx);
+	_noise_column(row, &row->column[1], row->cx + 1);
+}
+
+uint8_t noise_row_next(noise_row_t *row) {
+	uint8_t cx = row->x >> 8;
+	if (cx != row->cx) {
+		// reuse one column when moving to a neighbouring cell
+		if (cx == (uint8_t) (row->cx + 1)) {
+			row->column[0] = row->column[1];
+			_noise_column(row, &row->column[1], cx + 1);
+		} else if (cx == (uint8_t) (row->cx - 1)) {
+			row->column[1] = row->column[0];
+			_noise_column(row, &row->column[0], cx);
+		} else {
+			_noise_column(row, &row->column[0], cx);
+			_noise_column(row, &row->column[1], cx + 1);
+		}
+		row->cx = cx;
+	}
+	uint8_t f = (uint8_t) row->x;
+	row->x += row->dx;
+	uint8_t s = _noise_smooth(f);
+	if (row->type == NOISE_VALUE) {
+		return blend_fix_u8(row->column[0].value, row->column[1].value, s);
+	}
+	int8_t f0 = f >> 1;
+	int8_t d0 = _noise_dot(&row->column[0], f0);
+	int8_t d1 = _noise_dot(&row->column[1], f0 - 128);
+	return _noise_output(blend_fix_su8(d0, d1, s));
+}
+
+uint8_t noise_value1(uint16_t x) {
+	uint8_t cx = x >> 8;
+	return blend_fix_u8(_noise_perm(cx), _noise_perm(cx + 1), _noise_smooth((uint8_t) x));
+}
+
+uint8_t noise_value2(uint16_t x, uint16_t y) {
+	return noise_value3(x, y, 0);
+}
+
+uint8_t noise_value3(uint16_t x, uint16_t y, uint16_t z) {
+	noise_row_t row;
+	noise_row_begin(&row, NOISE_VALUE, x, 0, y, z);
+	return noise_row_next(&row);
+}
+
+uint8_t noise_grad1(uint16_t x) {
+	uint8_t cx = x >> 8;
+	// the hash is used as a slope directly
+	int8_t g0 = (int8_t) _noise_perm(cx);
+	int8_t g1 = (int8_t) _noise_perm(cx + 1);
+	int8_t f0 = (uint8_t) x >> 1;
+	int8_t d0 = mul_us_s8(g0, f0) >> 7;
+	int8_t d1 = mul_us_s8(g1, f0 - 128) >> 7;
+	return _noise_output(blend_fix_su8(d0, d1, _noise_smooth((uint8_t) x)));
+}
+
+uint8_t noise_grad2(uint16_t x, uint16_t y) {
+	return noise_grad3(x, y, 0);
+}
+
+uint8_t noise_grad3(uint16_t x, uint16_t y, uint16_t z) {
+	noise_row_t row;
+	noise_row_begin(&row, NOISE_GRADIENT, x, 0, y, z);
+	return noise_row_next(&row);
+}
+
+// Clamps the number of octaves to 1..NOISE_MAX_OCTAVES
+static inline uint8_t _noise_octaves(uint8_t octaves) {
+	if (octaves < 1) {
+		return 1;
+	}
+	if (octaves > NOISE_MAX_OCTAVES) {
+		return NOISE_MAX_OCTAVES;
+	}
+	return octaves;
+}
+
+// Sums signed octaves with halving amplitudes and scales to the output range.
+// octaves must be within 1..NOISE_MAX_OCTAVES.
+static inline uint8_t _noise_fbm_sum(int16_t sum, uint8_t octaves) {
+	int16_t value = mul_us_su8((int8_t) (sum / 2), pgm_read_byte(&noise_fbm_norm[octaves - 1])) / 64;
+	if (value > 127) {
+		value = 127;
+	} else if (value < -128) {
+		value = -128;
+	}
+	return (uint8_t) (value + 128);
+}
+
+uint8_t noise_fbm3(uint8_t type, uint16_t x, uint16_t y, uint16_t z, uint8_t octaves) {
+	noise_row_t rows[NOISE_MAX_OCTAVES];
+	octaves = _noise_octaves(octaves);
+	noise_fbm_begin(rows, octaves, type, x, 0, y, z);
+	return noise_fbm_next(rows, octaves);
+}
+
+void noise_fbm_begin(noise_row_t *rows, uint8_t octaves, uint8_t type, uint16_t x, uint16_t dx, uint16_t y, uint16_t z) {
+	octaves = _noise_octaves(octaves);
+	for (uint8_t i = 0; i < octaves; i++) {
+		// octaves are shifted along z, so they don't share lattice points at the origin
+		noise_row_begin(&rows[i], type, x << i, dx << i, y << i, (z << i) + ((uint16_t) i << 13));
+	}
+}
+
+uint8_t noise_fbm_next(noise_row_t *rows, uint8_t octaves) {
+	int16_t sum = 0;
+	octaves = _noise_octaves(octaves);
+	for (uint8_t i = 0; i < octaves; i++) {
+		sum += ((int16_t) noise_row_next(&rows[i]) - 128) >> i;
+	}
+	return _noise_fbm_sum(sum, octaves);
+}
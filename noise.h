@@ -0,0 +1,127 @@
+/*
+ * Coherent noise generator
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _NOISE_H
+#define _NOISE_H
+
+#include <stdint.h>
+
+// Coherent value and gradient noise in 8-bit fixed point.
+//
+// Coordinates are 8.8 fixed point: the high byte selects the lattice cell,
+// the low byte is the position inside the cell. The pattern repeats every
+// 256 cells. All functions return 0..255, centered around 128.
+//
+// Value noise interpolates random values at the lattice points, gradient
+// (Perlin) noise interpolates random slopes. Gradient noise has fewer
+// blocky artifacts, value noise is cheaper.
+// 2D noise is a slice through 3D noise at z = 0, so animating a 2D effect
+// is done by moving along z.
+//
+// Rough cycle estimates for avr-gcc -Os on a 16MHz ATmega:
+//
+// function                     value      gradient
+// noise_*1()                   ~80        ~110
+// noise_*2()                   ~300       ~420
+// noise_*3()                   ~480       ~680
+// noise_row_next()             ~60        ~90      per pixel
+//   + one new lattice column   ~260       ~380     once per cell
+// octaves                      sum of the above, plus ~20 per octave
+//
+// With a step of less than one cell per pixel, row mode costs little more
+// than the per pixel figure: a 30x10 display at dx = 0x0040 needs about
+// 300 * 60 + 10 * 8 * 260 = 39000 cycles for a frame of 3D value noise.
+
+#define NOISE_VALUE 0
+#define NOISE_GRADIENT 1
+
+// The maximum number of octaves supported by the summation functions.
+// Octave counts outside of 1..NOISE_MAX_OCTAVES are clamped to that range.
+#define NOISE_MAX_OCTAVES 8
+
+// Lattice values along a column, interpolated over y and z.
+typedef struct {
+	// value noise: interpolated value
+	uint8_t value;
+	// gradient noise: x gradient, and the y/z part of the dot product
+	int8_t slope, offset;
+} _noise_column_t;
+
+// Incremental state for stepping along a row.
+typedef struct {
+	// NOISE_VALUE or NOISE_GRADIENT
+	uint8_t type;
+	// current x position and step per pixel, 8.8 fixed point
+	uint16_t x, dx;
+	// lattice cell and interpolation parameters of the fixed y and z coordinates
+	uint8_t cy, cz, sy, sz;
+	int8_t fy, fz;
+	// currently cached lattice cell and its left and right columns
+	uint8_t cx;
+	_noise_column_t column[2];
+} noise_row_t;
+
+// 1D value noise
+uint8_t noise_value1(uint16_t x);
+
+// 2D value noise
+uint8_t noise_value2(uint16_t x, uint16_t y);
+
+// 3D value noise
+uint8_t noise_value3(uint16_t x, uint16_t y, uint16_t z);
+
+// 1D gradient noise
+uint8_t noise_grad1(uint16_t x);
+
+// 2D gradient noise
+uint8_t noise_grad2(uint16_t x, uint16_t y);
+
+// 3D gradient noise
+uint8_t noise_grad3(uint16_t x, uint16_t y, uint16_t z);
+
+// Prepares stepping along a row, starting at x and advancing by dx per pixel.
+// y and z stay fixed, use z = 0 for 2D noise.
+// noise_row_next() then returns exactly the same values as noise_value3() or
+// noise_grad3(), but only looks up the lattice when it enters a new cell.
+void noise_row_begin(noise_row_t *row, uint8_t type, uint16_t x, uint16_t dx, uint16_t y, uint16_t z);
+
+// Returns the noise at the current position and advances by one pixel.
+uint8_t noise_row_next(noise_row_t *row);
+
+// Sum of octaves 1..octaves, each with twice the frequency and half the
+// amplitude of the previous one, normalised to the full output range.
+// z moves faster on higher octaves, so the fine detail changes more quickly.
+// octaves is clamped to 1..NOISE_MAX_OCTAVES.
+uint8_t noise_fbm3(uint8_t type, uint16_t x, uint16_t y, uint16_t z, uint8_t octaves);
+
+// Prepares octave summation along a row. rows must hold octaves states,
+// or NOISE_MAX_OCTAVES if octaves may be out of range.
+void noise_fbm_begin(noise_row_t *rows, uint8_t octaves, uint8_t type, uint16_t x, uint16_t dx, uint16_t y, uint16_t z);
+
+// Returns the same as noise_fbm3() at the current position and advances by one pixel.
+uint8_t noise_fbm_next(noise_row_t *rows, uint8_t octaves);
+
+#endif /*_NOISE_H*/
@@ -25,6 +25,7 @@
  */
 
 #include "palette.h"
+#include "tinymath.h"
 
 #if PAL_MODE == PAL_MODE_ROM
 
@@ -41,4 +42,121 @@ void _pal_init_ram() {
 	PAL_TABLE_VAR[255] = PAL_COMPUTE(255);
 }
 
+// palette transition state
+static rgb_t (*pal_morph_func)(uint8_t index);
+static const rgb_t *pal_morph_table;
+// passes left, including the current one
+static uint8_t pal_morph_passes;
+// next entry to update
+static uint8_t pal_morph_next;
+// blend factor for the current pass
+static uint8_t pal_morph_alpha;
+
+static void _pal_morph_pass() {
+	// moving 1/n of the remaining distance in each of the n remaining passes
+	// results in a linear transition, without keeping the source palette.
+	// the last pass copies the target, so rounding errors don't accumulate.
+	pal_morph_alpha = pal_morph_passes > 1 ? (uint8_t) (256 / pal_morph_passes) : 255;
+}
+
+void pal_morph_compute(rgb_t (*compute)(uint8_t index), uint8_t passes) {
+	pal_morph_func = compute;
+	pal_morph_table = 0;
+	pal_morph_passes = passes ? passes : 1;
+	pal_morph_next = 0;
+	_pal_morph_pass();
+}
+
+void pal_morph_rom(const rgb_t *rom, uint8_t passes) {
+	pal_morph_func = 0;
+	pal_morph_table = rom;
+	pal_morph_passes = passes ? passes : 1;
+	pal_morph_next = 0;
+	_pal_morph_pass();
+}
+
+bool pal_morph_step() {
+	for (uint8_t n = PAL_MORPH_BUDGET; n > 0 && pal_morph_passes > 0; n--) {
+		uint8_t i = pal_morph_next;
+		rgb_t target;
+		if (pal_morph_func) {
+			target = pal_morph_func(i);
+		} else {
+			target.r = pgm_read_byte(&pal_morph_table[i].r);
+			target.g = pgm_read_byte(&pal_morph_table[i].g);
+			target.b = pgm_read_byte(&pal_morph_table[i].b);
+		}
+		if (pal_morph_passes == 1) {
+			PAL_TABLE_VAR[i] = target;
+		} else {
+			rgb_t *color = &PAL_TABLE_VAR[i];
+			color->r = blend_fix_u8(color->r, target.r, pal_morph_alpha);
+			color->g = blend_fix_u8(color->g, target.g, pal_morph_alpha);
+			color->b = blend_fix_u8(color->b, target.b, pal_morph_alpha);
+		}
+		if (++pal_morph_next == 0) {
+			pal_morph_passes--;
+			_pal_morph_pass();
+		}
+	}
+	return pal_morph_passes > 0;
+}
+
+#endif
+
+#if PAL_CYCLE_RANGES > 0
+
+pal_cycle_t pal_cycles[PAL_CYCLE_RANGES];
+
+void pal_cycle_set(uint8_t range, uint8_t start, uint8_t length, int16_t speed, uint8_t flags) {
+	pal_cycle_t *cycle = &pal_cycles[range];
+	cycle->start = start;
+	cycle->length = length;
+	cycle->phase = 0;
+	cycle->speed = speed;
+	cycle->flags = flags & ~_PAL_CYCLE_REVERSE;
+	cycle->offset = 0;
+}
+
+void pal_cycle_step() {
+	for (uint8_t i = 0; i < PAL_CYCLE_RANGES; i++) {
+		pal_cycle_t *cycle = &pal_cycles[i];
+		if (cycle->length == 0) {
+			continue;
+		}
+		int32_t phase = cycle->phase;
+		if (cycle->flags & PAL_CYCLE_PINGPONG) {
+			// bounce between the first and the last entry
+			int32_t end = (int32_t) (cycle->length - 1) << 8;
+			if (cycle->flags & _PAL_CYCLE_REVERSE) {
+				phase -= cycle->speed;
+			} else {
+				phase += cycle->speed;
+			}
+			if (phase > end) {
+				phase = 2 * end - phase;
+				cycle->flags ^= _PAL_CYCLE_REVERSE;
+			} else if (phase < 0) {
+				phase = -phase;
+				cycle->flags ^= _PAL_CYCLE_REVERSE;
+			}
+			// only possible if speed exceeds the range
+			if (phase < 0 || phase > end) {
+				phase = 0;
+			}
+		} else {
+			int32_t end = (int32_t) cycle->length << 8;
+			phase += cycle->speed;
+			while (phase >= end) {
+				phase -= end;
+			}
+			while (phase < 0) {
+				phase += end;
+			}
+		}
+		cycle->phase = (uint16_t) phase;
+		cycle->offset = (uint8_t) (cycle->phase >> 8);
+	}
+}
+
 #endif
@@ -28,6 +28,7 @@
 #define _PALETTE_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "config.h"
 
 // Supported configuration variables:
@@ -66,6 +67,34 @@
 #warning PAL_COMPUTE not defined, defaulting to pal_compute
 #define PAL_COMPUTE pal_compute
 #endif
+// PAL_CYCLE_RANGES: Number of independent palette cycling ranges.
+// Cycling works by remapping indices on lookup, so it is available in all
+// palette modes. Each range adds a few cycles to every lookup.
+// A range holds at most 255 entries, the length is 8 bits wide and 0
+// disables it. The full 256 entry palette can't be cycled as one range.
+// Defaults to 0 (disabled).
+#ifndef PAL_CYCLE_RANGES
+#define PAL_CYCLE_RANGES 0
+#endif
+// PAL_DITHER: Define to enable temporal dithering.
+// The palette holds 16 bits per channel (8.8 fixed point) instead of 8, and
+// the LED driver adds the fraction in ordered steps over several frames, so
+// the average brightness has 16 bit precision. Best with a high frame rate.
+// In ROM mode, PAL_TABLE_VAR is a pal16_t, in CAL mode PAL_COMPUTE returns
+// rgb16_t. Not available in RAM mode, the palette would need 1.5KB of RAM.
+// Defaults to undefined.
+//#define PAL_DITHER
+#if defined(PAL_DITHER) && PAL_MODE == PAL_MODE_RAM
+#error PAL_DITHER needs PAL_MODE_ROM or PAL_MODE_CAL
+#endif
+// PAL_MORPH_BUDGET: Maximum number of palette entries updated per call to
+// pal_morph_step(). Each entry costs roughly 60 cycles plus the time it takes
+// to compute or load the target color, so this caps the per-frame cost of
+// palette transitions. Only used in RAM mode.
+// Defaults to 32.
+#ifndef PAL_MORPH_BUDGET
+#define PAL_MORPH_BUDGET 32
+#endif
 
 // Data structure for RGB888 color data.
 typedef struct {
@@ -82,8 +111,38 @@ static inline rgb_t rgb_mk(uint8_t r, uint8_t g, uint8_t b) {
 	return color;
 }
 
+// Data structure for RGB colors with 16 bits per channel, used for dithering.
+// The high byte is the 8 bit value, the low byte a fraction.
+typedef struct {
+	uint16_t r, g, b;
+} rgb16_t;
+
+// Palette with 16 bits per channel
+typedef rgb16_t pal16_t[256];
+
+static inline rgb16_t rgb16_mk(uint16_t r, uint16_t g, uint16_t b) {
+	rgb16_t color = { .r = r, .g = g, .b = b };
+	return color;
+}
+
 #if PAL_MODE == PAL_MODE_ROM
+#ifdef __AVR_ARCH__
 #include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#define pgm_read_byte(ref) (*(uint8_t *) (ref))
+#define pgm_read_word(ref) (*(uint16_t *) (ref))
+#endif
+#ifdef PAL_DITHER
+extern const PROGMEM pal16_t PAL_TABLE_VAR;
+static inline rgb16_t _pal_lookup_rom(uint8_t index) {
+	rgb16_t color;
+	color.r = pgm_read_word(&PAL_TABLE_VAR[index].r);
+	color.g = pgm_read_word(&PAL_TABLE_VAR[index].g);
+	color.b = pgm_read_word(&PAL_TABLE_VAR[index].b);
+	return color;
+}
+#else
 extern const PROGMEM pal_t PAL_TABLE_VAR;
 static inline rgb_t _pal_lookup_rom(uint8_t index) {
 	rgb_t color;
@@ -92,6 +151,7 @@ static inline rgb_t _pal_lookup_rom(uint8_t index) {
 	color.b = pgm_read_byte(&PAL_TABLE_VAR[index].b);
 	return color;
 }
+#endif
 #elif PAL_MODE == PAL_MODE_RAM
 extern pal_t PAL_TABLE_VAR;
 rgb_t PAL_COMPUTE(uint8_t index);
@@ -99,15 +159,92 @@ void _pal_init_ram();
 static inline rgb_t _pal_lookup_ram(uint8_t index) {
 	return PAL_TABLE_VAR[index];
 }
+// Replaces a single palette entry. Only available in RAM mode.
+static inline void pal_set(uint8_t index, rgb_t color) {
+	PAL_TABLE_VAR[index] = color;
+}
+// Starts a transition from the current palette to a computed one.
+// The transition takes the given number of passes over the whole palette,
+// each pass needing 256 / PAL_MORPH_BUDGET calls to pal_morph_step().
+// A single pass rebuilds the palette without blending, spreading the work
+// of pal_init() over several frames.
+void pal_morph_compute(rgb_t (*compute)(uint8_t index), uint8_t passes);
+// Starts a transition to a palette in ROM.
+void pal_morph_rom(const rgb_t *rom, uint8_t passes);
+// Updates up to PAL_MORPH_BUDGET entries. Call once per frame.
+// Returns true while the transition is still in progress.
+bool pal_morph_step();
 #elif PAL_MODE == PAL_MODE_CAL
+#ifdef PAL_DITHER
+rgb16_t PAL_COMPUTE(uint8_t index);
+static inline rgb16_t _pal_lookup_cal(uint8_t index) {
+	return PAL_COMPUTE(index);
+}
+#else
 rgb_t PAL_COMPUTE(uint8_t index);
 static inline rgb_t _pal_lookup_cal(uint8_t index) {
 	return PAL_COMPUTE(index);
 }
+#endif
 #else
 #error Invalid palette lookup mode
 #endif
 
+#if PAL_CYCLE_RANGES > 0
+// Palette cycling range
+typedef struct {
+	// first palette index of the range
+	uint8_t start;
+	// number of entries, 0 disables the range
+	uint8_t length;
+	// current rotation, in entries (Q8.8)
+	uint16_t phase;
+	// rotation per step, in entries (Q8.8), negative values rotate backwards
+	int16_t speed;
+	// PAL_CYCLE_ flags
+	uint8_t flags;
+	// integer part of the rotation, cached for lookups
+	uint8_t offset;
+} pal_cycle_t;
+
+// Reverse direction at the ends of the range instead of wrapping around.
+#define PAL_CYCLE_PINGPONG 0x01
+// internal: ping-pong is currently moving backwards
+#define _PAL_CYCLE_REVERSE 0x80
+
+extern pal_cycle_t pal_cycles[PAL_CYCLE_RANGES];
+
+// Sets up a cycling range.
+// range = range number, 0..PAL_CYCLE_RANGES-1
+// start, length = palette entries affected, length 1..255, 0 disables the range
+// speed = rotation per pal_cycle_step() call, in entries (Q8.8)
+// flags = PAL_CYCLE_ flags
+void pal_cycle_set(uint8_t range, uint8_t start, uint8_t length, int16_t speed, uint8_t flags);
+
+// Advances all ranges by one step. Call once per frame.
+void pal_cycle_step();
+
+// Applies the current rotation to a palette index.
+// Ranges must not overlap, the first matching range wins.
+static inline uint8_t _pal_remap(uint8_t index) {
+	for (uint8_t i = 0; i < PAL_CYCLE_RANGES; i++) {
+		const pal_cycle_t *cycle = &pal_cycles[i];
+		uint8_t rel = index - cycle->start;
+		if (rel < cycle->length) {
+			// (rel + offset) % length, without overflowing 8 bits
+			uint8_t wrap = cycle->length - cycle->offset;
+			if (rel >= wrap) {
+				rel -= wrap;
+			} else {
+				rel += cycle->offset;
+			}
+			return cycle->start + rel;
+		}
+	}
+	return index;
+}
+#endif
+
 // Initialize the palette. Only used in RAM mode.
 static inline void pal_init() {
 #if PAL_MODE == PAL_MODE_ROM
@@ -119,8 +256,35 @@ static inline void pal_init() {
 #endif
 }
 
+#ifdef PAL_DITHER
+// Look up a 16 bit color value from ROM or calculate in-place.
+static inline rgb16_t pal_lookup16(uint8_t index) {
+#if PAL_CYCLE_RANGES > 0
+	index = _pal_remap(index);
+#endif
+#if PAL_MODE == PAL_MODE_ROM
+	return _pal_lookup_rom(index);
+#elif PAL_MODE == PAL_MODE_CAL
+	return _pal_lookup_cal(index);
+#endif
+}
+
+// Rounds a channel to 8 bits
+static inline uint8_t _pal_round16(uint16_t value) {
+	return value >= 0xff80 ? 255 : (uint8_t) ((value + 0x80) >> 8);
+}
+
+// Look up a color value, rounded to 8 bits per channel.
+static inline rgb_t pal_lookup(uint8_t index) {
+	rgb16_t color = pal_lookup16(index);
+	return rgb_mk(_pal_round16(color.r), _pal_round16(color.g), _pal_round16(color.b));
+}
+#else
 // Look up a color value from ROM or RAM, or calculate in-place.
 static inline rgb_t pal_lookup(uint8_t index) {
+#if PAL_CYCLE_RANGES > 0
+	index = _pal_remap(index);
+#endif
 #if PAL_MODE == PAL_MODE_ROM
 	return _pal_lookup_rom(index);
 #elif PAL_MODE == PAL_MODE_RAM
@@ -129,5 +293,6 @@ static inline rgb_t pal_lookup(uint8_t index) {
 	return _pal_lookup_cal(index);
 #endif
 }
+#endif
 
 #endif /*_PALETTE_H*/
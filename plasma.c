@@ -0,0 +1,107 @@
+/*
+ * Plasma and interference effect engine
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include "plasma.h"
+#include "ws2812.h"
+#include "tinymath.h"
+
+#ifdef PLASMA_RADIAL
+#include "dist_table.h"
+#if DIST_TABLE_WIDTH != WS_WIDTH || DIST_TABLE_HEIGHT != WS_HEIGHT
+#error dist_table.h does not match the display size, rerun gendist.pl
+#endif
+static const PROGMEM uint8_t plasma_dist[] = DIST_TABLE;
+#endif
+
+// per-frame scratch space for the separable terms
+static uint8_t plasma_col[WS_WIDTH];
+static uint8_t plasma_row[WS_HEIGHT];
+
+static inline void _plasma_advance(plasma_t *plasma) {
+	for (uint8_t i = 0; i < 2; i++) {
+		plasma->tx[i] += plasma->vx[i];
+		plasma->ty[i] += plasma->vy[i];
+	}
+	plasma->tr += plasma->vr;
+}
+
+void plasma_render(plasma_t *plasma) {
+	// column terms, the phase is stepped instead of multiplied
+	uint8_t a0 = plasma->tx[0], a1 = plasma->tx[1];
+	for (ws_coord_t x = 0; x < WS_WIDTH; x++) {
+		plasma_col[x] = fastsin8(a0) + fastsin8(a1);
+		a0 += plasma->fx[0];
+		a1 += plasma->fx[1];
+	}
+	// row terms, with the palette offset folded in
+	a0 = plasma->ty[0];
+	a1 = plasma->ty[1];
+	for (ws_coord_t y = 0; y < WS_HEIGHT; y++) {
+		plasma_row[y] = fastsin8(a0) + fastsin8(a1) + plasma->offset;
+		a0 += plasma->fy[0];
+		a1 += plasma->fy[1];
+	}
+	// combine
+	uint8_t *p = ws_fb;
+	_ws_count_cycles(2 * (WS_WIDTH + WS_HEIGHT) * PLASMA_CYCLES_SINE + (uint32_t) _WS_FB_SIZE * (PLASMA_CYCLES_ADD + PLASMA_CYCLES_PIXEL));
+#ifdef PLASMA_RADIAL
+	_ws_count_cycles((uint32_t) _WS_FB_SIZE * (PLASMA_CYCLES_SINE + PLASMA_CYCLES_ADD));
+	const uint8_t *d = plasma_dist;
+	uint8_t fr = plasma->fr, tr = plasma->tr;
+#endif
+	for (ws_coord_t y = 0; y < WS_HEIGHT; y++) {
+		uint8_t row = plasma_row[y];
+		for (ws_coord_t x = 0; x < WS_WIDTH; x++) {
+			uint8_t index = row + plasma_col[x];
+#ifdef PLASMA_RADIAL
+			index += fastsin8((uint8_t) (pgm_read_byte(d++) * fr) + tr);
+#endif
+			*p++ = index;
+		}
+	}
+	_plasma_advance(plasma);
+}
+
+void plasma_render_naive(plasma_t *plasma) {
+	uint8_t *p = ws_fb;
+	_ws_count_cycles((uint32_t) _WS_FB_SIZE * (4 * PLASMA_CYCLES_SINE + PLASMA_CYCLES_PIXEL));
+#ifdef PLASMA_RADIAL
+	_ws_count_cycles((uint32_t) _WS_FB_SIZE * PLASMA_CYCLES_SINE);
+#endif
+	for (ws_coord_t y = 0; y < WS_HEIGHT; y++) {
+		for (ws_coord_t x = 0; x < WS_WIDTH; x++) {
+			int8_t col = fastsin8(plasma->tx[0] + x * plasma->fx[0]) + fastsin8(plasma->tx[1] + x * plasma->fx[1]);
+			int8_t row = fastsin8(plasma->ty[0] + y * plasma->fy[0]) + fastsin8(plasma->ty[1] + y * plasma->fy[1]);
+			uint8_t index = (uint8_t) col + (uint8_t) row + plasma->offset;
+#ifdef PLASMA_RADIAL
+			index += fastsin8((uint8_t) (pgm_read_byte(&plasma_dist[y * WS_WIDTH + x]) * plasma->fr) + plasma->tr);
+#endif
+			*p++ = index;
+		}
+	}
+	_plasma_advance(plasma);
+}
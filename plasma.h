@@ -0,0 +1,83 @@
+/*
+ * Plasma and interference effect engine
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _PLASMA_H
+#define _PLASMA_H
+
+#include <stdint.h>
+#include "config.h"
+
+// Supported configuration variables:
+// PLASMA_RADIAL: Define to enable the radial term.
+// Requires a distance map for the configured display size in dist_table.h,
+// which is generated by gendist.pl from WS_WIDTH and WS_HEIGHT.
+// Defaults to undefined.
+//#define PLASMA_RADIAL
+
+// Parameters and state of a plasma effect.
+// Each term is a sine wave with a spatial frequency (angle step per pixel)
+// and a speed (angle step per frame). Angles use the fastsin8() scale,
+// i.e. 256 steps per full turn.
+// The x and y terms are made of two waves each.
+typedef struct {
+	// spatial frequencies
+	uint8_t fx[2], fy[2], fr;
+	// speeds
+	int8_t vx[2], vy[2], vr;
+	// phases, updated by plasma_render()
+	uint8_t tx[2], ty[2], tr;
+	// added to every palette index
+	uint8_t offset;
+} plasma_t;
+
+// Renders one frame into the frame buffer and advances all phases.
+//
+// The x-only and y-only terms are evaluated once per column and row, so a
+// pixel costs just two additions. The radial term needs one sine per pixel.
+// Rough cost per frame, with S ~ 20 cycles for a sine term and P ~ 12 cycles
+// for the per-pixel loop overhead (index store and pointer increment):
+//
+//                  naive                    separable
+// x, y terms       W * H * (4 * S + P)      2 * (W + H) * S + W * H * (2 + P)
+// radial term      + W * H * S              + W * H * (S + 2)
+//
+// 5x4,  no radial  ~1840 cycles             ~640 cycles
+// 30x10, no radial ~27600 cycles            ~5800 cycles
+//
+// The virtual display charges the same figures:
+// S, a sine term
+#define PLASMA_CYCLES_SINE 20
+// P, the per-pixel loop overhead
+#define PLASMA_CYCLES_PIXEL 12
+// adding up the terms of a pixel
+#define PLASMA_CYCLES_ADD 2
+void plasma_render(plasma_t *plasma);
+
+// Renders the same frame as plasma_render(), but evaluates every term for
+// every pixel. Only useful as a reference for comparing output and speed.
+void plasma_render_naive(plasma_t *plasma);
+
+#endif /*_PLASMA_H*/
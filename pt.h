@@ -0,0 +1,90 @@
+/*
+ * Protothreads
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _PT_H
+#define _PT_H
+
+#include <stdint.h>
+
+// Protothreads: stackless coroutines, after the design by Adam Dunkels.
+//
+// A protothread is a function that returns at each blocking point and
+// carries on from there the next time it is called. The only state kept
+// is the position, two bytes in a pt_t. Local variables are lost at a
+// blocking point, so anything that must survive one has to be static or
+// live in a struct owned by the thread.
+//
+// The position is a case label inside a switch statement, which means:
+// - no switch statement may contain a blocking point
+// - there may only be one blocking macro per source line
+//
+// Example:
+//
+// static uint8_t blink(pt_t *pt) {
+//     PT_BEGIN(pt);
+//     while (true) {
+//         PT_WAIT_UNTIL(pt, button_pressed());
+//         toggle_led();
+//         PT_YIELD(pt);
+//     }
+//     PT_END(pt);
+// }
+
+// Protothread state
+typedef struct {
+	uint16_t lc;
+} pt_t;
+
+// Return values
+// blocked in PT_WAIT_UNTIL() or PT_WAIT_WHILE(), no progress
+#define PT_WAITING 0
+// gave up control voluntarily
+#define PT_YIELDED 1
+// reached PT_END(), the next call starts over
+#define PT_ENDED 2
+
+// Sets a protothread back to the start.
+#define PT_INIT(pt) ((pt)->lc = 0)
+
+// Starts the body of a protothread. Must come before any other statements.
+#define PT_BEGIN(pt) switch ((pt)->lc) { case 0:
+
+// Ends the body of a protothread.
+#define PT_END(pt) } (pt)->lc = 0; return PT_ENDED
+
+// Blocks until cond is true. cond is evaluated again on every call.
+#define PT_WAIT_UNTIL(pt, cond) do { (pt)->lc = __LINE__; case __LINE__: if (!(cond)) { return PT_WAITING; } } while (0)
+
+// Blocks while cond is true.
+#define PT_WAIT_WHILE(pt, cond) PT_WAIT_UNTIL(pt, !(cond))
+
+// Returns to the caller once and continues after this point on the next call.
+#define PT_YIELD(pt) do { (pt)->lc = __LINE__; return PT_YIELDED; case __LINE__:; } while (0)
+
+// Starts over on the next call.
+#define PT_RESTART(pt) do { PT_INIT(pt); return PT_YIELDED; } while (0)
+
+#endif /*_PT_H*/
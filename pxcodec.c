@@ -0,0 +1,176 @@
+/*
+ * Run-length and delta pixel codec
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "pxcodec.h"
+
+uint8_t pxc_feed(pxc_t *pxc, uint8_t byte) {
+	// per byte, plus the pixels written by runs and copies below
+	_ws_count_cycles(PXC_CYCLES_BYTE);
+	if (pxc->count == 0) {
+		// op byte, the whole op is checked against the frame size here,
+		// so the data bytes can be written without further bounds checks
+		uint8_t count = (byte & PXC_COUNT_MASK) + 1;
+		if (count > _WS_FB_SIZE - pxc->pos) {
+			return PXC_ERROR;
+		}
+		pxc->op = byte & PXC_OP_MASK;
+		if (pxc->op == PXC_OP_SKIP) {
+			pxc->pos += count;
+		} else {
+			pxc->count = count;
+		}
+	} else {
+		switch (pxc->op) {
+		case PXC_OP_LITERAL:
+			ws_fb[pxc->pos++] = byte;
+			pxc->count--;
+			break;
+		case PXC_OP_RUN:
+			_ws_count_cycles(PXC_CYCLES_RUN * pxc->count);
+			memset(&ws_fb[pxc->pos], byte, pxc->count);
+			pxc->pos += pxc->count;
+			pxc->count = 0;
+			break;
+		case PXC_OP_COPY: {
+			// byte-wise, so overlapping copies repeat the pattern
+			ws_index_t offset = (ws_index_t) byte + 1;
+			if (offset > pxc->pos) {
+				return PXC_ERROR;
+			}
+			_ws_count_cycles(PXC_CYCLES_COPY * pxc->count);
+			uint8_t *dst = &ws_fb[pxc->pos];
+			const uint8_t *src = dst - offset;
+			for (uint8_t i = pxc->count; i > 0; i--) {
+				*dst++ = *src++;
+			}
+			pxc->pos += pxc->count;
+			pxc->count = 0;
+		} break;
+		}
+	}
+	return (pxc->count == 0 && pxc->pos == _WS_FB_SIZE) ? PXC_DONE : PXC_MORE;
+}
+
+#ifndef __AVR_ARCH__
+
+// length of the run of equal bytes starting at frame[i]
+static size_t _pxc_run(const uint8_t *frame, size_t i, size_t size) {
+	size_t n = 1;
+	while (i + n < size && n < PXC_MAX_COUNT && frame[i + n] == frame[i]) {
+		n++;
+	}
+	return n;
+}
+
+// length of the run of unchanged pixels starting at frame[i]
+static size_t _pxc_skip(const uint8_t *frame, const uint8_t *prev, size_t i, size_t size) {
+	size_t n = 0;
+	if (prev) {
+		while (i + n < size && n < PXC_MAX_COUNT && frame[i + n] == prev[i + n]) {
+			n++;
+		}
+	}
+	return n;
+}
+
+// longest back reference for frame[i], the offset is stored in *offset
+static size_t _pxc_match(const uint8_t *frame, size_t i, size_t size, size_t *offset) {
+	size_t best = 0;
+	for (size_t o = 1; o <= PXC_MAX_OFFSET && o <= i; o++) {
+		size_t n = 0;
+		while (i + n < size && n < PXC_MAX_COUNT && frame[i + n] == frame[i + n - o]) {
+			n++;
+		}
+		if (n > best) {
+			best = n;
+			*offset = o;
+		}
+	}
+	return best;
+}
+
+// writes a literal op for frame[from..to), returns the number of bytes written
+static size_t _pxc_literal(const uint8_t *frame, size_t from, size_t to, uint8_t *out) {
+	size_t n = to - from;
+	out[0] = PXC_OP_LITERAL | (uint8_t) (n - 1);
+	memcpy(&out[1], &frame[from], n);
+	return n + 1;
+}
+
+size_t pxc_encode(const uint8_t *frame, const uint8_t *prev, size_t size, uint8_t *out) {
+	size_t len = 0;
+	// start of the pending literal
+	size_t lit = 0;
+	size_t i = 0;
+	while (i < size) {
+		size_t offset = 0;
+		size_t skip = _pxc_skip(frame, prev, i, size);
+		size_t run = _pxc_run(frame, i, size);
+		size_t match = _pxc_match(frame, i, size, &offset);
+		// pick the op that saves the most bytes compared to a literal.
+		// interrupting a pending literal costs an extra op byte, which is
+		// accounted for so the output never exceeds pxc_encode_bound().
+		size_t pending = i > lit ? 1 : 0;
+		uint8_t op;
+		size_t count;
+		if (skip >= 1 + pending && skip + 1 >= run && skip + 1 >= match) {
+			op = PXC_OP_SKIP;
+			count = skip;
+		} else if (run >= 3 + pending && run >= match) {
+			op = PXC_OP_RUN;
+			count = run;
+		} else if (match >= 3 + pending) {
+			op = PXC_OP_COPY;
+			count = match;
+		} else {
+			// extend the pending literal
+			i++;
+			if (i - lit == PXC_MAX_COUNT) {
+				len += _pxc_literal(frame, lit, i, &out[len]);
+				lit = i;
+			}
+			continue;
+		}
+		if (i > lit) {
+			len += _pxc_literal(frame, lit, i, &out[len]);
+		}
+		out[len++] = op | (uint8_t) (count - 1);
+		if (op == PXC_OP_RUN) {
+			out[len++] = frame[i];
+		} else if (op == PXC_OP_COPY) {
+			out[len++] = (uint8_t) (offset - 1);
+		}
+		i += count;
+		lit = i;
+	}
+	if (i > lit) {
+		len += _pxc_literal(frame, lit, i, &out[len]);
+	}
+	return len;
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * Run-length and delta pixel codec
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _PXCODEC_H
+#define _PXCODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ws2812.h"
+
+// Encoded pixel data is a sequence of ops. Each op starts with a single byte:
+// bits 7..6 select the op, bits 5..0 hold the pixel count minus one (1..64).
+//
+// op       argument          effect
+// LITERAL  count bytes       copies the bytes to the frame buffer
+// RUN      one byte          repeats the byte count times
+// SKIP     none              keeps count pixels of the previous frame
+// COPY     one byte (o)      copies count pixels from o + 1 pixels back
+//
+// A frame without SKIP ops is a key frame, one with SKIP ops is a delta frame
+// against whatever is in the frame buffer. COPY is an LZ style back reference
+// into the current frame, so overlapping copies repeat a pattern.
+// The ops must cover the whole frame buffer exactly.
+#define PXC_OP_LITERAL 0x00
+#define PXC_OP_RUN 0x40
+#define PXC_OP_SKIP 0x80
+#define PXC_OP_COPY 0xc0
+#define PXC_OP_MASK 0xc0
+#define PXC_COUNT_MASK 0x3f
+// maximum number of pixels per op
+#define PXC_MAX_COUNT 64
+// maximum COPY distance
+#define PXC_MAX_OFFSET 256
+
+// Rough decoding cost on AVR, also charged by the virtual display.
+// anim_next() takes PXC_CYCLES_OP per op, pxc_feed() PXC_CYCLES_BYTE per
+// byte. On top of that, each pixel costs PXC_CYCLES_LITERAL, PXC_CYCLES_RUN
+// or PXC_CYCLES_COPY, depending on the op. Skipped pixels are free.
+// pxc_feed() writes literals as part of the byte, so they cost nothing extra.
+#define PXC_CYCLES_OP 15
+#define PXC_CYCLES_BYTE 15
+#define PXC_CYCLES_LITERAL 5
+#define PXC_CYCLES_RUN 2
+#define PXC_CYCLES_COPY 5
+
+// pxc_feed() status codes
+// more data is needed
+#define PXC_MORE 0
+// the frame is complete
+#define PXC_DONE 1
+// the data is invalid, the frame buffer contents are undefined
+#define PXC_ERROR 2
+
+// Streaming decoder state.
+// The decoder writes directly into ws_fb and needs no other memory.
+typedef struct {
+	// next pixel
+	ws_index_t pos;
+	// current op
+	uint8_t op;
+	// pixels left in the current op, 0 if an op byte is expected
+	uint8_t count;
+} pxc_t;
+
+// Prepares the decoder for a new frame.
+static inline void pxc_begin(pxc_t *pxc) {
+	pxc->pos = 0;
+	pxc->op = 0;
+	pxc->count = 0;
+}
+
+// Decodes one byte of encoded pixel data.
+// Returns PXC_MORE, PXC_DONE or PXC_ERROR.
+uint8_t pxc_feed(pxc_t *pxc, uint8_t byte);
+
+#ifndef __AVR_ARCH__
+// Encodes a frame of size pixels (host only).
+// prev = the previous frame for delta encoding, or NULL for a key frame
+// out = output buffer, must hold at least pxc_encode_bound(size) bytes
+// returns the number of bytes written to out
+size_t pxc_encode(const uint8_t *frame, const uint8_t *prev, size_t size, uint8_t *out);
+// worst case encoded size (all literals)
+#define pxc_encode_bound(size) ((size) + ((size) + PXC_MAX_COUNT - 1) / PXC_MAX_COUNT)
+#endif
+
+#endif /*_PXCODEC_H*/
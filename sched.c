@@ -0,0 +1,211 @@
+/*
+ * Cooperative task scheduler
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sched.h"
+
+#if SCHED_PRESCALER == 8
+#define _SCHED_CS 2
+#elif SCHED_PRESCALER == 64
+#define _SCHED_CS 3
+#elif SCHED_PRESCALER == 256
+#define _SCHED_CS 4
+#else
+#define _SCHED_CS 5
+#endif
+
+#ifndef __AVR_ARCH__
+sched_time_t sched_sim_time;
+#endif
+
+// periodic job states: a job was called and hasn't ended yet, and it is
+// past its deadline
+#define _SCHED_PENDING 1
+#define _SCHED_LATE 2
+
+static sched_task_t *sched_tasks[SCHED_MAX_TASKS];
+static uint8_t sched_count;
+static uint32_t sched_idle;
+// end of the last call
+static sched_time_t sched_mark;
+
+void sched_task_init(sched_task_t *task, sched_func_t func, void *data, sched_time_t period, sched_time_t deadline) {
+	PT_INIT(&task->pt);
+	task->func = func;
+	task->data = data;
+	task->period = period;
+	task->deadline = deadline;
+	task->release = 0;
+	task->due = 0;
+	task->state = 0;
+	task->jobs = 0;
+	task->misses = 0;
+	task->worst = 0;
+	task->busy = 0;
+}
+
+void sched_init() {
+#ifdef __AVR_ARCH__
+	// normal mode, running free
+	TCCR1A = 0;
+	TCCR1B = _SCHED_CS;
+#else
+	sched_sim_time = 0;
+#endif
+	sched_count = 0;
+	sched_idle = 0;
+	sched_mark = sched_now();
+}
+
+bool sched_add(sched_task_t *task) {
+	if (sched_count >= SCHED_MAX_TASKS) {
+		return false;
+	}
+	task->release = sched_now();
+	task->due = task->release + task->deadline;
+	task->state = 0;
+	sched_tasks[sched_count++] = task;
+	return true;
+}
+
+// Calls one task and does the accounting.
+// Returns true if it made progress.
+static bool _sched_call(sched_task_t *task) {
+	sched_time_t start = sched_now();
+	// the time between calls is idle time as well
+	sched_idle += (sched_time_t) (start - sched_mark);
+	// an aperiodic task is late if it wasn't polled in time
+	if (!task->period && sched_before(task->due, start)) {
+		task->misses++;
+	}
+	uint8_t status = task->func(task);
+	sched_time_t end = sched_now();
+	sched_time_t elapsed = end - start;
+	sched_mark = end;
+	if (status == PT_WAITING) {
+		sched_idle += elapsed;
+	} else {
+		task->busy += elapsed;
+		if (elapsed > task->worst) {
+			task->worst = elapsed;
+		}
+	}
+	if (task->period) {
+		if (!(task->state & _SCHED_LATE) && sched_before(task->due, end)) {
+			task->misses++;
+			task->state |= _SCHED_LATE;
+		}
+		if (status == PT_ENDED) {
+			task->jobs++;
+			task->release += task->period;
+			// overrun: restart the schedule instead of catching up.
+			// The release of a late job may be too far back to compare.
+			if ((task->state & _SCHED_LATE) || sched_before(task->release, end)) {
+				task->release = end;
+			}
+			task->due = task->release + task->deadline;
+			task->state = 0;
+		} else {
+			// the job stays released until it ends
+			task->state |= _SCHED_PENDING;
+			if (task->state & _SCHED_LATE) {
+				// keep the deadline close to the clock, however long the job
+				// waits, so it stays first in line
+				task->due = end;
+			}
+		}
+	} else {
+		if (status == PT_ENDED) {
+			task->jobs++;
+		}
+		task->due = end + task->deadline;
+	}
+	return status != PT_WAITING;
+}
+
+bool sched_run_round() {
+	bool progress = false;
+	// bit i is set once task i had its turn
+	uint8_t called = 0;
+	while (true) {
+		sched_time_t now = sched_now();
+		// earliest deadline first, among the released tasks
+		sched_task_t *task = NULL;
+		uint8_t index = 0;
+		for (uint8_t i = 0; i < sched_count; i++) {
+			sched_task_t *candidate = sched_tasks[i];
+			if (called & (1 << i)) {
+				continue;
+			}
+			if (candidate->period && !(candidate->state & _SCHED_PENDING) && sched_before(now, candidate->release)) {
+				continue;
+			}
+			if (!task || sched_before(candidate->due, task->due)) {
+				task = candidate;
+				index = i;
+			}
+		}
+		if (!task) {
+			return progress;
+		}
+		called |= 1 << index;
+		if (_sched_call(task)) {
+			progress = true;
+		}
+	}
+}
+
+// Called when no task made progress in a whole round.
+static void _sched_sleep() {
+#ifndef __AVR_ARCH__
+	// jump to the next release, or at least one tick ahead
+	sched_time_t now = sched_now();
+	sched_time_t next = now + 1;
+	bool found = false;
+	for (uint8_t i = 0; i < sched_count; i++) {
+		sched_task_t *task = sched_tasks[i];
+		if (task->period && !(task->state & _SCHED_PENDING) && sched_before(now, task->release) && (!found || sched_before(task->release, next))) {
+			next = task->release;
+			found = true;
+		}
+	}
+	sched_sim_time = next;
+#endif
+}
+
+void sched_run() {
+	while (true) {
+		if (!sched_run_round()) {
+			_sched_sleep();
+		}
+	}
+}
+
+uint32_t sched_get_idle() {
+	return sched_idle;
+}
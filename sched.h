@@ -0,0 +1,169 @@
+/*
+ * Cooperative task scheduler
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SCHED_H
+#define _SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "pt.h"
+
+// Supported configuration variables:
+// SCHED_MAX_TASKS: Maximum number of tasks (up to 8).
+// Each one needs a slot of 2 bytes.
+// Defaults to 4.
+#ifndef SCHED_MAX_TASKS
+#define SCHED_MAX_TASKS 4
+#endif
+#if SCHED_MAX_TASKS > 8
+#error SCHED_MAX_TASKS must be <= 8
+#endif
+// SCHED_PRESCALER: Prescaler of the scheduler clock, one of 8, 64, 256, 1024.
+// The clock is timer 1, running free. Periods and deadlines must be shorter
+// than half a clock cycle, i.e. 32768 ticks.
+// Defaults to 64 (4us ticks, 131ms maximum period at 16MHz).
+#ifndef SCHED_PRESCALER
+#define SCHED_PRESCALER 64
+#endif
+#if SCHED_PRESCALER != 8 && SCHED_PRESCALER != 64 && SCHED_PRESCALER != 256 && SCHED_PRESCALER != 1024
+#error SCHED_PRESCALER must be one of 8, 64, 256, 1024
+#endif
+
+// Non-preemptive earliest deadline first scheduler for protothreads.
+//
+// Each task is a protothread with an optional period:
+// - Periodic tasks are released once per period. A job runs (over as many
+//   calls as it likes) until the protothread returns PT_ENDED, then the task
+//   sleeps until the next release. It misses its deadline if it ends later
+//   than deadline ticks after the release.
+// - Aperiodic tasks (period 0) are always ready and are polled. They usually
+//   wait for an event with PT_WAIT_UNTIL(). Here, the deadline is the longest
+//   acceptable time between two calls, which is counted as a miss if exceeded.
+//
+// The scheduler works in rounds: each released task is called once per
+// round, the one with the earliest deadline first. This way, a task that is
+// waiting for an event can't hold up the others, and a long job that yields
+// lets all other tasks poll in between. Nothing is preempted, so tasks
+// should yield (or wait) at short intervals,
+// but only at points where the shared state is consistent, for example
+// after a complete frame buffer row.
+//
+// If a periodic job ends so late that the next release has already passed,
+// the schedule restarts from the end of the job. Skipping releases like this
+// keeps an overloaded render task from running back to back.
+//
+// A job stays released until it ends, even if it waits for longer than half
+// a clock cycle. Once it is past its deadline, the miss is counted and the
+// deadline moves along with the clock, so it can't wrap around.
+//
+// All storage is static: tasks are owned by the caller, the scheduler only
+// keeps pointers to them.
+
+// Scheduler clock ticks
+typedef uint16_t sched_time_t;
+
+#define SCHED_TICKS_PER_MS ((F_CPU) / (SCHED_PRESCALER) / 1000)
+// Converts milliseconds and microseconds to ticks, for constant expressions
+#define SCHED_MS(ms) ((sched_time_t) ((ms) * SCHED_TICKS_PER_MS))
+#define SCHED_US(us) ((sched_time_t) ((uint32_t) (us) * SCHED_TICKS_PER_MS / 1000))
+
+typedef struct sched_task sched_task_t;
+
+// Task function, returns one of the PT_ values
+typedef uint8_t (*sched_func_t)(sched_task_t *task);
+
+struct sched_task {
+	// protothread state, for use by func
+	pt_t pt;
+	sched_func_t func;
+	// for use by func
+	void *data;
+	// release period (0 = aperiodic) and relative deadline
+	sched_time_t period, deadline;
+	// next release and absolute deadline of the current job
+	sched_time_t release, due;
+	// job state of periodic tasks, used by the scheduler
+	uint8_t state;
+	// run-time accounting:
+	// completed jobs and missed deadlines
+	uint16_t jobs, misses;
+	// longest single call
+	sched_time_t worst;
+	// total time of all calls that made progress
+	uint32_t busy;
+};
+
+// Initializes a task. It is released as soon as it is added.
+void sched_task_init(sched_task_t *task, sched_func_t func, void *data, sched_time_t period, sched_time_t deadline);
+
+// Starts the scheduler clock and removes all tasks.
+void sched_init();
+
+// Adds a task. Returns false if there are already SCHED_MAX_TASKS.
+bool sched_add(sched_task_t *task);
+
+// Calls each released task once, in the order of their deadlines.
+// Returns true if any of them made progress, i.e. didn't return PT_WAITING.
+bool sched_run_round();
+
+// Runs the tasks forever.
+void sched_run();
+
+// Returns the time spent without progress: waiting for a release, or in
+// tasks that returned PT_WAITING.
+uint32_t sched_get_idle();
+
+// true if time a is before time b.
+// Both must be less than 32768 ticks apart.
+static inline bool sched_before(sched_time_t a, sched_time_t b) {
+	return (int16_t) (a - b) < 0;
+}
+
+#ifdef __AVR_ARCH__
+#include <avr/io.h>
+
+// Returns the current time
+static inline sched_time_t sched_now() {
+	return TCNT1;
+}
+#else
+// On the host, the clock is simulated and only moves when it is advanced.
+// sched_run() jumps ahead to the next release when all tasks are waiting,
+// so the tasks run back to back, without any real delays.
+extern sched_time_t sched_sim_time;
+
+static inline sched_time_t sched_now() {
+	return sched_sim_time;
+}
+
+// Advances the simulated clock, e.g. to model the duration of a task.
+static inline void sched_sim_advance(sched_time_t ticks) {
+	sched_sim_time += ticks;
+}
+#endif
+
+#endif /*_SCHED_H*/
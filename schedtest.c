@@ -0,0 +1,216 @@
+/*
+ * Scheduler test program
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Compile with: gcc -Wall -O0 -g -o schedtest -DF_CPU=16000000UL schedtest.c sched.c
+ * To be used on the host system, not a µC.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "sched.h"
+
+// Runs a render, a scan and an i/o task on the simulated clock, once with
+// a render job that fits into the frame period and once with one that
+// doesn't, and prints the accounting of each task.
+// Then runs sched_run() itself with a periodic tick and a job that waits
+// for longer than half a clock cycle.
+
+// frame period
+#define TEST_PERIOD SCHED_MS(20)
+// number of frames per run
+#define TEST_FRAMES 50
+// rows per frame, each one is a yield point
+#define TEST_ROWS 4
+// cost of sending a frame
+#define TEST_SCAN SCHED_MS(1)
+// a byte arrives every TEST_IO_RATE, polling costs TEST_IO_COST
+#define TEST_IO_RATE SCHED_US(500)
+#define TEST_IO_COST SCHED_US(20)
+
+static bool frame_ready;
+static sched_time_t row_cost;
+static uint16_t frames;
+static sched_time_t io_next;
+static uint16_t io_bytes;
+
+static uint8_t render_task(sched_task_t *task) {
+	static uint8_t row;
+	PT_BEGIN(&task->pt);
+	PT_WAIT_WHILE(&task->pt, frame_ready);
+	for (row = 0; row < TEST_ROWS; row++) {
+		sched_sim_advance(row_cost);
+		PT_YIELD(&task->pt);
+	}
+	frame_ready = true;
+	PT_END(&task->pt);
+}
+
+static uint8_t scan_task(sched_task_t *task) {
+	PT_BEGIN(&task->pt);
+	PT_WAIT_UNTIL(&task->pt, frame_ready);
+	sched_sim_advance(TEST_SCAN);
+	frame_ready = false;
+	frames++;
+	PT_END(&task->pt);
+}
+
+static uint8_t io_task(sched_task_t *task) {
+	PT_BEGIN(&task->pt);
+	PT_WAIT_UNTIL(&task->pt, !sched_before(sched_now(), io_next));
+	// everything that arrived since the last call
+	while (!sched_before(sched_now(), io_next)) {
+		io_next += TEST_IO_RATE;
+		io_bytes++;
+	}
+	sched_sim_advance(TEST_IO_COST);
+	PT_END(&task->pt);
+}
+
+static void print_task(const char *name, const sched_task_t *task, uint32_t total) {
+	printf("  %-8s jobs %5u  misses %4u  worst %6.2fms  load %5.1f%%\n", name, task->jobs, task->misses, (double) task->worst / SCHED_TICKS_PER_MS, 100.0 * task->busy / total);
+}
+
+// returns the number of render deadline misses
+static uint16_t run(const char *name, sched_time_t row) {
+	static sched_task_t render, scan, io;
+	row_cost = row;
+	frames = 0;
+	frame_ready = false;
+	io_bytes = 0;
+	sched_init();
+	io_next = sched_now() + TEST_IO_RATE;
+	sched_task_init(&render, render_task, NULL, TEST_PERIOD, TEST_PERIOD);
+	sched_task_init(&scan, scan_task, NULL, 0, TEST_PERIOD);
+	sched_task_init(&io, io_task, NULL, 0, SCHED_MS(3));
+	sched_add(&render);
+	sched_add(&scan);
+	sched_add(&io);
+	
+	// the clock wraps around, so keep a separate total
+	uint32_t total = 0;
+	while (frames < TEST_FRAMES) {
+		sched_time_t before = sched_now();
+		// like sched_run(), but only a short step when nothing is ready,
+		// so the i/o task sees every byte
+		if (!sched_run_round()) {
+			sched_sim_advance(SCHED_US(100));
+		}
+		total += (sched_time_t) (sched_now() - before);
+	}
+	
+	printf("%s: %u frames in %.1fms, %u bytes received\n", name, frames, (double) total / SCHED_TICKS_PER_MS, io_bytes);
+	print_task("render", &render, total);
+	print_task("scan", &scan, total);
+	print_task("io", &io, total);
+	printf("  idle                                                 %5.1f%%\n", 100.0 * sched_get_idle() / total);
+	return render.misses;
+}
+
+// ticks until the test ends, the long job waits for TEST_WAIT of them
+#define TEST_TICKS 20
+#define TEST_WAIT 10
+#define TEST_TICK_COST SCHED_MS(1)
+
+static int errors;
+static sched_task_t tick, wait;
+static sched_time_t tick_start;
+static uint16_t ticks, ticks_late;
+// ticks when the long job ended
+static uint16_t wait_ended;
+
+static void sleep_done() {
+	// all jobs started on their release, so the clock is where the last one ended
+	sched_time_t expect = tick_start + (TEST_TICKS - 1) * TEST_PERIOD + TEST_TICK_COST;
+	printf("sched_run: %u ticks, %u late, long job (%.0fms) ended after %u ticks, %u misses\n",
+		ticks, ticks_late, (double) TEST_WAIT * TEST_PERIOD / SCHED_TICKS_PER_MS, wait_ended, wait.misses);
+	if (ticks_late != 0 || tick.misses != 0) {
+		printf("FAIL: ticks didn't start on their release\n");
+		errors++;
+	}
+	if (sched_now() != expect) {
+		printf("FAIL: clock at %u, expected %u\n", sched_now(), expect);
+		errors++;
+	}
+	if (wait_ended != TEST_WAIT || wait.misses != 1) {
+		printf("FAIL: long job should end after %u ticks with one miss\n", TEST_WAIT);
+		errors++;
+	}
+	if (!errors) {
+		printf("ok\n");
+	}
+	exit(errors ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+static uint8_t tick_task(sched_task_t *task) {
+	PT_BEGIN(&task->pt);
+	if (sched_now() != task->release) {
+		ticks_late++;
+	}
+	sched_sim_advance(TEST_TICK_COST);
+	if (++ticks == TEST_TICKS) {
+		sleep_done();
+	}
+	PT_END(&task->pt);
+}
+
+static uint8_t wait_task(sched_task_t *task) {
+	PT_BEGIN(&task->pt);
+	PT_WAIT_UNTIL(&task->pt, ticks >= TEST_WAIT);
+	if (!wait_ended) {
+		wait_ended = ticks;
+	}
+	PT_END(&task->pt);
+}
+
+// All tasks are periodic, so sched_run() sleeps between the jobs: on the
+// host, it jumps to the next release. The first job of the wait task waits
+// for 200ms, longer than half a clock cycle, but must still be polled in
+// every round. Doesn't return.
+static void run_sleep() {
+	sched_init();
+	sched_task_init(&tick, tick_task, NULL, TEST_PERIOD, TEST_PERIOD);
+	sched_task_init(&wait, wait_task, NULL, TEST_PERIOD, TEST_PERIOD);
+	tick_start = sched_now();
+	sched_add(&tick);
+	sched_add(&wait);
+	sched_run();
+}
+
+int main() {
+	// 4 rows * 3ms + 1ms scan fits into 20ms
+	if (run("fitting", SCHED_MS(3)) != 0) {
+		printf("FAIL: render missed deadlines\n");
+		errors++;
+	}
+	// 4 rows * 6ms doesn't
+	if (run("overloaded", SCHED_MS(6)) < TEST_FRAMES - 1) {
+		printf("FAIL: render should miss every deadline\n");
+		errors++;
+	}
+	run_sleep();
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,231 @@
+/*
+ * Spectrum analysis test program
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Compile with: gcc -Wall -O0 -g -o spectest spectest.c spectrum.c tinymath.c -lm
+ * To be used on the host system, not a µC.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "tinymath.h"
+#include "dsp.h"
+#include "spectrum.h"
+
+// sampling frequency (Hz), same as the ADC at 16MHz
+#define SMP_FREQ 19231
+// samples per Goertzel measurement
+#define SMP_LOG2_GOERTZEL 8
+// FFT size
+#define SMP_LOG2_FFT 7
+// number of bands
+#define SMP_BANDS 8
+// band range (Hz)
+#define SMP_FMIN 100
+#define SMP_FMAX 4800
+
+#define SMP_MAX (1 << SMP_LOG2_GOERTZEL)
+
+// Limits for the checks: a tone on a band frequency (Goertzel) or on a bin
+// (FFT) must read at least SMP_PASS in its band and no more than SMP_STOP_*
+// in any other one. Tones on a bin don't leak into other bins without a
+// window, so the FFT limit is tighter.
+#define SMP_PASS 110
+#define SMP_STOP_GOERTZEL 40
+#define SMP_STOP_FFT 16
+
+// Fills a buffer with one or two tones, each with amplitude / 2 if both are used.
+// The tones are given as oscillator steps, see dsp_osc_step().
+static void tone(int8_t *samples, uint16_t n, uint16_t step1, uint16_t step2, uint8_t amplitude) {
+	dsp_osc_t a, b;
+	dsp_osc_init(&a, step1);
+	dsp_osc_init(&b, step2);
+	for (uint16_t i = 0; i < n; i++) {
+		int16_t x = dsp_osc_sine(&a);
+		if (step2) {
+			x = (x + dsp_osc_sine(&b)) / 2;
+		}
+		samples[i] = (int8_t) (x * amplitude / 126);
+	}
+}
+
+static void print_levels(const char *name, const uint8_t *levels) {
+	printf("  %-10s", name);
+	for (uint8_t b = 0; b < SMP_BANDS; b++) {
+		printf(" %4u", levels[b]);
+	}
+	printf("\n");
+}
+
+// Runs all three methods on the samples
+static void analyse(const int8_t *samples, uint8_t *goertzel, uint8_t *fft, uint8_t *hann) {
+	static spec_goertzel_t bank[SMP_BANDS];
+	static int16_t re[1 << SMP_LOG2_FFT], im[1 << SMP_LOG2_FFT];
+	uint16_t freqs[SMP_BANDS];
+	
+	spec_log_bands(freqs, SMP_BANDS, SMP_FMIN, SMP_FMAX);
+	for (uint8_t b = 0; b < SMP_BANDS; b++) {
+		spec_goertzel_init(&bank[b], freqs[b], SMP_FREQ);
+	}
+	// feed in blocks of 64, like the ADC does
+	for (uint16_t i = 0; i < SMP_MAX; i += 64) {
+		spec_goertzel_block(bank, SMP_BANDS, &samples[i], 64);
+	}
+	spec_goertzel_levels(bank, SMP_BANDS, SMP_LOG2_GOERTZEL, goertzel);
+	
+	spec_fft_load(samples, re, im, SMP_LOG2_FFT, false);
+	spec_fft(re, im, SMP_LOG2_FFT);
+	spec_fft_levels(re, im, SMP_LOG2_FFT, false, SMP_BANDS, fft);
+	
+	spec_fft_load(samples, re, im, SMP_LOG2_FFT, true);
+	spec_fft(re, im, SMP_LOG2_FFT);
+	spec_fft_levels(re, im, SMP_LOG2_FFT, true, SMP_BANDS, hann);
+}
+
+static void show(uint16_t f1, uint16_t f2, uint8_t amplitude, const uint8_t *goertzel, const uint8_t *fft, const uint8_t *hann) {
+	printf("%5uHz %5uHz amplitude %3u\n", f1, f2, amplitude);
+	print_levels("goertzel", goertzel);
+	print_levels("fft", fft);
+	print_levels("fft hann", hann);
+}
+
+// Returns the band with the highest level
+static uint8_t loudest(const uint8_t *levels) {
+	uint8_t best = 0;
+	for (uint8_t b = 1; b < SMP_BANDS; b++) {
+		if (levels[b] > levels[best]) {
+			best = b;
+		}
+	}
+	return best;
+}
+
+// Checks that band reads at least SMP_PASS and all others at most stop
+static bool check_band(const char *name, const uint8_t *levels, uint8_t band, uint8_t stop) {
+	bool ok = levels[band] >= SMP_PASS;
+	for (uint8_t b = 0; b < SMP_BANDS; b++) {
+		if (b != band && levels[b] > stop) {
+			ok = false;
+		}
+	}
+	if (!ok) {
+		printf("  FAIL: %s, band %u\n", name, band);
+	}
+	return ok;
+}
+
+static bool check_silence(const char *name, const uint8_t *levels) {
+	for (uint8_t b = 0; b < SMP_BANDS; b++) {
+		if (levels[b] != 0) {
+			printf("  FAIL: %s, silence reads %u in band %u\n", name, levels[b], b);
+			return false;
+		}
+	}
+	return true;
+}
+
+int main() {
+	bool ok = true;
+	int8_t samples[SMP_MAX];
+	uint8_t goertzel[SMP_BANDS], fft[SMP_BANDS], hann[SMP_BANDS];
+	uint16_t freqs[SMP_BANDS];
+	spec_log_bands(freqs, SMP_BANDS, SMP_FMIN, SMP_FMAX);
+	printf("goertzel bands (Hz):");
+	for (uint8_t b = 0; b < SMP_BANDS; b++) {
+		printf(" %u", freqs[b]);
+	}
+	printf("\n");
+	
+	// sine table accuracy
+	int16_t maxerr = 0;
+	for (uint32_t p = 0; p < 65536; p++) {
+		int16_t err = abs(spec_sin_q15((uint16_t) p) - (int16_t) lrint(sin(p * 2 * M_PI / 65536) * 32767));
+		if (err > maxerr) {
+			maxerr = err;
+		}
+	}
+	printf("spec_sin_q15 max. error: %d\n\n", maxerr);
+	if (maxerr > 4) {
+		printf("  FAIL: spec_sin_q15 error above 4 LSB\n");
+		ok = false;
+	}
+	
+	// a tone on each goertzel band frequency
+	for (uint8_t b = 0; b < SMP_BANDS; b++) {
+		tone(samples, SMP_MAX, dsp_osc_step(freqs[b], SMP_FREQ), 0, 126);
+		analyse(samples, goertzel, fft, hann);
+		show(freqs[b], 0, 126, goertzel, fft, hann);
+		ok = check_band("goertzel", goertzel, b, SMP_STOP_GOERTZEL) && ok;
+	}
+	
+	// a tone on every fft bin, each must land in one band only, and the
+	// bands must follow the bins in order. The hann window spreads a tone
+	// over three bins, so it only has to find it in the same band.
+	printf("\nfft bins:");
+	uint8_t last = 0;
+	for (uint16_t k = 1; k < 1 << (SMP_LOG2_FFT - 1); k++) {
+		tone(samples, SMP_MAX, dsp_osc_step(k, 1 << SMP_LOG2_FFT), 0, 126);
+		analyse(samples, goertzel, fft, hann);
+		uint8_t band = loudest(fft);
+		printf(" %u", band);
+		if (band < last) {
+			printf("\n  FAIL: bin %u is in band %u, below band %u of the previous bin\n", k, band, last);
+			ok = false;
+		}
+		last = band;
+		ok = check_band("fft", fft, band, SMP_STOP_FFT) && ok;
+		if (loudest(hann) != band || hann[band] < SMP_PASS) {
+			printf("\n  FAIL: fft hann, bin %u reads %u in band %u\n", k, hann[band], band);
+			ok = false;
+		}
+	}
+	printf("\n\n");
+	
+	// weak and mixed signals, for information only
+	tone(samples, SMP_MAX, dsp_osc_step(1000, SMP_FREQ), 0, 20);
+	analyse(samples, goertzel, fft, hann);
+	show(1000, 0, 20, goertzel, fft, hann);
+	tone(samples, SMP_MAX, dsp_osc_step(300, SMP_FREQ), dsp_osc_step(3000, SMP_FREQ), 126);
+	analyse(samples, goertzel, fft, hann);
+	show(300, 3000, 126, goertzel, fft, hann);
+	
+	// silence must read 0 everywhere
+	tone(samples, SMP_MAX, 0, 0, 0);
+	analyse(samples, goertzel, fft, hann);
+	show(0, 0, 0, goertzel, fft, hann);
+	ok = check_silence("goertzel", goertzel) && ok;
+	ok = check_silence("fft", fft) && ok;
+	ok = check_silence("fft hann", hann) && ok;
+	
+	printf("\nestimated cycles per block at 16MHz (from the formulas in spectrum.h, not measured):\n");
+	printf("  goertzel, %u bands, 64 samples: ~%lu\n", SMP_BANDS, (unsigned long) SPEC_CYCLES_GOERTZEL(SMP_BANDS, 64));
+	printf("  fft, %u samples: ~%lu\n", 1 << SMP_LOG2_FFT, (unsigned long) SPEC_CYCLES_FFT(1 << SMP_LOG2_FFT, SMP_LOG2_FFT));
+	printf("  one block lasts %lu cycles\n", (unsigned long) (16000000UL * 64 / SMP_FREQ));
+	
+	printf("\n%s\n", ok ? "all checks passed" : "some checks FAILED");
+	return ok ? 0 : 1;
+}
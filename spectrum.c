@@ -0,0 +1,200 @@
+/*
+ * Spectrum analysis
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "spectrum.h"
+#include "tinymath.h"
+#include "tiny_table.h"
+
+static const PROGMEM int16_t spec_sintable[] = SIN_Q15_TABLE_64;
+
+int16_t spec_sin_q15(uint16_t phase) {
+	// position within the quarter wave, mirrored in the second and fourth quadrant
+	uint16_t pos = phase & 0x3fff;
+	if (phase & 0x4000) {
+		pos = 0x4000 - pos;
+	}
+	uint8_t i = pos >> 8;
+	uint8_t f = (uint8_t) pos;
+	int16_t value = (int16_t) pgm_read_word(&spec_sintable[i]);
+	if (f) {
+		int16_t next = (int16_t) pgm_read_word(&spec_sintable[i + 1]);
+		value += (int16_t) (((int32_t) (next - value) * f) >> 8);
+	}
+	return phase & 0x8000 ? -value : value;
+}
+
+void spec_log_bands(uint16_t *freqs, uint8_t nbands, uint16_t fmin, uint16_t fmax) {
+	int16_t lmin = log2_fix16((uint32_t) fmin << 16);
+	int16_t lmax = log2_fix16((uint32_t) fmax << 16);
+	for (uint8_t b = 0; b < nbands; b++) {
+		int16_t l = nbands > 1 ? lmin + (int16_t) ((int32_t) (lmax - lmin) * b / (nbands - 1)) : lmin;
+		freqs[b] = (uint16_t) ((exp2_fix16(l) + 0x8000) >> 16);
+	}
+}
+
+void spec_goertzel_init(spec_goertzel_t *filter, uint16_t freq, uint16_t rate) {
+	uint16_t phase = (uint16_t) (((uint32_t) freq << 16) / rate);
+	// 2 cos(w) in Q14 is cos(w) in Q15
+	filter->coeff = spec_cos_q15(phase);
+	filter->sine = spec_sin_q15(phase) >> 1;
+	filter->s1 = 0;
+	filter->s2 = 0;
+}
+
+// c * s in Q14, for a 32 bit s.
+// Split into two 16x16 multiplications, the state needs no more than 24 bits.
+static inline int32_t _spec_mul_q14(int16_t c, int32_t s) {
+	return ((int32_t) c * (int16_t) (s >> 16) << 2) + (((int32_t) c * (uint16_t) s) >> 14);
+}
+
+void spec_goertzel_block(spec_goertzel_t *bank, uint8_t nbands, const int8_t *samples, uint8_t n) {
+	for (uint8_t b = 0; b < nbands; b++) {
+		spec_goertzel_t *filter = &bank[b];
+		int16_t coeff = filter->coeff;
+		int32_t s1 = filter->s1;
+		int32_t s2 = filter->s2;
+		for (uint8_t i = 0; i < n; i++) {
+			int32_t s0 = samples[i] + _spec_mul_q14(coeff, s1) - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+		filter->s1 = s1;
+		filter->s2 = s2;
+	}
+}
+
+static inline int16_t _spec_clamp16(int32_t value) {
+	if (value > INT16_MAX) {
+		return INT16_MAX;
+	}
+	if (value < -INT16_MAX) {
+		return -INT16_MAX;
+	}
+	return (int16_t) value;
+}
+
+static inline uint8_t _spec_clamp_level(uint16_t value) {
+	return value > 127 ? 127 : (uint8_t) value;
+}
+
+void spec_goertzel_levels(spec_goertzel_t *bank, uint8_t nbands, uint8_t log2n, uint8_t *levels) {
+	for (uint8_t b = 0; b < nbands; b++) {
+		spec_goertzel_t *filter = &bank[b];
+		// the dft term is s1 - s2 * cos(w) + i s2 * sin(w).
+		// the amplitude of a sine is 2 / n times its magnitude.
+		int16_t re = _spec_clamp16((filter->s1 - (_spec_mul_q14(filter->coeff, filter->s2) >> 1)) >> (log2n - 1));
+		int16_t im = _spec_clamp16(_spec_mul_q14(filter->sine, filter->s2) >> (log2n - 1));
+		levels[b] = _spec_clamp_level(sqrt_u32((uint32_t) ((int32_t) re * re) + (uint32_t) ((int32_t) im * im)));
+		filter->s1 = 0;
+		filter->s2 = 0;
+	}
+}
+
+void spec_fft(int16_t *re, int16_t *im, uint8_t log2n) {
+	uint16_t n = 1 << log2n;
+	// bit reversed reordering
+	for (uint16_t i = 1, j = 0; i < n; i++) {
+		uint16_t bit = n >> 1;
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+		j ^= bit;
+		if (i < j) {
+			int16_t t = re[i];
+			re[i] = re[j];
+			re[j] = t;
+			t = im[i];
+			im[i] = im[j];
+			im[j] = t;
+		}
+	}
+	for (uint8_t stage = 1; stage <= log2n; stage++) {
+		uint16_t half = 1 << (stage - 1);
+		// twiddle factor angle step, in 1/65536 turns
+		uint16_t step = 0x8000 >> (stage - 1);
+		for (uint16_t k = 0; k < half; k++) {
+			int16_t wr = spec_cos_q15(k * step);
+			int16_t wi = -spec_sin_q15(k * step);
+			for (uint16_t i = k; i < n; i += 2 * half) {
+				uint16_t j = i + half;
+				int16_t tr = (int16_t) (((int32_t) wr * re[j] - (int32_t) wi * im[j]) >> 15);
+				int16_t ti = (int16_t) (((int32_t) wr * im[j] + (int32_t) wi * re[j]) >> 15);
+				re[j] = (int16_t) (((int32_t) re[i] - tr) >> 1);
+				im[j] = (int16_t) (((int32_t) im[i] - ti) >> 1);
+				re[i] = (int16_t) (((int32_t) re[i] + tr) >> 1);
+				im[i] = (int16_t) (((int32_t) im[i] + ti) >> 1);
+			}
+		}
+	}
+}
+
+void spec_fft_load(const int8_t *samples, int16_t *re, int16_t *im, uint8_t log2n, bool window) {
+	uint16_t n = 1 << log2n;
+	for (uint16_t i = 0; i < n; i++) {
+		int16_t x = (int16_t) samples[i] << 8;
+		if (window) {
+			// hann window: (1 - cos(2 pi i / n)) / 2
+			int16_t w = (32767 - spec_cos_q15(i << (16 - log2n))) >> 1;
+			x = (int16_t) (((int32_t) x * w) >> 15);
+		}
+		re[i] = x;
+		im[i] = 0;
+	}
+}
+
+void spec_fft_levels(const int16_t *re, const int16_t *im, uint8_t log2n, bool window, uint8_t nbands, uint8_t *levels) {
+	uint16_t nbins = 1 << (log2n - 1);
+	// band edges are spaced evenly on a log scale between bin 1 and nbins
+	int16_t lmax = log2_fix16((uint32_t) nbins << 16);
+	uint16_t start = 1;
+	for (uint8_t b = 0; b < nbands; b++) {
+		uint16_t end = (uint16_t) ((exp2_fix16((int16_t) ((int32_t) lmax * (b + 1) / nbands)) + 0x8000) >> 16);
+		// at least one bin per band
+		if (end <= start) {
+			end = start + 1;
+		}
+		if (end > nbins) {
+			end = nbins;
+		}
+		uint16_t peak = 0;
+		for (uint16_t k = start; k < end; k++) {
+			// magnitude estimate: max + 3/8 min, within 7%
+			uint16_t x = abs(re[k]);
+			uint16_t y = abs(im[k]);
+			uint16_t mag = x > y ? x + (y >> 2) + (y >> 3) : y + (x >> 2) + (x >> 3);
+			if (mag > peak) {
+				peak = mag;
+			}
+		}
+		// the bin magnitude is half the amplitude (scaled by 256),
+		// the hann window halves it once more
+		levels[b] = _spec_clamp_level(peak >> (window ? 6 : 7));
+		start = end;
+	}
+}
@@ -0,0 +1,117 @@
+/*
+ * Spectrum analysis
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SPECTRUM_H
+#define _SPECTRUM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsp.h"
+
+// Spectrum estimation for audio-reactive effects.
+//
+// There are two methods:
+// - A bank of Goertzel filters, each one measuring a single frequency.
+//   Needs 8 bytes of RAM per band and nothing else, and the frequencies can
+//   be chosen freely. Cost grows with the number of bands.
+// - A radix-2 FFT over 2^n samples, grouped into bands afterwards.
+//   Needs 4 bytes of RAM per sample, but is cheaper for many bands.
+//
+// Both produce band levels from 0 to 127, which is the amplitude of a sine
+// wave in the (8 bit, signed) input.
+//
+// Estimated analysis cycles per block on a 16MHz ATmega (avr-gcc -Os),
+// n = samples per block, b = bands:
+//
+// Goertzel     b * (n * 45 + 900)              64 samples, 8 bands:   ~30000
+// FFT          n / 2 * log2(n) * 110 + n * 60  64 samples:            ~25000
+//                                              128 samples:           ~57000
+// smoothing    b * 30
+//
+// At 19231Hz and 64 samples per block, this leaves enough time to render
+// and send a frame for every block (300 blocks per second).
+#define SPEC_CYCLES_GOERTZEL(bands, n) ((uint32_t) (bands) * ((n) * 45UL + 900))
+#define SPEC_CYCLES_FFT(n, log2n) ((uint32_t) (n) / 2 * (log2n) * 110 + (uint32_t) (n) * 60)
+
+// Goertzel filter state
+typedef struct {
+	// 2 cos(w) in Q14, sin(w) in Q14
+	int16_t coeff, sine;
+	// filter state
+	int32_t s1, s2;
+} spec_goertzel_t;
+
+// Sine in Q15, phase is 1/65536 of a full turn.
+// Interpolated from a 64 entry quarter wave table, max. error 4 LSB.
+int16_t spec_sin_q15(uint16_t phase);
+
+static inline int16_t spec_cos_q15(uint16_t phase) {
+	return spec_sin_q15(phase + 16384);
+}
+
+// Fills freqs with nbands logarithmically spaced frequencies from fmin to fmax (Hz).
+void spec_log_bands(uint16_t *freqs, uint8_t nbands, uint16_t fmin, uint16_t fmax);
+
+// Sets up a Goertzel filter for frequency freq at sampling rate rate (Hz).
+void spec_goertzel_init(spec_goertzel_t *filter, uint16_t freq, uint16_t rate);
+
+// Runs a block of samples through each filter of a bank.
+// Can be called several times before reading the levels.
+// A filter only responds within about rate / n of its frequency, for n
+// samples in total. The input should have no more than a small DC offset,
+// which shows up in the lowest bands.
+void spec_goertzel_block(spec_goertzel_t *bank, uint8_t nbands, const int8_t *samples, uint8_t n);
+
+// Returns the levels of all filters, for 2^log2n samples fed since the
+// last call, and resets the filters.
+void spec_goertzel_levels(spec_goertzel_t *bank, uint8_t nbands, uint8_t log2n, uint8_t *levels);
+
+// In-place complex FFT over 2^log2n points (log2n = 1..8).
+// Each stage divides by 2 to avoid overflows, so the result is the DFT / n.
+void spec_fft(int16_t *re, int16_t *im, uint8_t log2n);
+
+// Loads 2^log2n real samples for spec_fft(), scaled to 16 bit.
+// With window, a Hann window is applied to reduce leakage between bins.
+void spec_fft_load(const int8_t *samples, int16_t *re, int16_t *im, uint8_t log2n, bool window);
+
+// Groups the bins of a transformed block into nbands bands, using the
+// highest level in each band. The bands are spaced logarithmically between
+// bin 1 and bin n / 2 - 1, so there must be at least nbands bins.
+// window must be the same as for spec_fft_load().
+void spec_fft_levels(const int16_t *re, const int16_t *im, uint8_t log2n, bool window, uint8_t nbands, uint8_t *levels);
+
+// Smooths band levels over time, using fast attack and slow decay.
+// smooth holds the smoothed levels, levels the new ones. The alphas are
+// dsp_iir_lowpass_alpha() coefficients for the rate at which this is called.
+static inline void spec_smooth(uint8_t *smooth, const uint8_t *levels, uint8_t nbands, uint8_t attack, uint8_t decay) {
+	for (uint8_t b = 0; b < nbands; b++) {
+		int8_t current = (int8_t) smooth[b];
+		int8_t target = (int8_t) levels[b];
+		smooth[b] = (uint8_t) dsp_iir_lowpass(current, 0, target, target > current ? attack : decay);
+	}
+}
+
+#endif /*_SPECTRUM_H*/
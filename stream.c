@@ -0,0 +1,155 @@
+/*
+ * Frame streaming protocol
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stream.h"
+
+// receiver states
+#define _STREAM_SYNC 0
+#define _STREAM_TYPE 1
+#define _STREAM_LEN0 2
+#define _STREAM_LEN1 3
+#define _STREAM_PAYLOAD 4
+#define _STREAM_CHECK 5
+
+static uint8_t stream_state;
+static uint8_t stream_type;
+static uint16_t stream_len;
+static uint8_t stream_sum;
+// set if the payload was invalid
+static uint8_t stream_bad;
+// frame decoding state
+static pxc_t stream_pxc;
+// palette decoding state
+static uint8_t stream_pal_index;
+static uint8_t stream_pal_comp;
+static rgb_t stream_pal_color;
+
+void stream_init() {
+	stream_state = _STREAM_SYNC;
+}
+
+static inline void _stream_payload(uint8_t byte) {
+	switch (stream_type) {
+	case STREAM_TYPE_FRAME:
+		if (stream_pxc.pos < _WS_FB_SIZE) {
+			_ws_count_cycles(STREAM_CYCLES_FRAME_BYTE);
+			ws_fb[stream_pxc.pos++] = byte;
+		} else {
+			stream_bad = 1;
+		}
+		break;
+	case STREAM_TYPE_CODED:
+		if (pxc_feed(&stream_pxc, byte) == PXC_ERROR) {
+			stream_bad = 1;
+		}
+		break;
+	case STREAM_TYPE_PALETTE:
+		if (stream_pal_comp == 0xff) {
+			// first byte: start index
+			stream_pal_index = byte;
+			stream_pal_comp = 0;
+			break;
+		}
+		switch (stream_pal_comp++) {
+		case 0:
+			stream_pal_color.r = byte;
+			break;
+		case 1:
+			stream_pal_color.g = byte;
+			break;
+		case 2:
+			stream_pal_color.b = byte;
+#if PAL_MODE == PAL_MODE_RAM
+			pal_set(stream_pal_index, stream_pal_color);
+#endif
+			stream_pal_index++;
+			stream_pal_comp = 0;
+			break;
+		}
+		break;
+	default:
+		stream_bad = 1;
+		break;
+	}
+}
+
+// checks if the payload was complete
+static inline uint8_t _stream_complete() {
+	switch (stream_type) {
+	case STREAM_TYPE_FRAME:
+		return stream_pxc.pos == _WS_FB_SIZE ? STREAM_SHOW : STREAM_ERROR;
+	case STREAM_TYPE_CODED:
+		return (stream_pxc.count == 0 && stream_pxc.pos == _WS_FB_SIZE) ? STREAM_SHOW : STREAM_ERROR;
+	case STREAM_TYPE_PALETTE:
+		return stream_pal_comp == 0 ? STREAM_DONE : STREAM_ERROR;
+	}
+	return STREAM_ERROR;
+}
+
+uint8_t stream_feed(uint8_t byte) {
+	switch (stream_state) {
+	case _STREAM_SYNC:
+		if (byte == STREAM_SYNC) {
+			stream_state = _STREAM_TYPE;
+		}
+		break;
+	case _STREAM_TYPE:
+		stream_type = byte;
+		stream_sum = byte;
+		stream_bad = 0;
+		pxc_begin(&stream_pxc);
+		stream_pal_comp = 0xff;
+		stream_state = _STREAM_LEN0;
+		break;
+	case _STREAM_LEN0:
+		stream_len = byte;
+		stream_sum += byte;
+		stream_state = _STREAM_LEN1;
+		break;
+	case _STREAM_LEN1:
+		stream_len |= (uint16_t) byte << 8;
+		stream_sum += byte;
+		stream_state = stream_len ? _STREAM_PAYLOAD : _STREAM_CHECK;
+		break;
+	case _STREAM_PAYLOAD:
+		stream_sum += byte;
+		if (!stream_bad) {
+			_stream_payload(byte);
+		}
+		if (--stream_len == 0) {
+			stream_state = _STREAM_CHECK;
+		}
+		break;
+	case _STREAM_CHECK:
+		stream_state = _STREAM_SYNC;
+		stream_sum += byte;
+		if (stream_sum != 0 || stream_bad) {
+			return STREAM_ERROR;
+		}
+		return _stream_complete();
+	}
+	return STREAM_NONE;
+}
@@ -0,0 +1,82 @@
+/*
+ * Frame streaming protocol
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _STREAM_H
+#define _STREAM_H
+
+#include <stdint.h>
+#include "ws2812.h"
+#include "pxcodec.h"
+
+// Packet format:
+// sync (1 byte), type (1 byte), payload length (2 bytes, little endian),
+// payload, checksum (1 byte)
+// The checksum is chosen so that the 8 bit sum of type, length, payload
+// and checksum is zero.
+//
+// Payloads:
+// STREAM_TYPE_FRAME: one palette index per pixel, the whole frame buffer
+// STREAM_TYPE_CODED: pxcodec ops covering the whole frame buffer,
+// either a run-length coded key frame or a delta frame
+// STREAM_TYPE_PALETTE: first palette index, followed by r, g, b triples.
+// Ignored unless the palette is in RAM.
+//
+// Frame data is decoded directly into ws_fb as it arrives, so a corrupted
+// packet leaves a partially updated frame buffer behind. The receiver
+// answers with STREAM_NAK, and the sender should follow up with a key frame.
+//
+// Flow control: ws_scan_fb() runs with interrupts disabled, which would
+// drop incoming bytes. The receiver sends STREAM_ACK whenever it is ready
+// for the next packet, and the sender must wait for it before sending.
+#define STREAM_SYNC 0xa5
+#define STREAM_TYPE_FRAME 'F'
+#define STREAM_TYPE_CODED 'C'
+#define STREAM_TYPE_PALETTE 'P'
+#define STREAM_ACK 0x06
+#define STREAM_NAK 0x15
+
+// stream_feed() status codes
+// nothing to do
+#define STREAM_NONE 0
+// a complete frame was received and should be displayed
+#define STREAM_SHOW 1
+// a packet was received that needs no display update
+#define STREAM_DONE 2
+// the packet was invalid
+#define STREAM_ERROR 3
+
+// Rough cost on AVR of storing a byte of a raw frame, also charged by the
+// virtual display. Coded frames cost what pxc_feed() does.
+#define STREAM_CYCLES_FRAME_BYTE 10
+
+// Resets the receiver state.
+void stream_init();
+
+// Processes one received byte.
+// Returns one of the STREAM_ status codes.
+uint8_t stream_feed(uint8_t byte);
+
+#endif /*_STREAM_H*/
@@ -2,7 +2,7 @@
  * Noise generator test program
  * Copyright 2017 Gregor Riepl <onitake@gmail.com>
  *
- * Compile with: gcc -Wall -O0 -g -o synth2 $(pkg-config --cflags --libs libpulse-simple) synth2.c lfsr.c tinymath.c
+ * Compile with: gcc -Wall -O0 -g -o synth2 $(pkg-config --cflags --libs libpulse-simple) synth2.c lfsr.c tinymath.c dsp.c
  * To be used on the host system, not a µC.
  *
  * Redistribution and use in source and binary forms, with or without modification, 
@@ -40,8 +40,9 @@
 
 // sampling frequency (Hz)
 #define SMP_FREQ 44100
-// time base (1/f)
-#define SMP_DT dsp_sample_period(SMP_FREQ)
+#if DSP_SAMPLE_RATE != SMP_FREQ
+#error DSP_SAMPLE_RATE must match SMP_FREQ
+#endif
 // number of sample to average (for gaussian distribution)
 #define SMP_GAUSS 4
 // sample volume (0..255)
@@ -85,11 +86,10 @@ int main(int argc, char **argv) {
 		NULL                // Ignore error code.
 	);
 	
-	uint16_t fc = 0;
+	// corner frequency sweep target and smoothed value (log frequency)
+	uint16_t lf_target = 0, lf = 0;
 	while (1) {
-		uint8_t alpha_low = dsp_iir_lowpass_alpha(fc, SMP_DT);
-		uint8_t alpha_high = dsp_iir_highpass_alpha(fc, SMP_DT);
-		printf("fc = %uHz alpha_low = %u alpha_high = %u\n", fc, alpha_low, alpha_high);
+		printf("fc = %.0fHz\n", IIR_ALPHA_FMIN * pow(2.0, lf_target / 256.0 / IIR_ALPHA_STEPS));
 		int8_t y1 = 0, x1 = 0;
 		int8_t min = 127, max = -128;
 		for (size_t i = 0; i < SMP_BUFFER; i++) {
@@ -98,6 +98,11 @@ int main(int argc, char **argv) {
 			// volume scaling
 			int8_t x0 = dsp_sample_scale(r, SMP_VOLUME);
 			
+			// glide towards the target frequency, coefficients are updated per sample
+			lf = dsp_smooth(lf, lf_target, 8);
+			uint8_t alpha_low = dsp_iir_lowpass_alpha_lf(lf);
+// 			uint8_t alpha_high = dsp_iir_highpass_alpha_lf(lf);
+			
 			// filter depending on last input, last output and current input values
 			int8_t y0 = dsp_iir_lowpass(y1, x1, x0, alpha_low);
 // 			int8_t y0 = dsp_iir_highpass(y1, x1, x0, alpha_high);
@@ -113,9 +118,8 @@ int main(int argc, char **argv) {
 			y1 = y0;
 		}
 		printf("min = %d max = %d\n", min, max);
-		// frequency step (30Hz)
-// 		fc = (fc + 50) % 10000;
-		fc = (fc + 1000) % 20000;
+		// frequency step (one octave, 10 octaves from 20Hz)
+		lf_target = (lf_target + IIR_ALPHA_STEPS * 256) % (IIR_ALPHA_STEPS * 256 * 10);
 		// send for playback
 		pa_simple_write(
 			s,
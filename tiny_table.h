@@ -10,3 +10,19 @@
 #define SIN_TABLE_4096 {0,2,3,5,6,8,9,11,13,14,16,17,19,20,22,24,25,27,28,30,31,33,35,36,38,39,41,42,44,46,47,49,50,52,53,55,57,58,60,61,63,64,66,68,69,71,72,74,75,77,79,80,82,83,85,86,88,90,91,93,94,96,97,99,100,102,104,105,107,108,110,111,113,115,116,118,119,121,122,124,126,127,129,130,132,133,135,137,138,140,141,143,144,146,148,149,151,152,154,155,157,159,160,162,163,165,166,168,170,171,173,174,176,177,179,181,182,184,185,187,188,190,192,193,195,196,198,199,201,203,204,206,207,209,210,212,213,215,217,218,220,221,223,224,226,228,229,231,232,234,235,237,239,240,242,243,245,246,248,250,251,253,254,256,257,259,261,262,264,265,267,268,270,271,273,275,276,278,279,281,282,284,286,287,289,290,292,293,295,297,298,300,301,303,304,306,308,309,311,312,314,315,317,318,320,322,323,325,326,328,329,331,333,334,336,337,339,340,342,344,345,347,348,350,351,353,354,356,358,359,361,362,364,365,367,369,370,372,373,375,376,378,379,381,383,384,386,387,389,390,392,394,395,397,398,400,401,403,405,406,408,409,411,412,414,415,417,419,420,422,423,425,426,428,430,431,433,434,436,437,439,440,442,444,445,447,448,450,451,453,454,456,458,459,461,462,464,465,467,469,470,472,473,475,476,478,479,481,483,484,486,487,489,490,492,493,495,497,498,500,501,503,504,506,508,509,511,512,514,515,517,518,520,522,523,525,526,528,529,531,532,534,536,537,539,540,542,543,545,546,548,550,551,553,554,556,557,559,560,562,564,565,567,568,570,571,573,574,576,578,579,581,582,584,585,587,588,590,592,593,595,596,598,599,601,602,604,606,607,609,610,612,613,615,616,618,619,621,623,624,626,627,629,630,632,633,635,637,638,640,641,643,644,646,647,649,651,652,654,655,657,658,660,661,663,664,666,668,669,671,672,674,675,677,678,680,682,683,685,686,688,689,691,692,694,695,697,699,700,702,703,705,706,708,709,711,712,714,716,717,719,720,722,723,725,726,728,729,731,733,734,736,737,739,740,742,743,745,746,748,750,751,753,754,756,757,759,760,762,763,765,767,768,770,771,773,774,776,777,779,780,782,783,785,787,788,790,791,793,794,796,797,799,800,802,804,805,807,808,810,811,813,814,816,817,819,820,822,824,825,827,828,830,831,833,834,836,837,839,840,842,844,845,847,848,850,851,853,854,856,857,859,860,862,863,865,867,868,870,871,873,874,876,877,879,880,882,883,885,886,888,890,891,893,894,896,897,899,900,902,903,905,906,908,909,911,913,914,916,917,919,920,922,923,925,926,928,929,931,932,934,935,937,939,940,942,943,945,946,948,949,951,952,954,955,957,958,960,961,963,965,966,968,969,971,972,974,975,977,978,980,981,983,984,986,987,989,990,992,993,995,997,998,1000,1001,1003,1004,1006,1007,1009,1010,1012,1013,1015,1016,1018,1019,1021,1022,1024,1025,1027,1028,1030,1032,1033,1035,1036,1038,1039,1041,1042,1044,1045,1047,1048,1050,1051,1053,1054,1056,1057,1059,1060,1062,1063,1065,1066,1068,1069,1071,1072,1074,1076,1077,1079,1080,1082,1083,1085,1086,1088,1089,1091,1092,1094,1095,1097,1098,1100,1101,1103,1104,1106,1107,1109,1110,1112,1113,1115,1116,1118,1119,1121,1122,1124,1125,1127,1128,1130,1131,1133,1135,1136,1138,1139,1141,1142,1144,1145,1147,1148,1150,1151,1153,1154,1156,1157,1159,1160,1162,1163,1165,1166,1168,1169,1171,1172,1174,1175,1177,1178,1180,1181,1183,1184,1186,1187,1189,1190,1192,1193,1195,1196,1198,1199,1201,1202,1204,1205,1207,1208,1210,1211,1213,1214,1216,1217,1219,1220,1222,1223,1225,1226,1228,1229,1231,1232,1234,1235,1237,1238,1240,1241,1243,1244,1246,1247,1249,1250,1252,1253,1255,1256,1258,1259,1261,1262,1264,1265,1267,1268,1270,1271,1273,1274,1276,1277,1279,1280,1282,1283,1285,1286,1288,1289,1290,1292,1293,1295,1296,1298,1299,1301,1302,1304,1305,1307,1308,1310,1311,1313,1314,1316,1317,1319,1320,1322,1323,1325,1326,1328,1329,1331,1332,1334,1335,1337,1338,1340,1341,1343,1344,1346,1347,1348,1350,1351,1353,1354,1356,1357,1359,1360,1362,1363,1365,1366,1368,1369,1371,1372,1374,1375,1377,1378,1380,1381,1383,1384,1385,1387,1388,1390,1391,1393,1394,1396,1397,1399,1400,1402,1403,1405,1406,1408,1409,1411,1412,1414,1415,1416,1418,1419,1421,1422,1424,1425,1427,1428,1430,1431,1433,1434,1436,1437,1439,1440,1441,1443,1444,1446,1447,1449,1450,1452,1453,1455,1456,1458,1459,1461,1462,1464,1465,1466,1468,1469,1471,1472,1474,1475,1477,1478,1480,1481,1483,1484,1485,1487,1488,1490,1491,1493,1494,1496,1497,1499,1500,1502,1503,1504,1506,1507,1509,1510,1512,1513,1515,1516,1518,1519,1521,1522,1523,1525,1526,1528,1529,1531,1532,1534,1535,1537,1538,1539,1541,1542,1544,1545,1547,1548,1550,1551,1553,1554,1555,1557,1558,1560,1561,1563,1564,1566,1567,1569,1570,1571,1573,1574,1576,1577,1579,1580,1582,1583,1584,1586,1587,1589,1590,1592,1593,1595,1596,1598,1599,1600,1602,1603,1605,1606,1608,1609,1611,1612,1613,1615,1616,1618,1619,1621,1622,1623,1625,1626,1628,1629,1631,1632,1634,1635,1636,1638,1639,1641,1642,1644,1645,1647,1648,1649,1651,1652,1654,1655,1657,1658,1659,1661,1662,1664,1665,1667,1668,1670,1671,1672,1674,1675,1677,1678,1680,1681,1682,1684,1685,1687,1688,1690,1691,1692,1694,1695,1697,1698,1700,1701,1702,1704,1705,1707,1708,1710,1711,1712,1714,1715,1717,1718,1720,1721,1722,1724,1725,1727,1728,1730,1731,1732,1734,1735,1737,1738,1739,1741,1742,1744,1745,1747,1748,1749,1751,1752,1754,1755,1757,1758,1759,1761,1762,1764,1765,1766,1768,1769,1771,1772,1774,1775,1776,1778,1779,1781,1782,1783,1785,1786,1788,1789,1790,1792,1793,1795,1796,1798,1799,1800,1802,1803,1805,1806,1807,1809,1810,1812,1813,1814,1816,1817,1819,1820,1821,1823,1824,1826,1827,1829,1830,1831,1833,1834,1836,1837,1838,1840,1841,1843,1844,1845,1847,1848,1850,1851,1852,1854,1855,1857,1858,1859,1861,1862,1864,1865,1866,1868,1869,1871,1872,1873,1875,1876,1878,1879,1880,1882,1883,1885,1886,1887,1889,1890,1891,1893,1894,1896,1897,1898,1900,1901,1903,1904,1905,1907,1908,1910,1911,1912,1914,1915,1917,1918,1919,1921,1922,1923,1925,1926,1928,1929,1930,1932,1933,1935,1936,1937,1939,1940,1941,1943,1944,1946,1947,1948,1950,1951,1952,1954,1955,1957,1958,1959,1961,1962,1964,1965,1966,1968,1969,1970,1972,1973,1975,1976,1977,1979,1980,1981,1983,1984,1986,1987,1988,1990,1991,1992,1994,1995,1997,1998,1999,2001,2002,2003,2005,2006,2007,2009,2010,2012,2013,2014,2016,2017,2018,2020,2021,2023,2024,2025,2027,2028,2029,2031,2032,2033,2035,2036,2038,2039,2040,2042,2043,2044,2046,2047,2048,2050,2051,2052,2054,2055,2057,2058,2059,2061,2062,2063,2065,2066,2067,2069,2070,2071,2073,2074,2076,2077,2078,2080,2081,2082,2084,2085,2086,2088,2089,2090,2092,2093,2094,2096,2097,2099,2100,2101,2103,2104,2105,2107,2108,2109,2111,2112,2113,2115,2116,2117,2119,2120,2121,2123,2124,2125,2127,2128,2129,2131,2132,2133,2135,2136,2137,2139,2140,2142,2143,2144,2146,2147,2148,2150,2151,2152,2154,2155,2156,2158,2159,2160,2162,2163,2164,2166,2167,2168,2170,2171,2172,2174,2175,2176,2178,2179,2180,2182,2183,2184,2186,2187,2188,2189,2191,2192,2193,2195,2196,2197,2199,2200,2201,2203,2204,2205,2207,2208,2209,2211,2212,2213,2215,2216,2217,2219,2220,2221,2223,2224,2225,2227,2228,2229,2230,2232,2233,2234,2236,2237,2238,2240,2241,2242,2244,2245,2246,2248,2249,2250,2252,2253,2254,2255,2257,2258,2259,2261,2262,2263,2265,2266,2267,2269,2270,2271,2272,2274,2275,2276,2278,2279,2280,2282,2283,2284,2285,2287,2288,2289,2291,2292,2293,2295,2296,2297,2299,2300,2301,2302,2304,2305,2306,2308,2309,2310,2311,2313,2314,2315,2317,2318,2319,2321,2322,2323,2324,2326,2327,2328,2330,2331,2332,2333,2335,2336,2337,2339,2340,2341,2343,2344,2345,2346,2348,2349,2350,2352,2353,2354,2355,2357,2358,2359,2361,2362,2363,2364,2366,2367,2368,2369,2371,2372,2373,2375,2376,2377,2378,2380,2381,2382,2384,2385,2386,2387,2389,2390,2391,2392,2394,2395,2396,2398,2399,2400,2401,2403,2404,2405,2406,2408,2409,2410,2412,2413,2414,2415,2417,2418,2419,2420,2422,2423,2424,2425,2427,2428,2429,2431,2432,2433,2434,2436,2437,2438,2439,2441,2442,2443,2444,2446,2447,2448,2449,2451,2452,2453,2454,2456,2457,2458,2460,2461,2462,2463,2465,2466,2467,2468,2470,2471,2472,2473,2475,2476,2477,2478,2480,2481,2482,2483,2485,2486,2487,2488,2490,2491,2492,2493,2495,2496,2497,2498,2500,2501,2502,2503,2504,2506,2507,2508,2509,2511,2512,2513,2514,2516,2517,2518,2519,2521,2522,2523,2524,2526,2527,2528,2529,2531,2532,2533,2534,2535,2537,2538,2539,2540,2542,2543,2544,2545,2547,2548,2549,2550,2551,2553,2554,2555,2556,2558,2559,2560,2561,2562,2564,2565,2566,2567,2569,2570,2571,2572,2573,2575,2576,2577,2578,2580,2581,2582,2583,2584,2586,2587,2588,2589,2591,2592,2593,2594,2595,2597,2598,2599,2600,2601,2603,2604,2605,2606,2608,2609,2610,2611,2612,2614,2615,2616,2617,2618,2620,2621,2622,2623,2624,2626,2627,2628,2629,2630,2632,2633,2634,2635,2636,2638,2639,2640,2641,2642,2644,2645,2646,2647,2648,2650,2651,2652,2653,2654,2656,2657,2658,2659,2660,2662,2663,2664,2665,2666,2668,2669,2670,2671,2672,2674,2675,2676,2677,2678,2679,2681,2682,2683,2684,2685,2687,2688,2689,2690,2691,2693,2694,2695,2696,2697,2698,2700,2701,2702,2703,2704,2706,2707,2708,2709,2710,2711,2713,2714,2715,2716,2717,2718,2720,2721,2722,2723,2724,2726,2727,2728,2729,2730,2731,2733,2734,2735,2736,2737,2738,2740,2741,2742,2743,2744,2745,2747,2748,2749,2750,2751,2752,2754,2755,2756,2757,2758,2759,2760,2762,2763,2764,2765,2766,2767,2769,2770,2771,2772,2773,2774,2776,2777,2778,2779,2780,2781,2782,2784,2785,2786,2787,2788,2789,2791,2792,2793,2794,2795,2796,2797,2799,2800,2801,2802,2803,2804,2805,2807,2808,2809,2810,2811,2812,2813,2815,2816,2817,2818,2819,2820,2821,2823,2824,2825,2826,2827,2828,2829,2830,2832,2833,2834,2835,2836,2837,2838,2840,2841,2842,2843,2844,2845,2846,2847,2849,2850,2851,2852,2853,2854,2855,2856,2858,2859,2860,2861,2862,2863,2864,2865,2867,2868,2869,2870,2871,2872,2873,2874,2876,2877,2878,2879,2880,2881,2882,2883,2884,2886,2887,2888,2889,2890,2891,2892,2893,2894,2896,2897,2898,2899,2900,2901,2902,2903,2904,2906,2907,2908,2909,2910,2911,2912,2913,2914,2916,2917,2918,2919,2920,2921,2922,2923,2924,2925,2927,2928,2929,2930,2931,2932,2933,2934,2935,2936,2937,2939,2940,2941,2942,2943,2944,2945,2946,2947,2948,2949,2951,2952,2953,2954,2955,2956,2957,2958,2959,2960,2961,2963,2964,2965,2966,2967,2968,2969,2970,2971,2972,2973,2974,2976,2977,2978,2979,2980,2981,2982,2983,2984,2985,2986,2987,2988,2990,2991,2992,2993,2994,2995,2996,2997,2998,2999,3000,3001,3002,3003,3004,3006,3007,3008,3009,3010,3011,3012,3013,3014,3015,3016,3017,3018,3019,3020,3022,3023,3024,3025,3026,3027,3028,3029,3030,3031,3032,3033,3034,3035,3036,3037,3038,3039,3041,3042,3043,3044,3045,3046,3047,3048,3049,3050,3051,3052,3053,3054,3055,3056,3057,3058,3059,3060,3061,3063,3064,3065,3066,3067,3068,3069,3070,3071,3072,3073,3074,3075,3076,3077,3078,3079,3080,3081,3082,3083,3084,3085,3086,3087,3088,3089,3090,3092,3093,3094,3095,3096,3097,3098,3099,3100,3101,3102,3103,3104,3105,3106,3107,3108,3109,3110,3111,3112,3113,3114,3115,3116,3117,3118,3119,3120,3121,3122,3123,3124,3125,3126,3127,3128,3129,3130,3131,3132,3133,3134,3135,3136,3137,3138,3139,3140,3141,3142,3143,3144,3145,3146,3147,3148,3149,3150,3151,3152,3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,3163,3164,3165,3166,3167,3168,3169,3170,3171,3172,3173,3174,3175,3176,3177,3178,3179,3180,3181,3182,3183,3184,3185,3186,3187,3188,3189,3190,3191,3192,3193,3194,3195,3196,3197,3198,3199,3200,3201,3202,3203,3204,3205,3206,3207,3208,3209,3210,3211,3212,3213,3214,3215,3216,3217,3218,3219,3220,3221,3222,3222,3223,3224,3225,3226,3227,3228,3229,3230,3231,3232,3233,3234,3235,3236,3237,3238,3239,3240,3241,3242,3243,3244,3245,3246,3247,3248,3248,3249,3250,3251,3252,3253,3254,3255,3256,3257,3258,3259,3260,3261,3262,3263,3264,3265,3266,3267,3267,3268,3269,3270,3271,3272,3273,3274,3275,3276,3277,3278,3279,3280,3281,3282,3283,3284,3284,3285,3286,3287,3288,3289,3290,3291,3292,3293,3294,3295,3296,3297,3298,3298,3299,3300,3301,3302,3303,3304,3305,3306,3307,3308,3309,3310,3311,3311,3312,3313,3314,3315,3316,3317,3318,3319,3320,3321,3322,3322,3323,3324,3325,3326,3327,3328,3329,3330,3331,3332,3333,3333,3334,3335,3336,3337,3338,3339,3340,3341,3342,3343,3343,3344,3345,3346,3347,3348,3349,3350,3351,3352,3353,3353,3354,3355,3356,3357,3358,3359,3360,3361,3362,3362,3363,3364,3365,3366,3367,3368,3369,3370,3370,3371,3372,3373,3374,3375,3376,3377,3378,3378,3379,3380,3381,3382,3383,3384,3385,3386,3386,3387,3388,3389,3390,3391,3392,3393,3393,3394,3395,3396,3397,3398,3399,3400,3400,3401,3402,3403,3404,3405,3406,3407,3407,3408,3409,3410,3411,3412,3413,3414,3414,3415,3416,3417,3418,3419,3420,3420,3421,3422,3423,3424,3425,3426,3427,3427,3428,3429,3430,3431,3432,3433,3433,3434,3435,3436,3437,3438,3439,3439,3440,3441,3442,3443,3444,3444,3445,3446,3447,3448,3449,3450,3450,3451,3452,3453,3454,3455,3455,3456,3457,3458,3459,3460,3461,3461,3462,3463,3464,3465,3466,3466,3467,3468,3469,3470,3471,3471,3472,3473,3474,3475,3476,3476,3477,3478,3479,3480,3481,3481,3482,3483,3484,3485,3485,3486,3487,3488,3489,3490,3490,3491,3492,3493,3494,3495,3495,3496,3497,3498,3499,3499,3500,3501,3502,3503,3503,3504,3505,3506,3507,3508,3508,3509,3510,3511,3512,3512,3513,3514,3515,3516,3516,3517,3518,3519,3520,3520,3521,3522,3523,3524,3524,3525,3526,3527,3528,3528,3529,3530,3531,3532,3532,3533,3534,3535,3536,3536,3537,3538,3539,3540,3540,3541,3542,3543,3543,3544,3545,3546,3547,3547,3548,3549,3550,3551,3551,3552,3553,3554,3554,3555,3556,3557,3558,3558,3559,3560,3561,3561,3562,3563,3564,3565,3565,3566,3567,3568,3568,3569,3570,3571,3571,3572,3573,3574,3575,3575,3576,3577,3578,3578,3579,3580,3581,3581,3582,3583,3584,3584,3585,3586,3587,3588,3588,3589,3590,3591,3591,3592,3593,3594,3594,3595,3596,3597,3597,3598,3599,3600,3600,3601,3602,3603,3603,3604,3605,3606,3606,3607,3608,3609,3609,3610,3611,3611,3612,3613,3614,3614,3615,3616,3617,3617,3618,3619,3620,3620,3621,3622,3623,3623,3624,3625,3625,3626,3627,3628,3628,3629,3630,3631,3631,3632,3633,3633,3634,3635,3636,3636,3637,3638,3638,3639,3640,3641,3641,3642,3643,3644,3644,3645,3646,3646,3647,3648,3649,3649,3650,3651,3651,3652,3653,3654,3654,3655,3656,3656,3657,3658,3658,3659,3660,3661,3661,3662,3663,3663,3664,3665,3665,3666,3667,3668,3668,3669,3670,3670,3671,3672,3672,3673,3674,3675,3675,3676,3677,3677,3678,3679,3679,3680,3681,3681,3682,3683,3684,3684,3685,3686,3686,3687,3688,3688,3689,3690,3690,3691,3692,3692,3693,3694,3694,3695,3696,3696,3697,3698,3698,3699,3700,3700,3701,3702,3703,3703,3704,3705,3705,3706,3707,3707,3708,3709,3709,3710,3711,3711,3712,3713,3713,3714,3714,3715,3716,3716,3717,3718,3718,3719,3720,3720,3721,3722,3722,3723,3724,3724,3725,3726,3726,3727,3728,3728,3729,3730,3730,3731,3731,3732,3733,3733,3734,3735,3735,3736,3737,3737,3738,3739,3739,3740,3741,3741,3742,3742,3743,3744,3744,3745,3746,3746,3747,3747,3748,3749,3749,3750,3751,3751,3752,3753,3753,3754,3754,3755,3756,3756,3757,3758,3758,3759,3759,3760,3761,3761,3762,3763,3763,3764,3764,3765,3766,3766,3767,3767,3768,3769,3769,3770,3771,3771,3772,3772,3773,3774,3774,3775,3775,3776,3777,3777,3778,3778,3779,3780,3780,3781,3781,3782,3783,3783,3784,3784,3785,3786,3786,3787,3787,3788,3789,3789,3790,3790,3791,3792,3792,3793,3793,3794,3795,3795,3796,3796,3797,3798,3798,3799,3799,3800,3800,3801,3802,3802,3803,3803,3804,3805,3805,3806,3806,3807,3807,3808,3809,3809,3810,3810,3811,3811,3812,3813,3813,3814,3814,3815,3815,3816,3817,3817,3818,3818,3819,3819,3820,3821,3821,3822,3822,3823,3823,3824,3825,3825,3826,3826,3827,3827,3828,3828,3829,3830,3830,3831,3831,3832,3832,3833,3833,3834,3835,3835,3836,3836,3837,3837,3838,3838,3839,3839,3840,3841,3841,3842,3842,3843,3843,3844,3844,3845,3845,3846,3847,3847,3848,3848,3849,3849,3850,3850,3851,3851,3852,3852,3853,3854,3854,3855,3855,3856,3856,3857,3857,3858,3858,3859,3859,3860,3860,3861,3861,3862,3862,3863,3863,3864,3865,3865,3866,3866,3867,3867,3868,3868,3869,3869,3870,3870,3871,3871,3872,3872,3873,3873,3874,3874,3875,3875,3876,3876,3877,3877,3878,3878,3879,3879,3880,3880,3881,3881,3882,3882,3883,3883,3884,3884,3885,3885,3886,3886,3887,3887,3888,3888,3889,3889,3890,3890,3891,3891,3892,3892,3893,3893,3894,3894,3895,3895,3896,3896,3897,3897,3898,3898,3899,3899,3899,3900,3900,3901,3901,3902,3902,3903,3903,3904,3904,3905,3905,3906,3906,3907,3907,3908,3908,3909,3909,3909,3910,3910,3911,3911,3912,3912,3913,3913,3914,3914,3915,3915,3915,3916,3916,3917,3917,3918,3918,3919,3919,3920,3920,3920,3921,3921,3922,3922,3923,3923,3924,3924,3925,3925,3925,3926,3926,3927,3927,3928,3928,3929,3929,3929,3930,3930,3931,3931,3932,3932,3933,3933,3933,3934,3934,3935,3935,3936,3936,3936,3937,3937,3938,3938,3939,3939,3939,3940,3940,3941,3941,3942,3942,3942,3943,3943,3944,3944,3945,3945,3945,3946,3946,3947,3947,3947,3948,3948,3949,3949,3950,3950,3950,3951,3951,3952,3952,3952,3953,3953,3954,3954,3955,3955,3955,3956,3956,3957,3957,3957,3958,3958,3959,3959,3959,3960,3960,3961,3961,3961,3962,3962,3963,3963,3963,3964,3964,3965,3965,3965,3966,3966,3966,3967,3967,3968,3968,3968,3969,3969,3970,3970,3970,3971,3971,3972,3972,3972,3973,3973,3973,3974,3974,3975,3975,3975,3976,3976,3976,3977,3977,3978,3978,3978,3979,3979,3979,3980,3980,3981,3981,3981,3982,3982,3982,3983,3983,3983,3984,3984,3985,3985,3985,3986,3986,3986,3987,3987,3987,3988,3988,3989,3989,3989,3990,3990,3990,3991,3991,3991,3992,3992,3992,3993,3993,3993,3994,3994,3994,3995,3995,3996,3996,3996,3997,3997,3997,3998,3998,3998,3999,3999,3999,4000,4000,4000,4001,4001,4001,4002,4002,4002,4003,4003,4003,4004,4004,4004,4005,4005,4005,4006,4006,4006,4007,4007,4007,4008,4008,4008,4008,4009,4009,4009,4010,4010,4010,4011,4011,4011,4012,4012,4012,4013,4013,4013,4014,4014,4014,4014,4015,4015,4015,4016,4016,4016,4017,4017,4017,4018,4018,4018,4018,4019,4019,4019,4020,4020,4020,4021,4021,4021,4021,4022,4022,4022,4023,4023,4023,4023,4024,4024,4024,4025,4025,4025,4026,4026,4026,4026,4027,4027,4027,4028,4028,4028,4028,4029,4029,4029,4030,4030,4030,4030,4031,4031,4031,4031,4032,4032,4032,4033,4033,4033,4033,4034,4034,4034,4034,4035,4035,4035,4036,4036,4036,4036,4037,4037,4037,4037,4038,4038,4038,4038,4039,4039,4039,4039,4040,4040,4040,4040,4041,4041,4041,4041,4042,4042,4042,4042,4043,4043,4043,4043,4044,4044,4044,4044,4045,4045,4045,4045,4046,4046,4046,4046,4047,4047,4047,4047,4048,4048,4048,4048,4049,4049,4049,4049,4050,4050,4050,4050,4050,4051,4051,4051,4051,4052,4052,4052,4052,4053,4053,4053,4053,4053,4054,4054,4054,4054,4055,4055,4055,4055,4055,4056,4056,4056,4056,4056,4057,4057,4057,4057,4058,4058,4058,4058,4058,4059,4059,4059,4059,4059,4060,4060,4060,4060,4060,4061,4061,4061,4061,4061,4062,4062,4062,4062,4062,4063,4063,4063,4063,4063,4064,4064,4064,4064,4064,4065,4065,4065,4065,4065,4066,4066,4066,4066,4066,4066,4067,4067,4067,4067,4067,4068,4068,4068,4068,4068,4068,4069,4069,4069,4069,4069,4070,4070,4070,4070,4070,4070,4071,4071,4071,4071,4071,4071,4072,4072,4072,4072,4072,4072,4073,4073,4073,4073,4073,4073,4074,4074,4074,4074,4074,4074,4075,4075,4075,4075,4075,4075,4075,4076,4076,4076,4076,4076,4076,4076,4077,4077,4077,4077,4077,4077,4078,4078,4078,4078,4078,4078,4078,4079,4079,4079,4079,4079,4079,4079,4079,4080,4080,4080,4080,4080,4080,4080,4081,4081,4081,4081,4081,4081,4081,4081,4082,4082,4082,4082,4082,4082,4082,4082,4083,4083,4083,4083,4083,4083,4083,4083,4084,4084,4084,4084,4084,4084,4084,4084,4084,4085,4085,4085,4085,4085,4085,4085,4085,4085,4086,4086,4086,4086,4086,4086,4086,4086,4086,4087,4087,4087,4087,4087,4087,4087,4087,4087,4087,4087,4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,4088,4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,4089,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4090,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4091,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4092,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4093,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4094,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,4095,}
 #define SIN_TABLE_8192 {0,2,3,5,6,8,9,11,13,14,16,17,19,20,22,24,25,27,28,30,31,33,35,36,38,39,41,42,44,46,47,49,50,52,53,55,57,58,60,61,63,64,66,68,69,71,72,74,75,77,79,80,82,83,85,86,88,90,91,93,94,96,97,99,101,102,104,105,107,108,110,112,113,115,116,118,119,121,123,124,126,127,129,130,132,133,135,137,138,140,141,143,144,146,148,149,151,152,154,155,157,159,160,162,163,165,166,168,170,171,173,174,176,177,179,181,182,184,185,187,188,190,192,193,195,196,198,199,201,203,204,206,207,209,210,212,214,215,217,218,220,221,223,225,226,228,229,231,232,234,236,237,239,240,242,243,245,247,248,250,251,253,254,256,258,259,261,262,264,265,267,269,270,272,273,275,276,278,280,281,283,284,286,287,289,291,292,294,295,297,298,300,301,303,305,306,308,309,311,312,314,316,317,319,320,322,323,325,327,328,330,331,333,334,336,338,339,341,342,344,345,347,349,350,352,353,355,356,358,360,361,363,364,366,367,369,371,372,374,375,377,378,380,382,383,385,386,388,389,391,393,394,396,397,399,400,402,403,405,407,408,410,411,413,414,416,418,419,421,422,424,425,427,429,430,432,433,435,436,438,440,441,443,444,446,447,449,451,452,454,455,457,458,460,462,463,465,466,468,469,471,472,474,476,477,479,480,482,483,485,487,488,490,491,493,494,496,498,499,501,502,504,505,507,509,510,512,513,515,516,518,520,521,523,524,526,527,529,530,532,534,535,537,538,540,541,543,545,546,548,549,551,552,554,556,557,559,560,562,563,565,567,568,570,571,573,574,576,578,579,581,582,584,585,587,588,590,592,593,595,596,598,599,601,603,604,606,607,609,610,612,614,615,617,618,620,621,623,624,626,628,629,631,632,634,635,637,639,640,642,643,645,646,648,650,651,653,654,656,657,659,661,662,664,665,667,668,670,671,673,675,676,678,679,681,682,684,686,687,689,690,692,693,695,697,698,700,701,703,704,706,707,709,711,712,714,715,717,718,720,722,723,725,726,728,729,731,732,734,736,737,739,740,742,743,745,747,748,750,751,753,754,756,758,759,761,762,764,765,767,768,770,772,773,775,776,778,779,781,783,784,786,787,789,790,792,793,795,797,798,800,801,803,804,806,808,809,811,812,814,815,817,818,820,822,823,825,826,828,829,831,833,834,836,837,839,840,842,843,845,847,848,850,851,853,854,856,858,859,861,862,864,865,867,868,870,872,873,875,876,878,879,881,883,884,886,887,889,890,892,893,895,897,898,900,901,903,904,906,908,909,911,912,914,915,917,918,920,922,923,925,926,928,929,931,932,934,936,937,939,940,942,943,945,947,948,950,951,953,954,956,957,959,961,962,964,965,967,968,970,971,973,975,976,978,979,981,982,984,986,987,989,990,992,993,995,996,998,1000,1001,1003,1004,1006,1007,1009,1010,1012,1014,1015,1017,1018,1020,1021,1023,1024,1026,1028,1029,1031,1032,1034,1035,1037,1039,1040,1042,1043,1045,1046,1048,1049,1051,1053,1054,1056,1057,1059,1060,1062,1063,1065,1067,1068,1070,1071,1073,1074,1076,1077,1079,1081,1082,1084,1085,1087,1088,1090,1091,1093,1095,1096,1098,1099,1101,1102,1104,1105,1107,1109,1110,1112,1113,1115,1116,1118,1119,1121,1123,1124,1126,1127,1129,1130,1132,1133,1135,1137,1138,1140,1141,1143,1144,1146,1147,1149,1151,1152,1154,1155,1157,1158,1160,1161,1163,1165,1166,1168,1169,1171,1172,1174,1175,1177,1179,1180,1182,1183,1185,1186,1188,1189,1191,1193,1194,1196,1197,1199,1200,1202,1203,1205,1207,1208,1210,1211,1213,1214,1216,1217,1219,1221,1222,1224,1225,1227,1228,1230,1231,1233,1234,1236,1238,1239,1241,1242,1244,1245,1247,1248,1250,1252,1253,1255,1256,1258,1259,1261,1262,1264,1266,1267,1269,1270,1272,1273,1275,1276,1278,1279,1281,1283,1284,1286,1287,1289,1290,1292,1293,1295,1297,1298,1300,1301,1303,1304,1306,1307,1309,1311,1312,1314,1315,1317,1318,1320,1321,1323,1324,1326,1328,1329,1331,1332,1334,1335,1337,1338,1340,1342,1343,1345,1346,1348,1349,1351,1352,1354,1355,1357,1359,1360,1362,1363,1365,1366,1368,1369,1371,1372,1374,1376,1377,1379,1380,1382,1383,1385,1386,1388,1390,1391,1393,1394,1396,1397,1399,1400,1402,1403,1405,1407,1408,1410,1411,1413,1414,1416,1417,1419,1420,1422,1424,1425,1427,1428,1430,1431,1433,1434,1436,1437,1439,1441,1442,1444,1445,1447,1448,1450,1451,1453,1454,1456,1458,1459,1461,1462,1464,1465,1467,1468,1470,1471,1473,1475,1476,1478,1479,1481,1482,1484,1485,1487,1488,1490,1492,1493,1495,1496,1498,1499,1501,1502,1504,1505,1507,1509,1510,1512,1513,1515,1516,1518,1519,1521,1522,1524,1526,1527,1529,1530,1532,1533,1535,1536,1538,1539,1541,1542,1544,1546,1547,1549,1550,1552,1553,1555,1556,1558,1559,1561,1563,1564,1566,1567,1569,1570,1572,1573,1575,1576,1578,1579,1581,1583,1584,1586,1587,1589,1590,1592,1593,1595,1596,1598,1600,1601,1603,1604,1606,1607,1609,1610,1612,1613,1615,1616,1618,1620,1621,1623,1624,1626,1627,1629,1630,1632,1633,1635,1636,1638,1640,1641,1643,1644,1646,1647,1649,1650,1652,1653,1655,1656,1658,1660,1661,1663,1664,1666,1667,1669,1670,1672,1673,1675,1676,1678,1680,1681,1683,1684,1686,1687,1689,1690,1692,1693,1695,1696,1698,1700,1701,1703,1704,1706,1707,1709,1710,1712,1713,1715,1716,1718,1719,1721,1723,1724,1726,1727,1729,1730,1732,1733,1735,1736,1738,1739,1741,1743,1744,1746,1747,1749,1750,1752,1753,1755,1756,1758,1759,1761,1762,1764,1766,1767,1769,1770,1772,1773,1775,1776,1778,1779,1781,1782,1784,1785,1787,1789,1790,1792,1793,1795,1796,1798,1799,1801,1802,1804,1805,1807,1808,1810,1812,1813,1815,1816,1818,1819,1821,1822,1824,1825,1827,1828,1830,1831,1833,1834,1836,1838,1839,1841,1842,1844,1845,1847,1848,1850,1851,1853,1854,1856,1857,1859,1860,1862,1864,1865,1867,1868,1870,1871,1873,1874,1876,1877,1879,1880,1882,1883,1885,1886,1888,1890,1891,1893,1894,1896,1897,1899,1900,1902,1903,1905,1906,1908,1909,1911,1912,1914,1916,1917,1919,1920,1922,1923,1925,1926,1928,1929,1931,1932,1934,1935,1937,1938,1940,1941,1943,1945,1946,1948,1949,1951,1952,1954,1955,1957,1958,1960,1961,1963,1964,1966,1967,1969,1970,1972,1973,1975,1977,1978,1980,1981,1983,1984,1986,1987,1989,1990,1992,1993,1995,1996,1998,1999,2001,2002,2004,2005,2007,2009,2010,2012,2013,2015,2016,2018,2019,2021,2022,2024,2025,2027,2028,2030,2031,2033,2034,2036,2037,2039,2040,2042,2044,2045,2047,2048,2050,2051,2053,2054,2056,2057,2059,2060,2062,2063,2065,2066,2068,2069,2071,2072,2074,2075,2077,2078,2080,2082,2083,2085,2086,2088,2089,2091,2092,2094,2095,2097,2098,2100,2101,2103,2104,2106,2107,2109,2110,2112,2113,2115,2116,2118,2119,2121,2123,2124,2126,2127,2129,2130,2132,2133,2135,2136,2138,2139,2141,2142,2144,2145,2147,2148,2150,2151,2153,2154,2156,2157,2159,2160,2162,2163,2165,2166,2168,2170,2171,2173,2174,2176,2177,2179,2180,2182,2183,2185,2186,2188,2189,2191,2192,2194,2195,2197,2198,2200,2201,2203,2204,2206,2207,2209,2210,2212,2213,2215,2216,2218,2219,2221,2222,2224,2225,2227,2229,2230,2232,2233,2235,2236,2238,2239,2241,2242,2244,2245,2247,2248,2250,2251,2253,2254,2256,2257,2259,2260,2262,2263,2265,2266,2268,2269,2271,2272,2274,2275,2277,2278,2280,2281,2283,2284,2286,2287,2289,2290,2292,2293,2295,2296,2298,2299,2301,2302,2304,2305,2307,2308,2310,2312,2313,2315,2316,2318,2319,2321,2322,2324,2325,2327,2328,2330,2331,2333,2334,2336,2337,2339,2340,2342,2343,2345,2346,2348,2349,2351,2352,2354,2355,2357,2358,2360,2361,2363,2364,2366,2367,2369,2370,2372,2373,2375,2376,2378,2379,2381,2382,2384,2385,2387,2388,2390,2391,2393,2394,2396,2397,2399,2400,2402,2403,2405,2406,2408,2409,2411,2412,2414,2415,2417,2418,2420,2421,2423,2424,2426,2427,2429,2430,2432,2433,2435,2436,2438,2439,2441,2442,2444,2445,2447,2448,2450,2451,2453,2454,2456,2457,2459,2460,2462,2463,2465,2466,2468,2469,2471,2472,2474,2475,2477,2478,2480,2481,2483,2484,2486,2487,2489,2490,2492,2493,2495,2496,2498,2499,2501,2502,2504,2505,2507,2508,2510,2511,2513,2514,2516,2517,2519,2520,2522,2523,2525,2526,2528,2529,2531,2532,2534,2535,2537,2538,2540,2541,2543,2544,2545,2547,2548,2550,2551,2553,2554,2556,2557,2559,2560,2562,2563,2565,2566,2568,2569,2571,2572,2574,2575,2577,2578,2580,2581,2583,2584,2586,2587,2589,2590,2592,2593,2595,2596,2598,2599,2601,2602,2604,2605,2607,2608,2610,2611,2613,2614,2616,2617,2619,2620,2622,2623,2624,2626,2627,2629,2630,2632,2633,2635,2636,2638,2639,2641,2642,2644,2645,2647,2648,2650,2651,2653,2654,2656,2657,2659,2660,2662,2663,2665,2666,2668,2669,2671,2672,2674,2675,2676,2678,2679,2681,2682,2684,2685,2687,2688,2690,2691,2693,2694,2696,2697,2699,2700,2702,2703,2705,2706,2708,2709,2711,2712,2714,2715,2717,2718,2720,2721,2722,2724,2725,2727,2728,2730,2731,2733,2734,2736,2737,2739,2740,2742,2743,2745,2746,2748,2749,2751,2752,2754,2755,2757,2758,2759,2761,2762,2764,2765,2767,2768,2770,2771,2773,2774,2776,2777,2779,2780,2782,2783,2785,2786,2788,2789,2790,2792,2793,2795,2796,2798,2799,2801,2802,2804,2805,2807,2808,2810,2811,2813,2814,2816,2817,2819,2820,2821,2823,2824,2826,2827,2829,2830,2832,2833,2835,2836,2838,2839,2841,2842,2844,2845,2847,2848,2849,2851,2852,2854,2855,2857,2858,2860,2861,2863,2864,2866,2867,2869,2870,2872,2873,2874,2876,2877,2879,2880,2882,2883,2885,2886,2888,2889,2891,2892,2894,2895,2897,2898,2899,2901,2902,2904,2905,2907,2908,2910,2911,2913,2914,2916,2917,2919,2920,2922,2923,2924,2926,2927,2929,2930,2932,2933,2935,2936,2938,2939,2941,2942,2944,2945,2946,2948,2949,2951,2952,2954,2955,2957,2958,2960,2961,2963,2964,2965,2967,2968,2970,2971,2973,2974,2976,2977,2979,2980,2982,2983,2985,2986,2987,2989,2990,2992,2993,2995,2996,2998,2999,3001,3002,3004,3005,3006,3008,3009,3011,3012,3014,3015,3017,3018,3020,3021,3022,3024,3025,3027,3028,3030,3031,3033,3034,3036,3037,3039,3040,3041,3043,3044,3046,3047,3049,3050,3052,3053,3055,3056,3057,3059,3060,3062,3063,3065,3066,3068,3069,3071,3072,3074,3075,3076,3078,3079,3081,3082,3084,3085,3087,3088,3090,3091,3092,3094,3095,3097,3098,3100,3101,3103,3104,3106,3107,3108,3110,3111,3113,3114,3116,3117,3119,3120,3121,3123,3124,3126,3127,3129,3130,3132,3133,3135,3136,3137,3139,3140,3142,3143,3145,3146,3148,3149,3151,3152,3153,3155,3156,3158,3159,3161,3162,3164,3165,3166,3168,3169,3171,3172,3174,3175,3177,3178,3179,3181,3182,3184,3185,3187,3188,3190,3191,3193,3194,3195,3197,3198,3200,3201,3203,3204,3206,3207,3208,3210,3211,3213,3214,3216,3217,3219,3220,3221,3223,3224,3226,3227,3229,3230,3232,3233,3234,3236,3237,3239,3240,3242,3243,3245,3246,3247,3249,3250,3252,3253,3255,3256,3257,3259,3260,3262,3263,3265,3266,3268,3269,3270,3272,3273,3275,3276,3278,3279,3281,3282,3283,3285,3286,3288,3289,3291,3292,3293,3295,3296,3298,3299,3301,3302,3304,3305,3306,3308,3309,3311,3312,3314,3315,3316,3318,3319,3321,3322,3324,3325,3327,3328,3329,3331,3332,3334,3335,3337,3338,3339,3341,3342,3344,3345,3347,3348,3349,3351,3352,3354,3355,3357,3358,3359,3361,3362,3364,3365,3367,3368,3370,3371,3372,3374,3375,3377,3378,3380,3381,3382,3384,3385,3387,3388,3390,3391,3392,3394,3395,3397,3398,3400,3401,3402,3404,3405,3407,3408,3410,3411,3412,3414,3415,3417,3418,3420,3421,3422,3424,3425,3427,3428,3430,3431,3432,3434,3435,3437,3438,3440,3441,3442,3444,3445,3447,3448,3449,3451,3452,3454,3455,3457,3458,3459,3461,3462,3464,3465,3467,3468,3469,3471,3472,3474,3475,3477,3478,3479,3481,3482,3484,3485,3486,3488,3489,3491,3492,3494,3495,3496,3498,3499,3501,3502,3504,3505,3506,3508,3509,3511,3512,3513,3515,3516,3518,3519,3521,3522,3523,3525,3526,3528,3529,3530,3532,3533,3535,3536,3538,3539,3540,3542,3543,3545,3546,3547,3549,3550,3552,3553,3555,3556,3557,3559,3560,3562,3563,3564,3566,3567,3569,3570,3572,3573,3574,3576,3577,3579,3580,3581,3583,3584,3586,3587,3588,3590,3591,3593,3594,3596,3597,3598,3600,3601,3603,3604,3605,3607,3608,3610,3611,3612,3614,3615,3617,3618,3619,3621,3622,3624,3625,3627,3628,3629,3631,3632,3634,3635,3636,3638,3639,3641,3642,3643,3645,3646,3648,3649,3650,3652,3653,3655,3656,3657,3659,3660,3662,3663,3665,3666,3667,3669,3670,3672,3673,3674,3676,3677,3679,3680,3681,3683,3684,3686,3687,3688,3690,3691,3693,3694,3695,3697,3698,3700,3701,3702,3704,3705,3707,3708,3709,3711,3712,3714,3715,3716,3718,3719,3721,3722,3723,3725,3726,3728,3729,3730,3732,3733,3735,3736,3737,3739,3740,3742,3743,3744,3746,3747,3749,3750,3751,3753,3754,3756,3757,3758,3760,3761,3763,3764,3765,3767,3768,3769,3771,3772,3774,3775,3776,3778,3779,3781,3782,3783,3785,3786,3788,3789,3790,3792,3793,3795,3796,3797,3799,3800,3802,3803,3804,3806,3807,3808,3810,3811,3813,3814,3815,3817,3818,3820,3821,3822,3824,3825,3827,3828,3829,3831,3832,3833,3835,3836,3838,3839,3840,3842,3843,3845,3846,3847,3849,3850,3852,3853,3854,3856,3857,3858,3860,3861,3863,3864,3865,3867,3868,3870,3871,3872,3874,3875,3876,3878,3879,3881,3882,3883,3885,3886,3888,3889,3890,3892,3893,3894,3896,3897,3899,3900,3901,3903,3904,3905,3907,3908,3910,3911,3912,3914,3915,3917,3918,3919,3921,3922,3923,3925,3926,3928,3929,3930,3932,3933,3934,3936,3937,3939,3940,3941,3943,3944,3945,3947,3948,3950,3951,3952,3954,3955,3956,3958,3959,3961,3962,3963,3965,3966,3967,3969,3970,3972,3973,3974,3976,3977,3978,3980,3981,3983,3984,3985,3987,3988,3989,3991,3992,3994,3995,3996,3998,3999,4000,4002,4003,4004,4006,4007,4009,4010,4011,4013,4014,4015,4017,4018,4020,4021,4022,4024,4025,4026,4028,4029,4030,4032,4033,4035,4036,4037,4039,4040,4041,4043,4044,4046,4047,4048,4050,4051,4052,4054,4055,4056,4058,4059,4061,4062,4063,4065,4066,4067,4069,4070,4071,4073,4074,4076,4077,4078,4080,4081,4082,4084,4085,4086,4088,4089,4091,4092,4093,4095,4096,4097,4099,4100,4101,4103,4104,4105,4107,4108,4110,4111,4112,4114,4115,4116,4118,4119,4120,4122,4123,4124,4126,4127,4129,4130,4131,4133,4134,4135,4137,4138,4139,4141,4142,4143,4145,4146,4148,4149,4150,4152,4153,4154,4156,4157,4158,4160,4161,4162,4164,4165,4166,4168,4169,4171,4172,4173,4175,4176,4177,4179,4180,4181,4183,4184,4185,4187,4188,4189,4191,4192,4193,4195,4196,4198,4199,4200,4202,4203,4204,4206,4207,4208,4210,4211,4212,4214,4215,4216,4218,4219,4220,4222,4223,4224,4226,4227,4229,4230,4231,4233,4234,4235,4237,4238,4239,4241,4242,4243,4245,4246,4247,4249,4250,4251,4253,4254,4255,4257,4258,4259,4261,4262,4263,4265,4266,4267,4269,4270,4271,4273,4274,4275,4277,4278,4280,4281,4282,4284,4285,4286,4288,4289,4290,4292,4293,4294,4296,4297,4298,4300,4301,4302,4304,4305,4306,4308,4309,4310,4312,4313,4314,4316,4317,4318,4320,4321,4322,4324,4325,4326,4328,4329,4330,4332,4333,4334,4336,4337,4338,4340,4341,4342,4344,4345,4346,4348,4349,4350,4352,4353,4354,4356,4357,4358,4360,4361,4362,4364,4365,4366,4368,4369,4370,4372,4373,4374,4376,4377,4378,4380,4381,4382,4383,4385,4386,4387,4389,4390,4391,4393,4394,4395,4397,4398,4399,4401,4402,4403,4405,4406,4407,4409,4410,4411,4413,4414,4415,4417,4418,4419,4421,4422,4423,4425,4426,4427,4429,4430,4431,4432,4434,4435,4436,4438,4439,4440,4442,4443,4444,4446,4447,4448,4450,4451,4452,4454,4455,4456,4458,4459,4460,4461,4463,4464,4465,4467,4468,4469,4471,4472,4473,4475,4476,4477,4479,4480,4481,4483,4484,4485,4486,4488,4489,4490,4492,4493,4494,4496,4497,4498,4500,4501,4502,4504,4505,4506,4507,4509,4510,4511,4513,4514,4515,4517,4518,4519,4521,4522,4523,4525,4526,4527,4528,4530,4531,4532,4534,4535,4536,4538,4539,4540,4542,4543,4544,4545,4547,4548,4549,4551,4552,4553,4555,4556,4557,4559,4560,4561,4562,4564,4565,4566,4568,4569,4570,4572,4573,4574,4575,4577,4578,4579,4581,4582,4583,4585,4586,4587,4588,4590,4591,4592,4594,4595,4596,4598,4599,4600,4601,4603,4604,4605,4607,4608,4609,4611,4612,4613,4614,4616,4617,4618,4620,4621,4622,4624,4625,4626,4627,4629,4630,4631,4633,4634,4635,4636,4638,4639,4640,4642,4643,4644,4646,4647,4648,4649,4651,4652,4653,4655,4656,4657,4658,4660,4661,4662,4664,4665,4666,4668,4669,4670,4671,4673,4674,4675,4677,4678,4679,4680,4682,4683,4684,4686,4687,4688,4689,4691,4692,4693,4695,4696,4697,4698,4700,4701,4702,4704,4705,4706,4707,4709,4710,4711,4713,4714,4715,4716,4718,4719,4720,4722,4723,4724,4725,4727,4728,4729,4731,4732,4733,4734,4736,4737,4738,4740,4741,4742,4743,4745,4746,4747,4748,4750,4751,4752,4754,4755,4756,4757,4759,4760,4761,4763,4764,4765,4766,4768,4769,4770,4772,4773,4774,4775,4777,4778,4779,4780,4782,4783,4784,4786,4787,4788,4789,4791,4792,4793,4794,4796,4797,4798,4800,4801,4802,4803,4805,4806,4807,4808,4810,4811,4812,4814,4815,4816,4817,4819,4820,4821,4822,4824,4825,4826,4828,4829,4830,4831,4833,4834,4835,4836,4838,4839,4840,4841,4843,4844,4845,4847,4848,4849,4850,4852,4853,4854,4855,4857,4858,4859,4860,4862,4863,4864,4865,4867,4868,4869,4871,4872,4873,4874,4876,4877,4878,4879,4881,4882,4883,4884,4886,4887,4888,4889,4891,4892,4893,4894,4896,4897,4898,4900,4901,4902,4903,4905,4906,4907,4908,4910,4911,4912,4913,4915,4916,4917,4918,4920,4921,4922,4923,4925,4926,4927,4928,4930,4931,4932,4933,4935,4936,4937,4938,4940,4941,4942,4943,4945,4946,4947,4948,4950,4951,4952,4953,4955,4956,4957,4958,4960,4961,4962,4963,4965,4966,4967,4968,4970,4971,4972,4973,4975,4976,4977,4978,4980,4981,4982,4983,4985,4986,4987,4988,4990,4991,4992,4993,4995,4996,4997,4998,5000,5001,5002,5003,5005,5006,5007,5008,5010,5011,5012,5013,5015,5016,5017,5018,5020,5021,5022,5023,5024,5026,5027,5028,5029,5031,5032,5033,5034,5036,5037,5038,5039,5041,5042,5043,5044,5046,5047,5048,5049,5050,5052,5053,5054,5055,5057,5058,5059,5060,5062,5063,5064,5065,5067,5068,5069,5070,5071,5073,5074,5075,5076,5078,5079,5080,5081,5083,5084,5085,5086,5088,5089,5090,5091,5092,5094,5095,5096,5097,5099,5100,5101,5102,5103,5105,5106,5107,5108,5110,5111,5112,5113,5115,5116,5117,5118,5119,5121,5122,5123,5124,5126,5127,5128,5129,5130,5132,5133,5134,5135,5137,5138,5139,5140,5141,5143,5144,5145,5146,5148,5149,5150,5151,5152,5154,5155,5156,5157,5159,5160,5161,5162,5163,5165,5166,5167,5168,5170,5171,5172,5173,5174,5176,5177,5178,5179,5181,5182,5183,5184,5185,5187,5188,5189,5190,5191,5193,5194,5195,5196,5198,5199,5200,5201,5202,5204,5205,5206,5207,5208,5210,5211,5212,5213,5215,5216,5217,5218,5219,5221,5222,5223,5224,5225,5227,5228,5229,5230,5231,5233,5234,5235,5236,5237,5239,5240,5241,5242,5244,5245,5246,5247,5248,5250,5251,5252,5253,5254,5256,5257,5258,5259,5260,5262,5263,5264,5265,5266,5268,5269,5270,5271,5272,5274,5275,5276,5277,5278,5280,5281,5282,5283,5284,5286,5287,5288,5289,5290,5292,5293,5294,5295,5296,5298,5299,5300,5301,5302,5304,5305,5306,5307,5308,5310,5311,5312,5313,5314,5316,5317,5318,5319,5320,5322,5323,5324,5325,5326,5328,5329,5330,5331,5332,5333,5335,5336,5337,5338,5339,5341,5342,5343,5344,5345,5347,5348,5349,5350,5351,5353,5354,5355,5356,5357,5358,5360,5361,5362,5363,5364,5366,5367,5368,5369,5370,5372,5373,5374,5375,5376,5377,5379,5380,5381,5382,5383,5385,5386,5387,5388,5389,5390,5392,5393,5394,5395,5396,5398,5399,5400,5401,5402,5403,5405,5406,5407,5408,5409,5411,5412,5413,5414,5415,5416,5418,5419,5420,5421,5422,5423,5425,5426,5427,5428,5429,5431,5432,5433,5434,5435,5436,5438,5439,5440,5441,5442,5443,5445,5446,5447,5448,5449,5451,5452,5453,5454,5455,5456,5458,5459,5460,5461,5462,5463,5465,5466,5467,5468,5469,5470,5472,5473,5474,5475,5476,5477,5479,5480,5481,5482,5483,5484,5486,5487,5488,5489,5490,5491,5493,5494,5495,5496,5497,5498,5500,5501,5502,5503,5504,5505,5507,5508,5509,5510,5511,5512,5514,5515,5516,5517,5518,5519,5520,5522,5523,5524,5525,5526,5527,5529,5530,5531,5532,5533,5534,5536,5537,5538,5539,5540,5541,5543,5544,5545,5546,5547,5548,5549,5551,5552,5553,5554,5555,5556,5558,5559,5560,5561,5562,5563,5564,5566,5567,5568,5569,5570,5571,5573,5574,5575,5576,5577,5578,5579,5581,5582,5583,5584,5585,5586,5587,5589,5590,5591,5592,5593,5594,5595,5597,5598,5599,5600,5601,5602,5604,5605,5606,5607,5608,5609,5610,5612,5613,5614,5615,5616,5617,5618,5620,5621,5622,5623,5624,5625,5626,5628,5629,5630,5631,5632,5633,5634,5636,5637,5638,5639,5640,5641,5642,5643,5645,5646,5647,5648,5649,5650,5651,5653,5654,5655,5656,5657,5658,5659,5661,5662,5663,5664,5665,5666,5667,5668,5670,5671,5672,5673,5674,5675,5676,5678,5679,5680,5681,5682,5683,5684,5685,5687,5688,5689,5690,5691,5692,5693,5694,5696,5697,5698,5699,5700,5701,5702,5704,5705,5706,5707,5708,5709,5710,5711,5713,5714,5715,5716,5717,5718,5719,5720,5722,5723,5724,5725,5726,5727,5728,5729,5731,5732,5733,5734,5735,5736,5737,5738,5739,5741,5742,5743,5744,5745,5746,5747,5748,5750,5751,5752,5753,5754,5755,5756,5757,5758,5760,5761,5762,5763,5764,5765,5766,5767,5769,5770,5771,5772,5773,5774,5775,5776,5777,5779,5780,5781,5782,5783,5784,5785,5786,5787,5789,5790,5791,5792,5793,5794,5795,5796,5797,5799,5800,5801,5802,5803,5804,5805,5806,5807,5809,5810,5811,5812,5813,5814,5815,5816,5817,5819,5820,5821,5822,5823,5824,5825,5826,5827,5828,5830,5831,5832,5833,5834,5835,5836,5837,5838,5839,5841,5842,5843,5844,5845,5846,5847,5848,5849,5850,5852,5853,5854,5855,5856,5857,5858,5859,5860,5861,5863,5864,5865,5866,5867,5868,5869,5870,5871,5872,5874,5875,5876,5877,5878,5879,5880,5881,5882,5883,5884,5886,5887,5888,5889,5890,5891,5892,5893,5894,5895,5896,5898,5899,5900,5901,5902,5903,5904,5905,5906,5907,5908,5910,5911,5912,5913,5914,5915,5916,5917,5918,5919,5920,5921,5923,5924,5925,5926,5927,5928,5929,5930,5931,5932,5933,5934,5936,5937,5938,5939,5940,5941,5942,5943,5944,5945,5946,5947,5949,5950,5951,5952,5953,5954,5955,5956,5957,5958,5959,5960,5961,5963,5964,5965,5966,5967,5968,5969,5970,5971,5972,5973,5974,5975,5977,5978,5979,5980,5981,5982,5983,5984,5985,5986,5987,5988,5989,5990,5992,5993,5994,5995,5996,5997,5998,5999,6000,6001,6002,6003,6004,6005,6007,6008,6009,6010,6011,6012,6013,6014,6015,6016,6017,6018,6019,6020,6021,6023,6024,6025,6026,6027,6028,6029,6030,6031,6032,6033,6034,6035,6036,6037,6038,6040,6041,6042,6043,6044,6045,6046,6047,6048,6049,6050,6051,6052,6053,6054,6055,6056,6058,6059,6060,6061,6062,6063,6064,6065,6066,6067,6068,6069,6070,6071,6072,6073,6074,6075,6077,6078,6079,6080,6081,6082,6083,6084,6085,6086,6087,6088,6089,6090,6091,6092,6093,6094,6095,6096,6098,6099,6100,6101,6102,6103,6104,6105,6106,6107,6108,6109,6110,6111,6112,6113,6114,6115,6116,6117,6118,6120,6121,6122,6123,6124,6125,6126,6127,6128,6129,6130,6131,6132,6133,6134,6135,6136,6137,6138,6139,6140,6141,6142,6143,6144,6146,6147,6148,6149,6150,6151,6152,6153,6154,6155,6156,6157,6158,6159,6160,6161,6162,6163,6164,6165,6166,6167,6168,6169,6170,6171,6172,6173,6175,6176,6177,6178,6179,6180,6181,6182,6183,6184,6185,6186,6187,6188,6189,6190,6191,6192,6193,6194,6195,6196,6197,6198,6199,6200,6201,6202,6203,6204,6205,6206,6207,6208,6209,6210,6212,6213,6214,6215,6216,6217,6218,6219,6220,6221,6222,6223,6224,6225,6226,6227,6228,6229,6230,6231,6232,6233,6234,6235,6236,6237,6238,6239,6240,6241,6242,6243,6244,6245,6246,6247,6248,6249,6250,6251,6252,6253,6254,6255,6256,6257,6258,6259,6260,6261,6262,6263,6264,6265,6266,6267,6268,6270,6271,6272,6273,6274,6275,6276,6277,6278,6279,6280,6281,6282,6283,6284,6285,6286,6287,6288,6289,6290,6291,6292,6293,6294,6295,6296,6297,6298,6299,6300,6301,6302,6303,6304,6305,6306,6307,6308,6309,6310,6311,6312,6313,6314,6315,6316,6317,6318,6319,6320,6321,6322,6323,6324,6325,6326,6327,6328,6329,6330,6331,6332,6333,6334,6335,6336,6337,6338,6339,6340,6341,6342,6343,6344,6345,6346,6347,6348,6349,6350,6351,6352,6353,6354,6355,6356,6357,6358,6359,6360,6361,6362,6363,6363,6364,6365,6366,6367,6368,6369,6370,6371,6372,6373,6374,6375,6376,6377,6378,6379,6380,6381,6382,6383,6384,6385,6386,6387,6388,6389,6390,6391,6392,6393,6394,6395,6396,6397,6398,6399,6400,6401,6402,6403,6404,6405,6406,6407,6408,6409,6410,6411,6412,6413,6414,6415,6416,6417,6418,6419,6419,6420,6421,6422,6423,6424,6425,6426,6427,6428,6429,6430,6431,6432,6433,6434,6435,6436,6437,6438,6439,6440,6441,6442,6443,6444,6445,6446,6447,6448,6449,6450,6451,6452,6453,6453,6454,6455,6456,6457,6458,6459,6460,6461,6462,6463,6464,6465,6466,6467,6468,6469,6470,6471,6472,6473,6474,6475,6476,6477,6478,6479,6480,6480,6481,6482,6483,6484,6485,6486,6487,6488,6489,6490,6491,6492,6493,6494,6495,6496,6497,6498,6499,6500,6501,6502,6502,6503,6504,6505,6506,6507,6508,6509,6510,6511,6512,6513,6514,6515,6516,6517,6518,6519,6520,6521,6522,6523,6523,6524,6525,6526,6527,6528,6529,6530,6531,6532,6533,6534,6535,6536,6537,6538,6539,6540,6541,6541,6542,6543,6544,6545,6546,6547,6548,6549,6550,6551,6552,6553,6554,6555,6556,6557,6557,6558,6559,6560,6561,6562,6563,6564,6565,6566,6567,6568,6569,6570,6571,6572,6573,6573,6574,6575,6576,6577,6578,6579,6580,6581,6582,6583,6584,6585,6586,6587,6587,6588,6589,6590,6591,6592,6593,6594,6595,6596,6597,6598,6599,6600,6601,6601,6602,6603,6604,6605,6606,6607,6608,6609,6610,6611,6612,6613,6614,6614,6615,6616,6617,6618,6619,6620,6621,6622,6623,6624,6625,6626,6626,6627,6628,6629,6630,6631,6632,6633,6634,6635,6636,6637,6638,6638,6639,6640,6641,6642,6643,6644,6645,6646,6647,6648,6649,6649,6650,6651,6652,6653,6654,6655,6656,6657,6658,6659,6660,6660,6661,6662,6663,6664,6665,6666,6667,6668,6669,6670,6671,6671,6672,6673,6674,6675,6676,6677,6678,6679,6680,6681,6681,6682,6683,6684,6685,6686,6687,6688,6689,6690,6691,6691,6692,6693,6694,6695,6696,6697,6698,6699,6700,6700,6701,6702,6703,6704,6705,6706,6707,6708,6709,6709,6710,6711,6712,6713,6714,6715,6716,6717,6718,6718,6719,6720,6721,6722,6723,6724,6725,6726,6727,6727,6728,6729,6730,6731,6732,6733,6734,6735,6735,6736,6737,6738,6739,6740,6741,6742,6743,6744,6744,6745,6746,6747,6748,6749,6750,6751,6752,6752,6753,6754,6755,6756,6757,6758,6759,6760,6760,6761,6762,6763,6764,6765,6766,6767,6768,6768,6769,6770,6771,6772,6773,6774,6775,6775,6776,6777,6778,6779,6780,6781,6782,6783,6783,6784,6785,6786,6787,6788,6789,6790,6790,6791,6792,6793,6794,6795,6796,6797,6797,6798,6799,6800,6801,6802,6803,6804,6804,6805,6806,6807,6808,6809,6810,6811,6811,6812,6813,6814,6815,6816,6817,6818,6818,6819,6820,6821,6822,6823,6824,6824,6825,6826,6827,6828,6829,6830,6831,6831,6832,6833,6834,6835,6836,6837,6837,6838,6839,6840,6841,6842,6843,6844,6844,6845,6846,6847,6848,6849,6850,6850,6851,6852,6853,6854,6855,6856,6856,6857,6858,6859,6860,6861,6862,6862,6863,6864,6865,6866,6867,6868,6868,6869,6870,6871,6872,6873,6874,6874,6875,6876,6877,6878,6879,6880,6880,6881,6882,6883,6884,6885,6886,6886,6887,6888,6889,6890,6891,6891,6892,6893,6894,6895,6896,6897,6897,6898,6899,6900,6901,6902,6902,6903,6904,6905,6906,6907,6908,6908,6909,6910,6911,6912,6913,6913,6914,6915,6916,6917,6918,6919,6919,6920,6921,6922,6923,6924,6924,6925,6926,6927,6928,6929,6929,6930,6931,6932,6933,6934,6934,6935,6936,6937,6938,6939,6939,6940,6941,6942,6943,6944,6944,6945,6946,6947,6948,6949,6949,6950,6951,6952,6953,6954,6954,6955,6956,6957,6958,6959,6959,6960,6961,6962,6963,6964,6964,6965,6966,6967,6968,6969,6969,6970,6971,6972,6973,6973,6974,6975,6976,6977,6978,6978,6979,6980,6981,6982,6982,6983,6984,6985,6986,6987,6987,6988,6989,6990,6991,6992,6992,6993,6994,6995,6996,6996,6997,6998,6999,7000,7001,7001,7002,7003,7004,7005,7005,7006,7007,7008,7009,7009,7010,7011,7012,7013,7014,7014,7015,7016,7017,7018,7018,7019,7020,7021,7022,7022,7023,7024,7025,7026,7026,7027,7028,7029,7030,7030,7031,7032,7033,7034,7035,7035,7036,7037,7038,7039,7039,7040,7041,7042,7043,7043,7044,7045,7046,7047,7047,7048,7049,7050,7051,7051,7052,7053,7054,7055,7055,7056,7057,7058,7059,7059,7060,7061,7062,7063,7063,7064,7065,7066,7066,7067,7068,7069,7070,7070,7071,7072,7073,7074,7074,7075,7076,7077,7078,7078,7079,7080,7081,7082,7082,7083,7084,7085,7085,7086,7087,7088,7089,7089,7090,7091,7092,7093,7093,7094,7095,7096,7096,7097,7098,7099,7100,7100,7101,7102,7103,7104,7104,7105,7106,7107,7107,7108,7109,7110,7111,7111,7112,7113,7114,7114,7115,7116,7117,7118,7118,7119,7120,7121,7121,7122,7123,7124,7125,7125,7126,7127,7128,7128,7129,7130,7131,7132,7132,7133,7134,7135,7135,7136,7137,7138,7138,7139,7140,7141,7142,7142,7143,7144,7145,7145,7146,7147,7148,7148,7149,7150,7151,7152,7152,7153,7154,7155,7155,7156,7157,7158,7158,7159,7160,7161,7161,7162,7163,7164,7165,7165,7166,7167,7168,7168,7169,7170,7171,7171,7172,7173,7174,7174,7175,7176,7177,7177,7178,7179,7180,7180,7181,7182,7183,7183,7184,7185,7186,7186,7187,7188,7189,7189,7190,7191,7192,7192,7193,7194,7195,7195,7196,7197,7198,7198,7199,7200,7201,7201,7202,7203,7204,7204,7205,7206,7207,7207,7208,7209,7210,7210,7211,7212,7213,7213,7214,7215,7216,7216,7217,7218,7219,7219,7220,7221,7222,7222,7223,7224,7225,7225,7226,7227,7228,7228,7229,7230,7230,7231,7232,7233,7233,7234,7235,7236,7236,7237,7238,7239,7239,7240,7241,7242,7242,7243,7244,7244,7245,7246,7247,7247,7248,7249,7250,7250,7251,7252,7252,7253,7254,7255,7255,7256,7257,7258,7258,7259,7260,7261,7261,7262,7263,7263,7264,7265,7266,7266,7267,7268,7268,7269,7270,7271,7271,7272,7273,7274,7274,7275,7276,7276,7277,7278,7279,7279,7280,7281,7281,7282,7283,7284,7284,7285,7286,7287,7287,7288,7289,7289,7290,7291,7292,7292,7293,7294,7294,7295,7296,7297,7297,7298,7299,7299,7300,7301,7302,7302,7303,7304,7304,7305,7306,7306,7307,7308,7309,7309,7310,7311,7311,7312,7313,7314,7314,7315,7316,7316,7317,7318,7319,7319,7320,7321,7321,7322,7323,7323,7324,7325,7326,7326,7327,7328,7328,7329,7330,7330,7331,7332,7333,7333,7334,7335,7335,7336,7337,7337,7338,7339,7340,7340,7341,7342,7342,7343,7344,7344,7345,7346,7347,7347,7348,7349,7349,7350,7351,7351,7352,7353,7353,7354,7355,7356,7356,7357,7358,7358,7359,7360,7360,7361,7362,7362,7363,7364,7364,7365,7366,7367,7367,7368,7369,7369,7370,7371,7371,7372,7373,7373,7374,7375,7375,7376,7377,7377,7378,7379,7380,7380,7381,7382,7382,7383,7384,7384,7385,7386,7386,7387,7388,7388,7389,7390,7390,7391,7392,7392,7393,7394,7394,7395,7396,7396,7397,7398,7399,7399,7400,7401,7401,7402,7403,7403,7404,7405,7405,7406,7407,7407,7408,7409,7409,7410,7411,7411,7412,7413,7413,7414,7415,7415,7416,7417,7417,7418,7419,7419,7420,7421,7421,7422,7423,7423,7424,7425,7425,7426,7427,7427,7428,7429,7429,7430,7431,7431,7432,7433,7433,7434,7435,7435,7436,7436,7437,7438,7438,7439,7440,7440,7441,7442,7442,7443,7444,7444,7445,7446,7446,7447,7448,7448,7449,7450,7450,7451,7452,7452,7453,7454,7454,7455,7455,7456,7457,7457,7458,7459,7459,7460,7461,7461,7462,7463,7463,7464,7465,7465,7466,7466,7467,7468,7468,7469,7470,7470,7471,7472,7472,7473,7474,7474,7475,7476,7476,7477,7477,7478,7479,7479,7480,7481,7481,7482,7483,7483,7484,7484,7485,7486,7486,7487,7488,7488,7489,7490,7490,7491,7491,7492,7493,7493,7494,7495,7495,7496,7497,7497,7498,7498,7499,7500,7500,7501,7502,7502,7503,7503,7504,7505,7505,7506,7507,7507,7508,7509,7509,7510,7510,7511,7512,7512,7513,7514,7514,7515,7515,7516,7517,7517,7518,7519,7519,7520,7520,7521,7522,7522,7523,7524,7524,7525,7525,7526,7527,7527,7528,7528,7529,7530,7530,7531,7532,7532,7533,7533,7534,7535,7535,7536,7536,7537,7538,7538,7539,7540,7540,7541,7541,7542,7543,7543,7544,7544,7545,7546,7546,7547,7548,7548,7549,7549,7550,7551,7551,7552,7552,7553,7554,7554,7555,7555,7556,7557,7557,7558,7558,7559,7560,7560,7561,7561,7562,7563,7563,7564,7564,7565,7566,7566,7567,7567,7568,7569,7569,7570,7570,7571,7572,7572,7573,7573,7574,7575,7575,7576,7576,7577,7578,7578,7579,7579,7580,7581,7581,7582,7582,7583,7584,7584,7585,7585,7586,7587,7587,7588,7588,7589,7590,7590,7591,7591,7592,7592,7593,7594,7594,7595,7595,7596,7597,7597,7598,7598,7599,7600,7600,7601,7601,7602,7602,7603,7604,7604,7605,7605,7606,7607,7607,7608,7608,7609,7609,7610,7611,7611,7612,7612,7613,7614,7614,7615,7615,7616,7616,7617,7618,7618,7619,7619,7620,7620,7621,7622,7622,7623,7623,7624,7624,7625,7626,7626,7627,7627,7628,7628,7629,7630,7630,7631,7631,7632,7632,7633,7634,7634,7635,7635,7636,7636,7637,7638,7638,7639,7639,7640,7640,7641,7642,7642,7643,7643,7644,7644,7645,7646,7646,7647,7647,7648,7648,7649,7649,7650,7651,7651,7652,7652,7653,7653,7654,7655,7655,7656,7656,7657,7657,7658,7658,7659,7660,7660,7661,7661,7662,7662,7663,7663,7664,7665,7665,7666,7666,7667,7667,7668,7668,7669,7670,7670,7671,7671,7672,7672,7673,7673,7674,7674,7675,7676,7676,7677,7677,7678,7678,7679,7679,7680,7680,7681,7682,7682,7683,7683,7684,7684,7685,7685,7686,7686,7687,7688,7688,7689,7689,7690,7690,7691,7691,7692,7692,7693,7693,7694,7695,7695,7696,7696,7697,7697,7698,7698,7699,7699,7700,7700,7701,7702,7702,7703,7703,7704,7704,7705,7705,7706,7706,7707,7707,7708,7708,7709,7710,7710,7711,7711,7712,7712,7713,7713,7714,7714,7715,7715,7716,7716,7717,7717,7718,7719,7719,7720,7720,7721,7721,7722,7722,7723,7723,7724,7724,7725,7725,7726,7726,7727,7727,7728,7728,7729,7729,7730,7731,7731,7732,7732,7733,7733,7734,7734,7735,7735,7736,7736,7737,7737,7738,7738,7739,7739,7740,7740,7741,7741,7742,7742,7743,7743,7744,7744,7745,7745,7746,7746,7747,7748,7748,7749,7749,7750,7750,7751,7751,7752,7752,7753,7753,7754,7754,7755,7755,7756,7756,7757,7757,7758,7758,7759,7759,7760,7760,7761,7761,7762,7762,7763,7763,7764,7764,7765,7765,7766,7766,7767,7767,7768,7768,7769,7769,7770,7770,7771,7771,7772,7772,7773,7773,7774,7774,7775,7775,7776,7776,7777,7777,7778,7778,7779,7779,7780,7780,7781,7781,7782,7782,7782,7783,7783,7784,7784,7785,7785,7786,7786,7787,7787,7788,7788,7789,7789,7790,7790,7791,7791,7792,7792,7793,7793,7794,7794,7795,7795,7796,7796,7797,7797,7798,7798,7799,7799,7799,7800,7800,7801,7801,7802,7802,7803,7803,7804,7804,7805,7805,7806,7806,7807,7807,7808,7808,7809,7809,7809,7810,7810,7811,7811,7812,7812,7813,7813,7814,7814,7815,7815,7816,7816,7817,7817,7817,7818,7818,7819,7819,7820,7820,7821,7821,7822,7822,7823,7823,7824,7824,7824,7825,7825,7826,7826,7827,7827,7828,7828,7829,7829,7830,7830,7831,7831,7831,7832,7832,7833,7833,7834,7834,7835,7835,7836,7836,7836,7837,7837,7838,7838,7839,7839,7840,7840,7841,7841,7841,7842,7842,7843,7843,7844,7844,7845,7845,7846,7846,7846,7847,7847,7848,7848,7849,7849,7850,7850,7851,7851,7851,7852,7852,7853,7853,7854,7854,7855,7855,7855,7856,7856,7857,7857,7858,7858,7859,7859,7859,7860,7860,7861,7861,7862,7862,7862,7863,7863,7864,7864,7865,7865,7866,7866,7866,7867,7867,7868,7868,7869,7869,7870,7870,7870,7871,7871,7872,7872,7873,7873,7873,7874,7874,7875,7875,7876,7876,7876,7877,7877,7878,7878,7879,7879,7879,7880,7880,7881,7881,7882,7882,7882,7883,7883,7884,7884,7885,7885,7885,7886,7886,7887,7887,7888,7888,7888,7889,7889,7890,7890,7891,7891,7891,7892,7892,7893,7893,7893,7894,7894,7895,7895,7896,7896,7896,7897,7897,7898,7898,7898,7899,7899,7900,7900,7901,7901,7901,7902,7902,7903,7903,7903,7904,7904,7905,7905,7905,7906,7906,7907,7907,7908,7908,7908,7909,7909,7910,7910,7910,7911,7911,7912,7912,7912,7913,7913,7914,7914,7914,7915,7915,7916,7916,7916,7917,7917,7918,7918,7918,7919,7919,7920,7920,7921,7921,7921,7922,7922,7923,7923,7923,7924,7924,7924,7925,7925,7926,7926,7926,7927,7927,7928,7928,7928,7929,7929,7930,7930,7930,7931,7931,7932,7932,7932,7933,7933,7934,7934,7934,7935,7935,7936,7936,7936,7937,7937,7937,7938,7938,7939,7939,7939,7940,7940,7941,7941,7941,7942,7942,7942,7943,7943,7944,7944,7944,7945,7945,7946,7946,7946,7947,7947,7947,7948,7948,7949,7949,7949,7950,7950,7950,7951,7951,7952,7952,7952,7953,7953,7953,7954,7954,7955,7955,7955,7956,7956,7956,7957,7957,7958,7958,7958,7959,7959,7959,7960,7960,7961,7961,7961,7962,7962,7962,7963,7963,7964,7964,7964,7965,7965,7965,7966,7966,7966,7967,7967,7968,7968,7968,7969,7969,7969,7970,7970,7970,7971,7971,7972,7972,7972,7973,7973,7973,7974,7974,7974,7975,7975,7975,7976,7976,7977,7977,7977,7978,7978,7978,7979,7979,7979,7980,7980,7980,7981,7981,7982,7982,7982,7983,7983,7983,7984,7984,7984,7985,7985,7985,7986,7986,7986,7987,7987,7987,7988,7988,7989,7989,7989,7990,7990,7990,7991,7991,7991,7992,7992,7992,7993,7993,7993,7994,7994,7994,7995,7995,7995,7996,7996,7996,7997,7997,7997,7998,7998,7998,7999,7999,7999,8000,8000,8000,8001,8001,8001,8002,8002,8003,8003,8003,8004,8004,8004,8005,8005,8005,8006,8006,8006,8007,8007,8007,8007,8008,8008,8008,8009,8009,8009,8010,8010,8010,8011,8011,8011,8012,8012,8012,8013,8013,8013,8014,8014,8014,8015,8015,8015,8016,8016,8016,8017,8017,8017,8018,8018,8018,8019,8019,8019,8020,8020,8020,8020,8021,8021,8021,8022,8022,8022,8023,8023,8023,8024,8024,8024,8025,8025,8025,8026,8026,8026,8026,8027,8027,8027,8028,8028,8028,8029,8029,8029,8030,8030,8030,8031,8031,8031,8031,8032,8032,8032,8033,8033,8033,8034,8034,8034,8035,8035,8035,8035,8036,8036,8036,8037,8037,8037,8038,8038,8038,8038,8039,8039,8039,8040,8040,8040,8041,8041,8041,8041,8042,8042,8042,8043,8043,8043,8044,8044,8044,8044,8045,8045,8045,8046,8046,8046,8047,8047,8047,8047,8048,8048,8048,8049,8049,8049,8049,8050,8050,8050,8051,8051,8051,8051,8052,8052,8052,8053,8053,8053,8053,8054,8054,8054,8055,8055,8055,8055,8056,8056,8056,8057,8057,8057,8057,8058,8058,8058,8059,8059,8059,8059,8060,8060,8060,8061,8061,8061,8061,8062,8062,8062,8062,8063,8063,8063,8064,8064,8064,8064,8065,8065,8065,8066,8066,8066,8066,8067,8067,8067,8067,8068,8068,8068,8069,8069,8069,8069,8070,8070,8070,8070,8071,8071,8071,8071,8072,8072,8072,8073,8073,8073,8073,8074,8074,8074,8074,8075,8075,8075,8075,8076,8076,8076,8077,8077,8077,8077,8078,8078,8078,8078,8079,8079,8079,8079,8080,8080,8080,8080,8081,8081,8081,8081,8082,8082,8082,8082,8083,8083,8083,8083,8084,8084,8084,8084,8085,8085,8085,8085,8086,8086,8086,8086,8087,8087,8087,8087,8088,8088,8088,8088,8089,8089,8089,8089,8090,8090,8090,8090,8091,8091,8091,8091,8092,8092,8092,8092,8093,8093,8093,8093,8094,8094,8094,8094,8095,8095,8095,8095,8096,8096,8096,8096,8096,8097,8097,8097,8097,8098,8098,8098,8098,8099,8099,8099,8099,8100,8100,8100,8100,8100,8101,8101,8101,8101,8102,8102,8102,8102,8103,8103,8103,8103,8103,8104,8104,8104,8104,8105,8105,8105,8105,8106,8106,8106,8106,8106,8107,8107,8107,8107,8108,8108,8108,8108,8108,8109,8109,8109,8109,8110,8110,8110,8110,8110,8111,8111,8111,8111,8112,8112,8112,8112,8112,8113,8113,8113,8113,8113,8114,8114,8114,8114,8115,8115,8115,8115,8115,8116,8116,8116,8116,8116,8117,8117,8117,8117,8118,8118,8118,8118,8118,8119,8119,8119,8119,8119,8120,8120,8120,8120,8120,8121,8121,8121,8121,8121,8122,8122,8122,8122,8122,8123,8123,8123,8123,8123,8124,8124,8124,8124,8125,8125,8125,8125,8125,8125,8126,8126,8126,8126,8126,8127,8127,8127,8127,8127,8128,8128,8128,8128,8128,8129,8129,8129,8129,8129,8130,8130,8130,8130,8130,8131,8131,8131,8131,8131,8131,8132,8132,8132,8132,8132,8133,8133,8133,8133,8133,8134,8134,8134,8134,8134,8134,8135,8135,8135,8135,8135,8136,8136,8136,8136,8136,8136,8137,8137,8137,8137,8137,8138,8138,8138,8138,8138,8138,8139,8139,8139,8139,8139,8140,8140,8140,8140,8140,8140,8141,8141,8141,8141,8141,8141,8142,8142,8142,8142,8142,8142,8143,8143,8143,8143,8143,8143,8144,8144,8144,8144,8144,8144,8145,8145,8145,8145,8145,8145,8146,8146,8146,8146,8146,8146,8147,8147,8147,8147,8147,8147,8148,8148,8148,8148,8148,8148,8149,8149,8149,8149,8149,8149,8150,8150,8150,8150,8150,8150,8150,8151,8151,8151,8151,8151,8151,8152,8152,8152,8152,8152,8152,8152,8153,8153,8153,8153,8153,8153,8154,8154,8154,8154,8154,8154,8154,8155,8155,8155,8155,8155,8155,8155,8156,8156,8156,8156,8156,8156,8156,8157,8157,8157,8157,8157,8157,8157,8158,8158,8158,8158,8158,8158,8158,8159,8159,8159,8159,8159,8159,8159,8160,8160,8160,8160,8160,8160,8160,8161,8161,8161,8161,8161,8161,8161,8161,8162,8162,8162,8162,8162,8162,8162,8163,8163,8163,8163,8163,8163,8163,8163,8164,8164,8164,8164,8164,8164,8164,8164,8165,8165,8165,8165,8165,8165,8165,8165,8166,8166,8166,8166,8166,8166,8166,8166,8167,8167,8167,8167,8167,8167,8167,8167,8168,8168,8168,8168,8168,8168,8168,8168,8168,8169,8169,8169,8169,8169,8169,8169,8169,8169,8170,8170,8170,8170,8170,8170,8170,8170,8171,8171,8171,8171,8171,8171,8171,8171,8171,8171,8172,8172,8172,8172,8172,8172,8172,8172,8172,8173,8173,8173,8173,8173,8173,8173,8173,8173,8173,8174,8174,8174,8174,8174,8174,8174,8174,8174,8175,8175,8175,8175,8175,8175,8175,8175,8175,8175,8175,8176,8176,8176,8176,8176,8176,8176,8176,8176,8176,8177,8177,8177,8177,8177,8177,8177,8177,8177,8177,8177,8178,8178,8178,8178,8178,8178,8178,8178,8178,8178,8178,8179,8179,8179,8179,8179,8179,8179,8179,8179,8179,8179,8179,8180,8180,8180,8180,8180,8180,8180,8180,8180,8180,8180,8180,8181,8181,8181,8181,8181,8181,8181,8181,8181,8181,8181,8181,8181,8182,8182,8182,8182,8182,8182,8182,8182,8182,8182,8182,8182,8182,8182,8183,8183,8183,8183,8183,8183,8183,8183,8183,8183,8183,8183,8183,8183,8184,8184,8184,8184,8184,8184,8184,8184,8184,8184,8184,8184,8184,8184,8184,8184,8185,8185,8185,8185,8185,8185,8185,8185,8185,8185,8185,8185,8185,8185,8185,8185,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8186,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8187,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8188,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8189,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8190,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,8191,}
 #define SIN_TABLE_16384 {0,2,3,5,6,8,9,11,13,14,16,17,19,20,22,24,25,27,28,30,31,33,35,36,38,39,41,42,44,46,47,49,50,52,53,55,57,58,60,61,63,64,66,68,69,71,72,74,75,77,79,80,82,83,85,86,88,90,91,93,94,96,97,99,101,102,104,105,107,108,110,112,113,115,116,118,119,121,123,124,126,127,129,130,132,134,135,137,138,140,141,143,145,146,148,149,151,152,154,155,157,159,160,162,163,165,166,168,170,171,173,174,176,177,179,181,182,184,185,187,188,190,192,193,195,196,198,199,201,203,204,206,207,209,210,212,214,215,217,218,220,221,223,225,226,228,229,231,232,234,236,237,239,240,242,243,245,247,248,250,251,253,254,256,258,259,261,262,264,265,267,269,270,272,273,275,276,278,280,281,283,284,286,287,289,291,292,294,295,297,298,300,302,303,305,306,308,309,311,313,314,316,317,319,320,322,324,325,327,328,330,331,333,335,336,338,339,341,342,344,346,347,349,350,352,353,355,357,358,360,361,363,364,366,368,369,371,372,374,375,377,379,380,382,383,385,386,388,389,391,393,394,396,397,399,400,402,404,405,407,408,410,411,413,415,416,418,419,421,422,424,426,427,429,430,432,433,435,437,438,440,441,443,444,446,448,449,451,452,454,455,457,459,460,462,463,465,466,468,470,471,473,474,476,477,479,481,482,484,485,487,488,490,492,493,495,496,498,499,501,503,504,506,507,509,510,512,514,515,517,518,520,521,523,525,526,528,529,531,532,534,536,537,539,540,542,543,545,547,548,550,551,553,554,556,557,559,561,562,564,565,567,568,570,572,573,575,576,578,579,581,583,584,586,587,589,590,592,594,595,597,598,600,601,603,605,606,608,609,611,612,614,616,617,619,620,622,623,625,627,628,630,631,633,634,636,638,639,641,642,644,645,647,649,650,652,653,655,656,658,660,661,663,664,666,667,669,671,672,674,675,677,678,680,681,683,685,686,688,689,691,692,694,696,697,699,700,702,703,705,707,708,710,711,713,714,716,718,719,721,722,724,725,727,729,730,732,733,735,736,738,740,741,743,744,746,747,749,751,752,754,755,757,758,760,762,763,765,766,768,769,771,772,774,776,777,779,780,782,783,785,787,788,790,791,793,794,796,798,799,801,802,804,805,807,809,810,812,813,815,816,818,820,821,823,824,826,827,829,831,832,834,835,837,838,840,842,843,845,846,848,849,851,853,854,856,857,859,860,862,863,865,867,868,870,871,873,874,876,878,879,881,882,884,885,887,889,890,892,893,895,896,898,900,901,903,904,906,907,909,911,912,914,915,917,918,920,922,923,925,926,928,929,931,932,934,936,937,939,940,942,943,945,947,948,950,951,953,954,956,958,959,961,962,964,965,967,969,970,972,973,975,976,978,980,981,983,984,986,987,989,991,992,994,995,997,998,1000,1001,1003,1005,1006,1008,1009,1011,1012,1014,1016,1017,1019,1020,1022,1023,1025,1027,1028,1030,1031,1033,1034,1036,1038,1039,1041,1042,1044,1045,1047,1049,1050,1052,1053,1055,1056,1058,1059,1061,1063,1064,1066,1067,1069,1070,1072,1074,1075,1077,1078,1080,1081,1083,1085,1086,1088,1089,1091,1092,1094,1096,1097,1099,1100,1102,1103,1105,1107,1108,1110,1111,1113,1114,1116,1117,1119,1121,1122,1124,1125,1127,1128,1130,1132,1133,1135,1136,1138,1139,1141,1143,1144,1146,1147,1149,1150,1152,1154,1155,1157,1158,1160,1161,1163,1164,1166,1168,1169,1171,1172,1174,1175,1177,1179,1180,1182,1183,1185,1186,1188,1190,1191,1193,1194,1196,1197,1199,1201,1202,1204,1205,1207,1208,1210,1211,1213,1215,1216,1218,1219,1221,1222,1224,1226,1227,1229,1230,1232,1233,1235,1237,1238,1240,1241,1243,1244,1246,1247,1249,1251,1252,1254,1255,1257,1258,1260,1262,1263,1265,1266,1268,1269,1271,1273,1274,1276,1277,1279,1280,1282,1284,1285,1287,1288,1290,1291,1293,1294,1296,1298,1299,1301,1302,1304,1305,1307,1309,1310,1312,1313,1315,1316,1318,1320,1321,1323,1324,1326,1327,1329,1330,1332,1334,1335,1337,1338,1340,1341,1343,1345,1346,1348,1349,1351,1352,1354,1356,1357,1359,1360,1362,1363,1365,1366,1368,1370,1371,1373,1374,1376,1377,1379,1381,1382,1384,1385,1387,1388,1390,1392,1393,1395,1396,1398,1399,1401,1402,1404,1406,1407,1409,1410,1412,1413,1415,1417,1418,1420,1421,1423,1424,1426,1428,1429,1431,1432,1434,1435,1437,1438,1440,1442,1443,1445,1446,1448,1449,1451,1453,1454,1456,1457,1459,1460,1462,1464,1465,1467,1468,1470,1471,1473,1474,1476,1478,1479,1481,1482,1484,1485,1487,1489,1490,1492,1493,1495,1496,1498,1499,1501,1503,1504,1506,1507,1509,1510,1512,1514,1515,1517,1518,1520,1521,1523,1525,1526,1528,1529,1531,1532,1534,1535,1537,1539,1540,1542,1543,1545,1546,1548,1550,1551,1553,1554,1556,1557,1559,1560,1562,1564,1565,1567,1568,1570,1571,1573,1575,1576,1578,1579,1581,1582,1584,1585,1587,1589,1590,1592,1593,1595,1596,1598,1600,1601,1603,1604,1606,1607,1609,1611,1612,1614,1615,1617,1618,1620,1621,1623,1625,1626,1628,1629,1631,1632,1634,1636,1637,1639,1640,1642,1643,1645,1646,1648,1650,1651,1653,1654,1656,1657,1659,1661,1662,1664,1665,1667,1668,1670,1671,1673,1675,1676,1678,1679,1681,1682,1684,1686,1687,1689,1690,1692,1693,1695,1696,1698,1700,1701,1703,1704,1706,1707,1709,1711,1712,1714,1715,1717,1718,1720,1721,1723,1725,1726,1728,1729,1731,1732,1734,1736,1737,1739,1740,1742,1743,1745,1746,1748,1750,1751,1753,1754,1756,1757,1759,1760,1762,1764,1765,1767,1768,1770,1771,1773,1775,1776,1778,1779,1781,1782,1784,1785,1787,1789,1790,1792,1793,1795,1796,1798,1800,1801,1803,1804,1806,1807,1809,1810,1812,1814,1815,1817,1818,1820,1821,1823,1825,1826,1828,1829,1831,1832,1834,1835,1837,1839,1840,1842,1843,1845,1846,1848,1849,1851,1853,1854,1856,1857,1859,1860,1862,1864,1865,1867,1868,1870,1871,1873,1874,1876,1878,1879,1881,1882,1884,1885,1887,1888,1890,1892,1893,1895,1896,1898,1899,1901,1903,1904,1906,1907,1909,1910,1912,1913,1915,1917,1918,1920,1921,1923,1924,1926,1927,1929,1931,1932,1934,1935,1937,1938,1940,1942,1943,1945,1946,1948,1949,1951,1952,1954,1956,1957,1959,1960,1962,1963,1965,1966,1968,1970,1971,1973,1974,1976,1977,1979,1981,1982,1984,1985,1987,1988,1990,1991,1993,1995,1996,1998,1999,2001,2002,2004,2005,2007,2009,2010,2012,2013,2015,2016,2018,2019,2021,2023,2024,2026,2027,2029,2030,2032,2034,2035,2037,2038,2040,2041,2043,2044,2046,2048,2049,2051,2052,2054,2055,2057,2058,2060,2062,2063,2065,2066,2068,2069,2071,2072,2074,2076,2077,2079,2080,2082,2083,2085,2086,2088,2090,2091,2093,2094,2096,2097,2099,2101,2102,2104,2105,2107,2108,2110,2111,2113,2115,2116,2118,2119,2121,2122,2124,2125,2127,2129,2130,2132,2133,2135,2136,2138,2139,2141,2143,2144,2146,2147,2149,2150,2152,2153,2155,2157,2158,2160,2161,2163,2164,2166,2167,2169,2171,2172,2174,2175,2177,2178,2180,2181,2183,2185,2186,2188,2189,2191,2192,2194,2195,2197,2199,2200,2202,2203,2205,2206,2208,2210,2211,2213,2214,2216,2217,2219,2220,2222,2224,2225,2227,2228,2230,2231,2233,2234,2236,2238,2239,2241,2242,2244,2245,2247,2248,2250,2252,2253,2255,2256,2258,2259,2261,2262,2264,2266,2267,2269,2270,2272,2273,2275,2276,2278,2280,2281,2283,2284,2286,2287,2289,2290,2292,2294,2295,2297,2298,2300,2301,2303,2304,2306,2308,2309,2311,2312,2314,2315,2317,2318,2320,2322,2323,2325,2326,2328,2329,2331,2332,2334,2336,2337,2339,2340,2342,2343,2345,2346,2348,2349,2351,2353,2354,2356,2357,2359,2360,2362,2363,2365,2367,2368,2370,2371,2373,2374,2376,2377,2379,2381,2382,2384,2385,2387,2388,2390,2391,2393,2395,2396,2398,2399,2401,2402,2404,2405,2407,2409,2410,2412,2413,2415,2416,2418,2419,2421,2423,2424,2426,2427,2429,2430,2432,2433,2435,2437,2438,2440,2441,2443,2444,2446,2447,2449,2450,2452,2454,2455,2457,2458,2460,2461,2463,2464,2466,2468,2469,2471,2472,2474,2475,2477,2478,2480,2482,2483,2485,2486,2488,2489,2491,2492,2494,2496,2497,2499,2500,2502,2503,2505,2506,2508,2509,2511,2513,2514,2516,2517,2519,2520,2522,2523,2525,2527,2528,2530,2531,2533,2534,2536,2537,2539,2541,2542,2544,2545,2547,2548,2550,2551,2553,2554,2556,2558,2559,2561,2562,2564,2565,2567,2568,2570,2572,2573,2575,2576,2578,2579,2581,2582,2584,2586,2587,2589,2590,2592,2593,2595,2596,2598,2599,2601,2603,2604,2606,2607,2609,2610,2612,2613,2615,2617,2618,2620,2621,2623,2624,2626,2627,2629,2630,2632,2634,2635,2637,2638,2640,2641,2643,2644,2646,2648,2649,2651,2652,2654,2655,2657,2658,2660,2661,2663,2665,2666,2668,2669,2671,2672,2674,2675,2677,2679,2680,2682,2683,2685,2686,2688,2689,2691,2692,2694,2696,2697,2699,2700,2702,2703,2705,2706,2708,2710,2711,2713,2714,2716,2717,2719,2720,2722,2723,2725,2727,2728,2730,2731,2733,2734,2736,2737,2739,2740,2742,2744,2745,2747,2748,2750,2751,2753,2754,2756,2758,2759,2761,2762,2764,2765,2767,2768,2770,2771,2773,2775,2776,2778,2779,2781,2782,2784,2785,2787,2788,2790,2792,2793,2795,2796,2798,2799,2801,2802,2804,2806,2807,2809,2810,2812,2813,2815,2816,2818,2819,2821,2823,2824,2826,2827,2829,2830,2832,2833,2835,2836,2838,2840,2841,2843,2844,2846,2847,2849,2850,2852,2853,2855,2857,2858,2860,2861,2863,2864,2866,2867,2869,2870,2872,2874,2875,2877,2878,2880,2881,2883,2884,2886,2887,2889,2891,2892,2894,2895,2897,2898,2900,2901,2903,2904,2906,2908,2909,2911,2912,2914,2915,2917,2918,2920,2922,2923,2925,2926,2928,2929,2931,2932,2934,2935,2937,2938,2940,2942,2943,2945,2946,2948,2949,2951,2952,2954,2955,2957,2959,2960,2962,2963,2965,2966,2968,2969,2971,2972,2974,2976,2977,2979,2980,2982,2983,2985,2986,2988,2989,2991,2993,2994,2996,2997,2999,3000,3002,3003,3005,3006,3008,3010,3011,3013,3014,3016,3017,3019,3020,3022,3023,3025,3027,3028,3030,3031,3033,3034,3036,3037,3039,3040,3042,3044,3045,3047,3048,3050,3051,3053,3054,3056,3057,3059,3060,3062,3064,3065,3067,3068,3070,3071,3073,3074,3076,3077,3079,3081,3082,3084,3085,3087,3088,3090,3091,3093,3094,3096,3098,3099,3101,3102,3104,3105,3107,3108,3110,3111,3113,3114,3116,3118,3119,3121,3122,3124,3125,3127,3128,3130,3131,3133,3135,3136,3138,3139,3141,3142,3144,3145,3147,3148,3150,3151,3153,3155,3156,3158,3159,3161,3162,3164,3165,3167,3168,3170,3172,3173,3175,3176,3178,3179,3181,3182,3184,3185,3187,3188,3190,3192,3193,3195,3196,3198,3199,3201,3202,3204,3205,3207,3208,3210,3212,3213,3215,3216,3218,3219,3221,3222,3224,3225,3227,3229,3230,3232,3233,3235,3236,3238,3239,3241,3242,3244,3245,3247,3249,3250,3252,3253,3255,3256,3258,3259,3261,3262,3264,3265,3267,3269,3270,3272,3273,3275,3276,3278,3279,3281,3282,3284,3285,3287,3289,3290,3292,3293,3295,3296,3298,3299,3301,3302,3304,3305,3307,3309,3310,3312,3313,3315,3316,3318,3319,3321,3322,3324,3325,3327,3329,3330,3332,3333,3335,3336,3338,3339,3341,3342,3344,3345,3347,3349,3350,3352,3353,3355,3356,3358,3359,3361,3362,3364,3365,3367,3369,3370,3372,3373,3375,3376,3378,3379,3381,3382,3384,3385,3387,3388,3390,3392,3393,3395,3396,3398,3399,3401,3402,3404,3405,3407,3408,3410,3412,3413,3415,3416,3418,3419,3421,3422,3424,3425,3427,3428,3430,3432,3433,3435,3436,3438,3439,3441,3442,3444,3445,3447,3448,3450,3451,3453,3455,3456,3458,3459,3461,3462,3464,3465,3467,3468,3470,3471,3473,3475,3476,3478,3479,3481,3482,3484,3485,3487,3488,3490,3491,3493,3494,3496,3498,3499,3501,3502,3504,3505,3507,3508,3510,3511,3513,3514,3516,3517,3519,3521,3522,3524,3525,3527,3528,3530,3531,3533,3534,3536,3537,3539,3540,3542,3544,3545,3547,3548,3550,3551,3553,3554,3556,3557,3559,3560,3562,3563,3565,3567,3568,3570,3571,3573,3574,3576,3577,3579,3580,3582,3583,3585,3586,3588,3590,3591,3593,3594,3596,3597,3599,3600,3602,3603,3605,3606,3608,3609,3611,3613,3614,3616,3617,3619,3620,3622,3623,3625,3626,3628,3629,3631,3632,3634,3635,3637,3639,3640,3642,3643,3645,3646,3648,3649,3651,3652,3654,3655,3657,3658,3660,3662,3663,3665,3666,3668,3669,3671,3672,3674,3675,3677,3678,3680,3681,3683,3684,3686,3688,3689,3691,3692,3694,3695,3697,3698,3700,3701,3703,3704,3706,3707,3709,3711,3712,3714,3715,3717,3718,3720,3721,3723,3724,3726,3727,3729,3730,3732,3733,3735,3737,3738,3740,3741,3743,3744,3746,3747,3749,3750,3752,3753,3755,3756,3758,3759,3761,3762,3764,3766,3767,3769,3770,3772,3773,3775,3776,3778,3779,3781,3782,3784,3785,3787,3788,3790,3792,3793,3795,3796,3798,3799,3801,3802,3804,3805,3807,3808,3810,3811,3813,3814,3816,3818,3819,3821,3822,3824,3825,3827,3828,3830,3831,3833,3834,3836,3837,3839,3840,3842,3843,3845,3847,3848,3850,3851,3853,3854,3856,3857,3859,3860,3862,3863,3865,3866,3868,3869,3871,3872,3874,3876,3877,3879,3880,3882,3883,3885,3886,3888,3889,3891,3892,3894,3895,3897,3898,3900,3901,3903,3905,3906,3908,3909,3911,3912,3914,3915,3917,3918,3920,3921,3923,3924,3926,3927,3929,3930,3932,3933,3935,3937,3938,3940,3941,3943,3944,3946,3947,3949,3950,3952,3953,3955,3956,3958,3959,3961,3962,3964,3966,3967,3969,3970,3972,3973,3975,3976,3978,3979,3981,3982,3984,3985,3987,3988,3990,3991,3993,3994,3996,3998,3999,4001,4002,4004,4005,4007,4008,4010,4011,4013,4014,4016,4017,4019,4020,4022,4023,4025,4026,4028,4029,4031,4033,4034,4036,4037,4039,4040,4042,4043,4045,4046,4048,4049,4051,4052,4054,4055,4057,4058,4060,4061,4063,4064,4066,4068,4069,4071,4072,4074,4075,4077,4078,4080,4081,4083,4084,4086,4087,4089,4090,4092,4093,4095,4096,4098,4099,4101,4103,4104,4106,4107,4109,4110,4112,4113,4115,4116,4118,4119,4121,4122,4124,4125,4127,4128,4130,4131,4133,4134,4136,4137,4139,4141,4142,4144,4145,4147,4148,4150,4151,4153,4154,4156,4157,4159,4160,4162,4163,4165,4166,4168,4169,4171,4172,4174,4175,4177,4179,4180,4182,4183,4185,4186,4188,4189,4191,4192,4194,4195,4197,4198,4200,4201,4203,4204,4206,4207,4209,4210,4212,4213,4215,4216,4218,4219,4221,4223,4224,4226,4227,4229,4230,4232,4233,4235,4236,4238,4239,4241,4242,4244,4245,4247,4248,4250,4251,4253,4254,4256,4257,4259,4260,4262,4263,4265,4267,4268,4270,4271,4273,4274,4276,4277,4279,4280,4282,4283,4285,4286,4288,4289,4291,4292,4294,4295,4297,4298,4300,4301,4303,4304,4306,4307,4309,4310,4312,4314,4315,4317,4318,4320,4321,4323,4324,4326,4327,4329,4330,4332,4333,4335,4336,4338,4339,4341,4342,4344,4345,4347,4348,4350,4351,4353,4354,4356,4357,4359,4360,4362,4363,4365,4367,4368,4370,4371,4373,4374,4376,4377,4379,4380,4382,4383,4385,4386,4388,4389,4391,4392,4394,4395,4397,4398,4400,4401,4403,4404,4406,4407,4409,4410,4412,4413,4415,4416,4418,4419,4421,4423,4424,4426,4427,4429,4430,4432,4433,4435,4436,4438,4439,4441,4442,4444,4445,4447,4448,4450,4451,4453,4454,4456,4457,4459,4460,4462,4463,4465,4466,4468,4469,4471,4472,4474,4475,4477,4478,4480,4481,4483,4484,4486,4488,4489,4491,4492,4494,4495,4497,4498,4500,4501,4503,4504,4506,4507,4509,4510,4512,4513,4515,4516,4518,4519,4521,4522,4524,4525,4527,4528,4530,4531,4533,4534,4536,4537,4539,4540,4542,4543,4545,4546,4548,4549,4551,4552,4554,4555,4557,4558,4560,4561,4563,4564,4566,4568,4569,4571,4572,4574,4575,4577,4578,4580,4581,4583,4584,4586,4587,4589,4590,4592,4593,4595,4596,4598,4599,4601,4602,4604,4605,4607,4608,4610,4611,4613,4614,4616,4617,4619,4620,4622,4623,4625,4626,4628,4629,4631,4632,4634,4635,4637,4638,4640,4641,4643,4644,4646,4647,4649,4650,4652,4653,4655,4656,4658,4659,4661,4662,4664,4665,4667,4668,4670,4671,4673,4675,4676,4678,4679,4681,4682,4684,4685,4687,4688,4690,4691,4693,4694,4696,4697,4699,4700,4702,4703,4705,4706,4708,4709,4711,4712,4714,4715,4717,4718,4720,4721,4723,4724,4726,4727,4729,4730,4732,4733,4735,4736,4738,4739,4741,4742,4744,4745,4747,4748,4750,4751,4753,4754,4756,4757,4759,4760,4762,4763,4765,4766,4768,4769,4771,4772,4774,4775,4777,4778,4780,4781,4783,4784,4786,4787,4789,4790,4792,4793,4795,4796,4798,4799,4801,4802,4804,4805,4807,4808,4810,4811,4813,4814,4816,4817,4819,4820,4822,4823,4825,4826,4828,4829,4831,4832,4834,4835,4837,4838,4840,4841,4843,4844,4846,4847,4849,4850,4852,4853,4855,4856,4858,4859,4861,4862,4864,4865,4867,4868,4870,4871,4873,4874,4876,4877,4879,4880,4882,4883,4885,4886,4888,4889,4891,4892,4894,4895,4897,4898,4900,4901,4903,4904,4906,4907,4909,4910,4912,4913,4915,4916,4918,4919,4921,4922,4924,4925,4927,4928,4930,4931,4933,4934,4936,4937,4939,4940,4942,4943,4945,4946,4948,4949,4951,4952,4954,4955,4957,4958,4960,4961,4963,4964,4966,4967,4969,4970,4972,4973,4975,4976,4978,4979,4981,4982,4984,4985,4987,4988,4990,4991,4993,4994,4996,4997,4999,5000,5002,5003,5005,5006,5008,5009,5011,5012,5014,5015,5017,5018,5020,5021,5023,5024,5026,5027,5029,5030,5032,5033,5035,5036,5038,5039,5041,5042,5044,5045,5046,5048,5049,5051,5052,5054,5055,5057,5058,5060,5061,5063,5064,5066,5067,5069,5070,5072,5073,5075,5076,5078,5079,5081,5082,5084,5085,5087,5088,5090,5091,5093,5094,5096,5097,5099,5100,5102,5103,5105,5106,5108,5109,5111,5112,5114,5115,5117,5118,5120,5121,5123,5124,5126,5127,5129,5130,5132,5133,5135,5136,5138,5139,5141,5142,5144,5145,5147,5148,5149,5151,5152,5154,5155,5157,5158,5160,5161,5163,5164,5166,5167,5169,5170,5172,5173,5175,5176,5178,5179,5181,5182,5184,5185,5187,5188,5190,5191,5193,5194,5196,5197,5199,5200,5202,5203,5205,5206,5208,5209,5211,5212,5214,5215,5217,5218,5220,5221,5222,5224,5225,5227,5228,5230,5231,5233,5234,5236,5237,5239,5240,5242,5243,5245,5246,5248,5249,5251,5252,5254,5255,5257,5258,5260,5261,5263,5264,5266,5267,5269,5270,5272,5273,5275,5276,5278,5279,5281,5282,5283,5285,5286,5288,5289,5291,5292,5294,5295,5297,5298,5300,5301,5303,5304,5306,5307,5309,5310,5312,5313,5315,5316,5318,5319,5321,5322,5324,5325,5327,5328,5330,5331,5333,5334,5335,5337,5338,5340,5341,5343,5344,5346,5347,5349,5350,5352,5353,5355,5356,5358,5359,5361,5362,5364,5365,5367,5368,5370,5371,5373,5374,5376,5377,5379,5380,5382,5383,5384,5386,5387,5389,5390,5392,5393,5395,5396,5398,5399,5401,5402,5404,5405,5407,5408,5410,5411,5413,5414,5416,5417,5419,5420,5422,5423,5425,5426,5427,5429,5430,5432,5433,5435,5436,5438,5439,5441,5442,5444,5445,5447,5448,5450,5451,5453,5454,5456,5457,5459,5460,5462,5463,5465,5466,5467,5469,5470,5472,5473,5475,5476,5478,5479,5481,5482,5484,5485,5487,5488,5490,5491,5493,5494,5496,5497,5499,5500,5502,5503,5504,5506,5507,5509,5510,5512,5513,5515,5516,5518,5519,5521,5522,5524,5525,5527,5528,5530,5531,5533,5534,5536,5537,5538,5540,5541,5543,5544,5546,5547,5549,5550,5552,5553,5555,5556,5558,5559,5561,5562,5564,5565,5567,5568,5570,5571,5572,5574,5575,5577,5578,5580,5581,5583,5584,5586,5587,5589,5590,5592,5593,5595,5596,5598,5599,5601,5602,5603,5605,5606,5608,5609,5611,5612,5614,5615,5617,5618,5620,5621,5623,5624,5626,5627,5629,5630,5632,5633,5634,5636,5637,5639,5640,5642,5643,5645,5646,5648,5649,5651,5652,5654,5655,5657,5658,5660,5661,5662,5664,5665,5667,5668,5670,5671,5673,5674,5676,5677,5679,5680,5682,5683,5685,5686,5688,5689,5690,5692,5693,5695,5696,5698,5699,5701,5702,5704,5705,5707,5708,5710,5711,5713,5714,5716,5717,5718,5720,5721,5723,5724,5726,5727,5729,5730,5732,5733,5735,5736,5738,5739,5741,5742,5743,5745,5746,5748,5749,5751,5752,5754,5755,5757,5758,5760,5761,5763,5764,5766,5767,5768,5770,5771,5773,5774,5776,5777,5779,5780,5782,5783,5785,5786,5788,5789,5791,5792,5793,5795,5796,5798,5799,5801,5802,5804,5805,5807,5808,5810,5811,5813,5814,5815,5817,5818,5820,5821,5823,5824,5826,5827,5829,5830,5832,5833,5835,5836,5837,5839,5840,5842,5843,5845,5846,5848,5849,5851,5852,5854,5855,5857,5858,5860,5861,5862,5864,5865,5867,5868,5870,5871,5873,5874,5876,5877,5879,5880,5882,5883,5884,5886,5887,5889,5890,5892,5893,5895,5896,5898,5899,5901,5902,5903,5905,5906,5908,5909,5911,5912,5914,5915,5917,5918,5920,5921,5923,5924,5925,5927,5928,5930,5931,5933,5934,5936,5937,5939,5940,5942,5943,5944,5946,5947,5949,5950,5952,5953,5955,5956,5958,5959,5961,5962,5964,5965,5966,5968,5969,5971,5972,5974,5975,5977,5978,5980,5981,5983,5984,5985,5987,5988,5990,5991,5993,5994,5996,5997,5999,6000,6002,6003,6004,6006,6007,6009,6010,6012,6013,6015,6016,6018,6019,6021,6022,6023,6025,6026,6028,6029,6031,6032,6034,6035,6037,6038,6040,6041,6042,6044,6045,6047,6048,6050,6051,6053,6054,6056,6057,6058,6060,6061,6063,6064,6066,6067,6069,6070,6072,6073,6075,6076,6077,6079,6080,6082,6083,6085,6086,6088,6089,6091,6092,6093,6095,6096,6098,6099,6101,6102,6104,6105,6107,6108,6110,6111,6112,6114,6115,6117,6118,6120,6121,6123,6124,6126,6127,6128,6130,6131,6133,6134,6136,6137,6139,6140,6142,6143,6144,6146,6147,6149,6150,6152,6153,6155,6156,6158,6159,6161,6162,6163,6165,6166,6168,6169,6171,6172,6174,6175,6177,6178,6179,6181,6182,6184,6185,6187,6188,6190,6191,6193,6194,6195,6197,6198,6200,6201,6203,6204,6206,6207,6209,6210,6211,6213,6214,6216,6217,6219,6220,6222,6223,6224,6226,6227,6229,6230,6232,6233,6235,6236,6238,6239,6240,6242,6243,6245,6246,6248,6249,6251,6252,6254,6255,6256,6258,6259,6261,6262,6264,6265,6267,6268,6270,6271,6272,6274,6275,6277,6278,6280,6281,6283,6284,6285,6287,6288,6290,6291,6293,6294,6296,6297,6299,6300,6301,6303,6304,6306,6307,6309,6310,6312,6313,6314,6316,6317,6319,6320,6322,6323,6325,6326,6328,6329,6330,6332,6333,6335,6336,6338,6339,6341,6342,6343,6345,6346,6348,6349,6351,6352,6354,6355,6356,6358,6359,6361,6362,6364,6365,6367,6368,6369,6371,6372,6374,6375,6377,6378,6380,6381,6383,6384,6385,6387,6388,6390,6391,6393,6394,6396,6397,6398,6400,6401,6403,6404,6406,6407,6409,6410,6411,6413,6414,6416,6417,6419,6420,6422,6423,6424,6426,6427,6429,6430,6432,6433,6435,6436,6437,6439,6440,6442,6443,6445,6446,6448,6449,6450,6452,6453,6455,6456,6458,6459,6461,6462,6463,6465,6466,6468,6469,6471,6472,6474,6475,6476,6478,6479,6481,6482,6484,6485,6487,6488,6489,6491,6492,6494,6495,6497,6498,6499,6501,6502,6504,6505,6507,6508,6510,6511,6512,6514,6515,6517,6518,6520,6521,6523,6524,6525,6527,6528,6530,6531,6533,6534,6536,6537,6538,6540,6541,6543,6544,6546,6547,6548,6550,6551,6553,6554,6556,6557,6559,6560,6561,6563,6564,6566,6567,6569,6570,6572,6573,6574,6576,6577,6579,6580,6582,6583,6584,6586,6587,6589,6590,6592,6593,6595,6596,6597,6599,6600,6602,6603,6605,6606,6607,6609,6610,6612,6613,6615,6616,6618,6619,6620,6622,6623,6625,6626,6628,6629,6630,6632,6633,6635,6636,6638,6639,6641,6642,6643,6645,6646,6648,6649,6651,6652,6653,6655,6656,6658,6659,6661,6662,6663,6665,6666,6668,6669,6671,6672,6674,6675,6676,6678,6679,6681,6682,6684,6685,6686,6688,6689,6691,6692,6694,6695,6696,6698,6699,6701,6702,6704,6705,6706,6708,6709,6711,6712,6714,6715,6717,6718,6719,6721,6722,6724,6725,6727,6728,6729,6731,6732,6734,6735,6737,6738,6739,6741,6742,6744,6745,6747,6748,6749,6751,6752,6754,6755,6757,6758,6759,6761,6762,6764,6765,6767,6768,6769,6771,6772,6774,6775,6777,6778,6779,6781,6782,6784,6785,6787,6788,6790,6791,6792,6794,6795,6797,6798,6800,6801,6802,6804,6805,6807,6808,6810,6811,6812,6814,6815,6817,6818,6820,6821,6822,6824,6825,6827,6828,6830,6831,6832,6834,6835,6837,6838,6839,6841,6842,6844,6845,6847,6848,6849,6851,6852,6854,6855,6857,6858,6859,6861,6862,6864,6865,6867,6868,6869,6871,6872,6874,6875,6877,6878,6879,6881,6882,6884,6885,6887,6888,6889,6891,6892,6894,6895,6897,6898,6899,6901,6902,6904,6905,6907,6908,6909,6911,6912,6914,6915,6916,6918,6919,6921,6922,6924,6925,6926,6928,6929,6931,6932,6934,6935,6936,6938,6939,6941,6942,6944,6945,6946,6948,6949,6951,6952,6953,6955,6956,6958,6959,6961,6962,6963,6965,6966,6968,6969,6971,6972,6973,6975,6976,6978,6979,6980,6982,6983,6985,6986,6988,6989,6990,6992,6993,6995,6996,6998,6999,7000,7002,7003,7005,7006,7007,7009,7010,7012,7013,7015,7016,7017,7019,7020,7022,7023,7025,7026,7027,7029,7030,7032,7033,7034,7036,7037,7039,7040,7042,7043,7044,7046,7047,7049,7050,7051,7053,7054,7056,7057,7059,7060,7061,7063,7064,7066,7067,7068,7070,7071,7073,7074,7076,7077,7078,7080,7081,7083,7084,7085,7087,7088,7090,7091,7093,7094,7095,7097,7098,7100,7101,7102,7104,7105,7107,7108,7110,7111,7112,7114,7115,7117,7118,7119,7121,7122,7124,7125,7127,7128,7129,7131,7132,7134,7135,7136,7138,7139,7141,7142,7143,7145,7146,7148,7149,7151,7152,7153,7155,7156,7158,7159,7160,7162,7163,7165,7166,7167,7169,7170,7172,7173,7175,7176,7177,7179,7180,7182,7183,7184,7186,7187,7189,7190,7191,7193,7194,7196,7197,7199,7200,7201,7203,7204,7206,7207,7208,7210,7211,7213,7214,7215,7217,7218,7220,7221,7223,7224,7225,7227,7228,7230,7231,7232,7234,7235,7237,7238,7239,7241,7242,7244,7245,7246,7248,7249,7251,7252,7254,7255,7256,7258,7259,7261,7262,7263,7265,7266,7268,7269,7270,7272,7273,7275,7276,7277,7279,7280,7282,7283,7284,7286,7287,7289,7290,7292,7293,7294,7296,7297,7299,7300,7301,7303,7304,7306,7307,7308,7310,7311,7313,7314,7315,7317,7318,7320,7321,7322,7324,7325,7327,7328,7329,7331,7332,7334,7335,7337,7338,7339,7341,7342,7344,7345,7346,7348,7349,7351,7352,7353,7355,7356,7358,7359,7360,7362,7363,7365,7366,7367,7369,7370,7372,7373,7374,7376,7377,7379,7380,7381,7383,7384,7386,7387,7388,7390,7391,7393,7394,7395,7397,7398,7400,7401,7402,7404,7405,7407,7408,7409,7411,7412,7414,7415,7416,7418,7419,7421,7422,7423,7425,7426,7428,7429,7430,7432,7433,7435,7436,7437,7439,7440,7442,7443,7444,7446,7447,7449,7450,7451,7453,7454,7456,7457,7458,7460,7461,7463,7464,7465,7467,7468,7470,7471,7472,7474,7475,7477,7478,7479,7481,7482,7484,7485,7486,7488,7489,7491,7492,7493,7495,7496,7498,7499,7500,7502,7503,7505,7506,7507,7509,7510,7512,7513,7514,7516,7517,7519,7520,7521,7523,7524,7525,7527,7528,7530,7531,7532,7534,7535,7537,7538,7539,7541,7542,7544,7545,7546,7548,7549,7551,7552,7553,7555,7556,7558,7559,7560,7562,7563,7565,7566,7567,7569,7570,7571,7573,7574,7576,7577,7578,7580,7581,7583,7584,7585,7587,7588,7590,7591,7592,7594,7595,7597,7598,7599,7601,7602,7604,7605,7606,7608,7609,7610,7612,7613,7615,7616,7617,7619,7620,7622,7623,7624,7626,7627,7629,7630,7631,7633,7634,7635,7637,7638,7640,7641,7642,7644,7645,7647,7648,7649,7651,7652,7654,7655,7656,7658,7659,7660,7662,7663,7665,7666,7667,7669,7670,7672,7673,7674,7676,7677,7679,7680,7681,7683,7684,7685,7687,7688,7690,7691,7692,7694,7695,7697,7698,7699,7701,7702,7703,7705,7706,7708,7709,7710,7712,7713,7715,7716,7717,7719,7720,7722,7723,7724,7726,7727,7728,7730,7731,7733,7734,7735,7737,7738,7740,7741,7742,7744,7745,7746,7748,7749,7751,7752,7753,7755,7756,7758,7759,7760,7762,7763,7764,7766,7767,7769,7770,7771,7773,7774,7775,7777,7778,7780,7781,7782,7784,7785,7787,7788,7789,7791,7792,7793,7795,7796,7798,7799,7800,7802,7803,7804,7806,7807,7809,7810,7811,7813,7814,7816,7817,7818,7820,7821,7822,7824,7825,7827,7828,7829,7831,7832,7833,7835,7836,7838,7839,7840,7842,7843,7845,7846,7847,7849,7850,7851,7853,7854,7856,7857,7858,7860,7861,7862,7864,7865,7867,7868,7869,7871,7872,7873,7875,7876,7878,7879,7880,7882,7883,7884,7886,7887,7889,7890,7891,7893,7894,7895,7897,7898,7900,7901,7902,7904,7905,7906,7908,7909,7911,7912,7913,7915,7916,7917,7919,7920,7922,7923,7924,7926,7927,7928,7930,7931,7933,7934,7935,7937,7938,7939,7941,7942,7944,7945,7946,7948,7949,7950,7952,7953,7955,7956,7957,7959,7960,7961,7963,7964,7966,7967,7968,7970,7971,7972,7974,7975,7977,7978,7979,7981,7982,7983,7985,7986,7988,7989,7990,7992,7993,7994,7996,7997,7999,8000,8001,8003,8004,8005,8007,8008,8009,8011,8012,8014,8015,8016,8018,8019,8020,8022,8023,8025,8026,8027,8029,8030,8031,8033,8034,8035,8037,8038,8040,8041,8042,8044,8045,8046,8048,8049,8051,8052,8053,8055,8056,8057,8059,8060,8061,8063,8064,8066,8067,8068,8070,8071,8072,8074,8075,8077,8078,8079,8081,8082,8083,8085,8086,8087,8089,8090,8092,8093,8094,8096,8097,8098,8100,8101,8102,8104,8105,8107,8108,8109,8111,8112,8113,8115,8116,8117,8119,8120,8122,8123,8124,8126,8127,8128,8130,8131,8132,8134,8135,8137,8138,8139,8141,8142,8143,8145,8146,8147,8149,8150,8152,8153,8154,8156,8157,8158,8160,8161,8162,8164,8165,8167,8168,8169,8171,8172,8173,8175,8176,8177,8179,8180,8182,8183,8184,8186,8187,8188,8190,8191,8192,8194,8195,8196,8198,8199,8201,8202,8203,8205,8206,8207,8209,8210,8211,8213,8214,8216,8217,8218,8220,8221,8222,8224,8225,8226,8228,8229,8230,8232,8233,8235,8236,8237,8239,8240,8241,8243,8244,8245,8247,8248,8249,8251,8252,8254,8255,8256,8258,8259,8260,8262,8263,8264,8266,8267,8268,8270,8271,8273,8274,8275,8277,8278,8279,8281,8282,8283,8285,8286,8287,8289,8290,8292,8293,8294,8296,8297,8298,8300,8301,8302,8304,8305,8306,8308,8309,8310,8312,8313,8315,8316,8317,8319,8320,8321,8323,8324,8325,8327,8328,8329,8331,8332,8333,8335,8336,8338,8339,8340,8342,8343,8344,8346,8347,8348,8350,8351,8352,8354,8355,8356,8358,8359,8360,8362,8363,8365,8366,8367,8369,8370,8371,8373,8374,8375,8377,8378,8379,8381,8382,8383,8385,8386,8387,8389,8390,8392,8393,8394,8396,8397,8398,8400,8401,8402,8404,8405,8406,8408,8409,8410,8412,8413,8414,8416,8417,8419,8420,8421,8423,8424,8425,8427,8428,8429,8431,8432,8433,8435,8436,8437,8439,8440,8441,8443,8444,8445,8447,8448,8449,8451,8452,8454,8455,8456,8458,8459,8460,8462,8463,8464,8466,8467,8468,8470,8471,8472,8474,8475,8476,8478,8479,8480,8482,8483,8484,8486,8487,8488,8490,8491,8492,8494,8495,8497,8498,8499,8501,8502,8503,8505,8506,8507,8509,8510,8511,8513,8514,8515,8517,8518,8519,8521,8522,8523,8525,8526,8527,8529,8530,8531,8533,8534,8535,8537,8538,8539,8541,8542,8543,8545,8546,8548,8549,8550,8552,8553,8554,8556,8557,8558,8560,8561,8562,8564,8565,8566,8568,8569,8570,8572,8573,8574,8576,8577,8578,8580,8581,8582,8584,8585,8586,8588,8589,8590,8592,8593,8594,8596,8597,8598,8600,8601,8602,8604,8605,8606,8608,8609,8610,8612,8613,8614,8616,8617,8618,8620,8621,8622,8624,8625,8626,8628,8629,8630,8632,8633,8634,8636,8637,8638,8640,8641,8642,8644,8645,8646,8648,8649,8650,8652,8653,8654,8656,8657,8658,8660,8661,8662,8664,8665,8666,8668,8669,8670,8672,8673,8674,8676,8677,8678,8680,8681,8682,8684,8685,8686,8688,8689,8690,8692,8693,8694,8696,8697,8698,8700,8701,8702,8704,8705,8706,8708,8709,8710,8712,8713,8714,8716,8717,8718,8720,8721,8722,8724,8725,8726,8728,8729,8730,8732,8733,8734,8736,8737,8738,8740,8741,8742,8744,8745,8746,8748,8749,8750,8752,8753,8754,8756,8757,8758,8760,8761,8762,8764,8765,8766,8768,8769,8770,8772,8773,8774,8775,8777,8778,8779,8781,8782,8783,8785,8786,8787,8789,8790,8791,8793,8794,8795,8797,8798,8799,8801,8802,8803,8805,8806,8807,8809,8810,8811,8813,8814,8815,8817,8818,8819,8821,8822,8823,8824,8826,8827,8828,8830,8831,8832,8834,8835,8836,8838,8839,8840,8842,8843,8844,8846,8847,8848,8850,8851,8852,8854,8855,8856,8858,8859,8860,8862,8863,8864,8865,8867,8868,8869,8871,8872,8873,8875,8876,8877,8879,8880,8881,8883,8884,8885,8887,8888,8889,8891,8892,8893,8895,8896,8897,8898,8900,8901,8902,8904,8905,8906,8908,8909,8910,8912,8913,8914,8916,8917,8918,8920,8921,8922,8924,8925,8926,8927,8929,8930,8931,8933,8934,8935,8937,8938,8939,8941,8942,8943,8945,8946,8947,8949,8950,8951,8952,8954,8955,8956,8958,8959,8960,8962,8963,8964,8966,8967,8968,8970,8971,8972,8974,8975,8976,8977,8979,8980,8981,8983,8984,8985,8987,8988,8989,8991,8992,8993,8995,8996,8997,8998,9000,9001,9002,9004,9005,9006,9008,9009,9010,9012,9013,9014,9016,9017,9018,9019,9021,9022,9023,9025,9026,9027,9029,9030,9031,9033,9034,9035,9037,9038,9039,9040,9042,9043,9044,9046,9047,9048,9050,9051,9052,9054,9055,9056,9057,9059,9060,9061,9063,9064,9065,9067,9068,9069,9071,9072,9073,9074,9076,9077,9078,9080,9081,9082,9084,9085,9086,9088,9089,9090,9091,9093,9094,9095,9097,9098,9099,9101,9102,9103,9105,9106,9107,9108,9110,9111,9112,9114,9115,9116,9118,9119,9120,9121,9123,9124,9125,9127,9128,9129,9131,9132,9133,9135,9136,9137,9138,9140,9141,9142,9144,9145,9146,9148,9149,9150,9151,9153,9154,9155,9157,9158,9159,9161,9162,9163,9164,9166,9167,9168,9170,9171,9172,9174,9175,9176,9178,9179,9180,9181,9183,9184,9185,9187,9188,9189,9191,9192,9193,9194,9196,9197,9198,9200,9201,9202,9204,9205,9206,9207,9209,9210,9211,9213,9214,9215,9217,9218,9219,9220,9222,9223,9224,9226,9227,9228,9229,9231,9232,9233,9235,9236,9237,9239,9240,9241,9242,9244,9245,9246,9248,9249,9250,9252,9253,9254,9255,9257,9258,9259,9261,9262,9263,9264,9266,9267,9268,9270,9271,9272,9274,9275,9276,9277,9279,9280,9281,9283,9284,9285,9287,9288,9289,9290,9292,9293,9294,9296,9297,9298,9299,9301,9302,9303,9305,9306,9307,9308,9310,9311,9312,9314,9315,9316,9318,9319,9320,9321,9323,9324,9325,9327,9328,9329,9330,9332,9333,9334,9336,9337,9338,9339,9341,9342,9343,9345,9346,9347,9349,9350,9351,9352,9354,9355,9356,9358,9359,9360,9361,9363,9364,9365,9367,9368,9369,9370,9372,9373,9374,9376,9377,9378,9379,9381,9382,9383,9385,9386,9387,9388,9390,9391,9392,9394,9395,9396,9397,9399,9400,9401,9403,9404,9405,9406,9408,9409,9410,9412,9413,9414,9415,9417,9418,9419,9421,9422,9423,9424,9426,9427,9428,9430,9431,9432,9433,9435,9436,9437,9439,9440,9441,9442,9444,9445,9446,9448,9449,9450,9451,9453,9454,9455,9457,9458,9459,9460,9462,9463,9464,9466,9467,9468,9469,9471,9472,9473,9475,9476,9477,9478,9480,9481,9482,9483,9485,9486,9487,9489,9490,9491,9492,9494,9495,9496,9498,9499,9500,9501,9503,9504,9505,9507,9508,9509,9510,9512,9513,9514,9515,9517,9518,9519,9521,9522,9523,9524,9526,9527,9528,9530,9531,9532,9533,9535,9536,9537,9538,9540,9541,9542,9544,9545,9546,9547,9549,9550,9551,9553,9554,9555,9556,9558,9559,9560,9561,9563,9564,9565,9567,9568,9569,9570,9572,9573,9574,9575,9577,9578,9579,9581,9582,9583,9584,9586,9587,9588,9589,9591,9592,9593,9595,9596,9597,9598,9600,9601,9602,9603,9605,9606,9607,9609,9610,9611,9612,9614,9615,9616,9617,9619,9620,9621,9623,9624,9625,9626,9628,9629,9630,9631,9633,9634,9635,9637,9638,9639,9640,9642,9643,9644,9645,9647,9648,9649,9651,9652,9653,9654,9656,9657,9658,9659,9661,9662,9663,9664,9666,9667,9668,9670,9671,9672,9673,9675,9676,9677,9678,9680,9681,9682,9683,9685,9686,9687,9689,9690,9691,9692,9694,9695,9696,9697,9699,9700,9701,9702,9704,9705,9706,9708,9709,9710,9711,9713,9714,9715,9716,9718,9719,9720,9721,9723,9724,9725,9727,9728,9729,9730,9732,9733,9734,9735,9737,9738,9739,9740,9742,9743,9744,9745,9747,9748,9749,9751,9752,9753,9754,9756,9757,9758,9759,9761,9762,9763,9764,9766,9767,9768,9769,9771,9772,9773,9774,9776,9777,9778,9780,9781,9782,9783,9785,9786,9787,9788,9790,9791,9792,9793,9795,9796,9797,9798,9800,9801,9802,9803,9805,9806,9807,9808,9810,9811,9812,9814,9815,9816,9817,9819,9820,9821,9822,9824,9825,9826,9827,9829,9830,9831,9832,9834,9835,9836,9837,9839,9840,9841,9842,9844,9845,9846,9847,9849,9850,9851,9852,9854,9855,9856,9857,9859,9860,9861,9862,9864,9865,9866,9868,9869,9870,9871,9873,9874,9875,9876,9878,9879,9880,9881,9883,9884,9885,9886,9888,9889,9890,9891,9893,9894,9895,9896,9898,9899,9900,9901,9903,9904,9905,9906,9908,9909,9910,9911,9913,9914,9915,9916,9918,9919,9920,9921,9923,9924,9925,9926,9928,9929,9930,9931,9933,9934,9935,9936,9938,9939,9940,9941,9943,9944,9945,9946,9948,9949,9950,9951,9953,9954,9955,9956,9958,9959,9960,9961,9963,9964,9965,9966,9968,9969,9970,9971,9973,9974,9975,9976,9977,9979,9980,9981,9982,9984,9985,9986,9987,9989,9990,9991,9992,9994,9995,9996,9997,9999,10000,10001,10002,10004,10005,10006,10007,10009,10010,10011,10012,10014,10015,10016,10017,10019,10020,10021,10022,10024,10025,10026,10027,10028,10030,10031,10032,10033,10035,10036,10037,10038,10040,10041,10042,10043,10045,10046,10047,10048,10050,10051,10052,10053,10055,10056,10057,10058,10060,10061,10062,10063,10064,10066,10067,10068,10069,10071,10072,10073,10074,10076,10077,10078,10079,10081,10082,10083,10084,10086,10087,10088,10089,10090,10092,10093,10094,10095,10097,10098,10099,10100,10102,10103,10104,10105,10107,10108,10109,10110,10112,10113,10114,10115,10116,10118,10119,10120,10121,10123,10124,10125,10126,10128,10129,10130,10131,10132,10134,10135,10136,10137,10139,10140,10141,10142,10144,10145,10146,10147,10149,10150,10151,10152,10153,10155,10156,10157,10158,10160,10161,10162,10163,10165,10166,10167,10168,10169,10171,10172,10173,10174,10176,10177,10178,10179,10181,10182,10183,10184,10185,10187,10188,10189,10190,10192,10193,10194,10195,10197,10198,10199,10200,10201,10203,10204,10205,10206,10208,10209,10210,10211,10213,10214,10215,10216,10217,10219,10220,10221,10222,10224,10225,10226,10227,10228,10230,10231,10232,10233,10235,10236,10237,10238,10240,10241,10242,10243,10244,10246,10247,10248,10249,10251,10252,10253,10254,10255,10257,10258,10259,10260,10262,10263,10264,10265,10266,10268,10269,10270,10271,10273,10274,10275,10276,10277,10279,10280,10281,10282,10284,10285,10286,10287,10288,10290,10291,10292,10293,10295,10296,10297,10298,10299,10301,10302,10303,10304,10306,10307,10308,10309,10310,10312,10313,10314,10315,10317,10318,10319,10320,10321,10323,10324,10325,10326,10328,10329,10330,10331,10332,10334,10335,10336,10337,10339,10340,10341,10342,10343,10345,10346,10347,10348,10349,10351,10352,10353,10354,10356,10357,10358,10359,10360,10362,10363,10364,10365,10367,10368,10369,10370,10371,10373,10374,10375,10376,10377,10379,10380,10381,10382,10384,10385,10386,10387,10388,10390,10391,10392,10393,10394,10396,10397,10398,10399,10401,10402,10403,10404,10405,10407,10408,10409,10410,10411,10413,10414,10415,10416,10418,10419,10420,10421,10422,10424,10425,10426,10427,10428,10430,10431,10432,10433,10434,10436,10437,10438,10439,10441,10442,10443,10444,10445,10447,10448,10449,10450,10451,10453,10454,10455,10456,10457,10459,10460,10461,10462,10464,10465,10466,10467,10468,10470,10471,10472,10473,10474,10476,10477,10478,10479,10480,10482,10483,10484,10485,10486,10488,10489,10490,10491,10493,10494,10495,10496,10497,10499,10500,10501,10502,10503,10505,10506,10507,10508,10509,10511,10512,10513,10514,10515,10517,10518,10519,10520,10521,10523,10524,10525,10526,10527,10529,10530,10531,10532,10533,10535,10536,10537,10538,10539,10541,10542,10543,10544,10545,10547,10548,10549,10550,10551,10553,10554,10555,10556,10558,10559,10560,10561,10562,10564,10565,10566,10567,10568,10570,10571,10572,10573,10574,10576,10577,10578,10579,10580,10582,10583,10584,10585,10586,10588,10589,10590,10591,10592,10593,10595,10596,10597,10598,10599,10601,10602,10603,10604,10605,10607,10608,10609,10610,10611,10613,10614,10615,10616,10617,10619,10620,10621,10622,10623,10625,10626,10627,10628,10629,10631,10632,10633,10634,10635,10637,10638,10639,10640,10641,10643,10644,10645,10646,10647,10649,10650,10651,10652,10653,10654,10656,10657,10658,10659,10660,10662,10663,10664,10665,10666,10668,10669,10670,10671,10672,10674,10675,10676,10677,10678,10680,10681,10682,10683,10684,10685,10687,10688,10689,10690,10691,10693,10694,10695,10696,10697,10699,10700,10701,10702,10703,10704,10706,10707,10708,10709,10710,10712,10713,10714,10715,10716,10718,10719,10720,10721,10722,10724,10725,10726,10727,10728,10729,10731,10732,10733,10734,10735,10737,10738,10739,10740,10741,10742,10744,10745,10746,10747,10748,10750,10751,10752,10753,10754,10756,10757,10758,10759,10760,10761,10763,10764,10765,10766,10767,10769,10770,10771,10772,10773,10774,10776,10777,10778,10779,10780,10782,10783,10784,10785,10786,10787,10789,10790,10791,10792,10793,10795,10796,10797,10798,10799,10800,10802,10803,10804,10805,10806,10808,10809,10810,10811,10812,10813,10815,10816,10817,10818,10819,10821,10822,10823,10824,10825,10826,10828,10829,10830,10831,10832,10834,10835,10836,10837,10838,10839,10841,10842,10843,10844,10845,10846,10848,10849,10850,10851,10852,10854,10855,10856,10857,10858,10859,10861,10862,10863,10864,10865,10866,10868,10869,10870,10871,10872,10874,10875,10876,10877,10878,10879,10881,10882,10883,10884,10885,10886,10888,10889,10890,10891,10892,10893,10895,10896,10897,10898,10899,10901,10902,10903,10904,10905,10906,10908,10909,10910,10911,10912,10913,10915,10916,10917,10918,10919,10920,10922,10923,10924,10925,10926,10927,10929,10930,10931,10932,10933,10934,10936,10937,10938,10939,10940,10941,10943,10944,10945,10946,10947,10949,10950,10951,10952,10953,10954,10956,10957,10958,10959,10960,10961,10963,10964,10965,10966,10967,10968,10970,10971,10972,10973,10974,10975,10977,10978,10979,10980,10981,10982,10984,10985,10986,10987,10988,10989,10991,10992,10993,10994,10995,10996,10997,10999,11000,11001,11002,11003,11004,11006,11007,11008,11009,11010,11011,11013,11014,11015,11016,11017,11018,11020,11021,11022,11023,11024,11025,11027,11028,11029,11030,11031,11032,11034,11035,11036,11037,11038,11039,11041,11042,11043,11044,11045,11046,11047,11049,11050,11051,11052,11053,11054,11056,11057,11058,11059,11060,11061,11063,11064,11065,11066,11067,11068,11069,11071,11072,11073,11074,11075,11076,11078,11079,11080,11081,11082,11083,11085,11086,11087,11088,11089,11090,11091,11093,11094,11095,11096,11097,11098,11100,11101,11102,11103,11104,11105,11106,11108,11109,11110,11111,11112,11113,11115,11116,11117,11118,11119,11120,11121,11123,11124,11125,11126,11127,11128,11130,11131,11132,11133,11134,11135,11136,11138,11139,11140,11141,11142,11143,11145,11146,11147,11148,11149,11150,11151,11153,11154,11155,11156,11157,11158,11159,11161,11162,11163,11164,11165,11166,11168,11169,11170,11171,11172,11173,11174,11176,11177,11178,11179,11180,11181,11182,11184,11185,11186,11187,11188,11189,11191,11192,11193,11194,11195,11196,11197,11199,11200,11201,11202,11203,11204,11205,11207,11208,11209,11210,11211,11212,11213,11215,11216,11217,11218,11219,11220,11221,11223,11224,11225,11226,11227,11228,11229,11231,11232,11233,11234,11235,11236,11237,11239,11240,11241,11242,11243,11244,11245,11247,11248,11249,11250,11251,11252,11253,11255,11256,11257,11258,11259,11260,11261,11263,11264,11265,11266,11267,11268,11269,11271,11272,11273,11274,11275,11276,11277,11279,11280,11281,11282,11283,11284,11285,11287,11288,11289,11290,11291,11292,11293,11294,11296,11297,11298,11299,11300,11301,11302,11304,11305,11306,11307,11308,11309,11310,11312,11313,11314,11315,11316,11317,11318,11319,11321,11322,11323,11324,11325,11326,11327,11329,11330,11331,11332,11333,11334,11335,11336,11338,11339,11340,11341,11342,11343,11344,11346,11347,11348,11349,11350,11351,11352,11353,11355,11356,11357,11358,11359,11360,11361,11363,11364,11365,11366,11367,11368,11369,11370,11372,11373,11374,11375,11376,11377,11378,11380,11381,11382,11383,11384,11385,11386,11387,11389,11390,11391,11392,11393,11394,11395,11396,11398,11399,11400,11401,11402,11403,11404,11405,11407,11408,11409,11410,11411,11412,11413,11414,11416,11417,11418,11419,11420,11421,11422,11423,11425,11426,11427,11428,11429,11430,11431,11433,11434,11435,11436,11437,11438,11439,11440,11441,11443,11444,11445,11446,11447,11448,11449,11450,11452,11453,11454,11455,11456,11457,11458,11459,11461,11462,11463,11464,11465,11466,11467,11468,11470,11471,11472,11473,11474,11475,11476,11477,11479,11480,11481,11482,11483,11484,11485,11486,11488,11489,11490,11491,11492,11493,11494,11495,11496,11498,11499,11500,11501,11502,11503,11504,11505,11507,11508,11509,11510,11511,11512,11513,11514,11515,11517,11518,11519,11520,11521,11522,11523,11524,11526,11527,11528,11529,11530,11531,11532,11533,11534,11536,11537,11538,11539,11540,11541,11542,11543,11544,11546,11547,11548,11549,11550,11551,11552,11553,11555,11556,11557,11558,11559,11560,11561,11562,11563,11565,11566,11567,11568,11569,11570,11571,11572,11573,11575,11576,11577,11578,11579,11580,11581,11582,11583,11585,11586,11587,11588,11589,11590,11591,11592,11593,11595,11596,11597,11598,11599,11600,11601,11602,11603,11605,11606,11607,11608,11609,11610,11611,11612,11613,11614,11616,11617,11618,11619,11620,11621,11622,11623,11624,11626,11627,11628,11629,11630,11631,11632,11633,11634,11636,11637,11638,11639,11640,11641,11642,11643,11644,11645,11647,11648,11649,11650,11651,11652,11653,11654,11655,11656,11658,11659,11660,11661,11662,11663,11664,11665,11666,11668,11669,11670,11671,11672,11673,11674,11675,11676,11677,11679,11680,11681,11682,11683,11684,11685,11686,11687,11688,11690,11691,11692,11693,11694,11695,11696,11697,11698,11699,11701,11702,11703,11704,11705,11706,11707,11708,11709,11710,11712,11713,11714,11715,11716,11717,11718,11719,11720,11721,11723,11724,11725,11726,11727,11728,11729,11730,11731,11732,11733,11735,11736,11737,11738,11739,11740,11741,11742,11743,11744,11746,11747,11748,11749,11750,11751,11752,11753,11754,11755,11756,11758,11759,11760,11761,11762,11763,11764,11765,11766,11767,11769,11770,11771,11772,11773,11774,11775,11776,11777,11778,11779,11781,11782,11783,11784,11785,11786,11787,11788,11789,11790,11791,11793,11794,11795,11796,11797,11798,11799,11800,11801,11802,11803,11805,11806,11807,11808,11809,11810,11811,11812,11813,11814,11815,11816,11818,11819,11820,11821,11822,11823,11824,11825,11826,11827,11828,11830,11831,11832,11833,11834,11835,11836,11837,11838,11839,11840,11841,11843,11844,11845,11846,11847,11848,11849,11850,11851,11852,11853,11855,11856,11857,11858,11859,11860,11861,11862,11863,11864,11865,11866,11868,11869,11870,11871,11872,11873,11874,11875,11876,11877,11878,11879,11880,11882,11883,11884,11885,11886,11887,11888,11889,11890,11891,11892,11893,11895,11896,11897,11898,11899,11900,11901,11902,11903,11904,11905,11906,11907,11909,11910,11911,11912,11913,11914,11915,11916,11917,11918,11919,11920,11922,11923,11924,11925,11926,11927,11928,11929,11930,11931,11932,11933,11934,11936,11937,11938,11939,11940,11941,11942,11943,11944,11945,11946,11947,11948,11949,11951,11952,11953,11954,11955,11956,11957,11958,11959,11960,11961,11962,11963,11965,11966,11967,11968,11969,11970,11971,11972,11973,11974,11975,11976,11977,11978,11980,11981,11982,11983,11984,11985,11986,11987,11988,11989,11990,11991,11992,11993,11995,11996,11997,11998,11999,12000,12001,12002,12003,12004,12005,12006,12007,12008,12009,12011,12012,12013,12014,12015,12016,12017,12018,12019,12020,12021,12022,12023,12024,12026,12027,12028,12029,12030,12031,12032,12033,12034,12035,12036,12037,12038,12039,12040,12041,12043,12044,12045,12046,12047,12048,12049,12050,12051,12052,12053,12054,12055,12056,12057,12059,12060,12061,12062,12063,12064,12065,12066,12067,12068,12069,12070,12071,12072,12073,12074,12076,12077,12078,12079,12080,12081,12082,12083,12084,12085,12086,12087,12088,12089,12090,12091,12092,12094,12095,12096,12097,12098,12099,12100,12101,12102,12103,12104,12105,12106,12107,12108,12109,12110,12112,12113,12114,12115,12116,12117,12118,12119,12120,12121,12122,12123,12124,12125,12126,12127,12128,12130,12131,12132,12133,12134,12135,12136,12137,12138,12139,12140,12141,12142,12143,12144,12145,12146,12147,12148,12150,12151,12152,12153,12154,12155,12156,12157,12158,12159,12160,12161,12162,12163,12164,12165,12166,12167,12168,12170,12171,12172,12173,12174,12175,12176,12177,12178,12179,12180,12181,12182,12183,12184,12185,12186,12187,12188,12190,12191,12192,12193,12194,12195,12196,12197,12198,12199,12200,12201,12202,12203,12204,12205,12206,12207,12208,12209,12210,12212,12213,12214,12215,12216,12217,12218,12219,12220,12221,12222,12223,12224,12225,12226,12227,12228,12229,12230,12231,12232,12233,12235,12236,12237,12238,12239,12240,12241,12242,12243,12244,12245,12246,12247,12248,12249,12250,12251,12252,12253,12254,12255,12256,12257,12259,12260,12261,12262,12263,12264,12265,12266,12267,12268,12269,12270,12271,12272,12273,12274,12275,12276,12277,12278,12279,12280,12281,12282,12284,12285,12286,12287,12288,12289,12290,12291,12292,12293,12294,12295,12296,12297,12298,12299,12300,12301,12302,12303,12304,12305,12306,12307,12308,12309,12310,12312,12313,12314,12315,12316,12317,12318,12319,12320,12321,12322,12323,12324,12325,12326,12327,12328,12329,12330,12331,12332,12333,12334,12335,12336,12337,12338,12339,12340,12342,12343,12344,12345,12346,12347,12348,12349,12350,12351,12352,12353,12354,12355,12356,12357,12358,12359,12360,12361,12362,12363,12364,12365,12366,12367,12368,12369,12370,12371,12372,12373,12375,12376,12377,12378,12379,12380,12381,12382,12383,12384,12385,12386,12387,12388,12389,12390,12391,12392,12393,12394,12395,12396,12397,12398,12399,12400,12401,12402,12403,12404,12405,12406,12407,12408,12409,12410,12412,12413,12414,12415,12416,12417,12418,12419,12420,12421,12422,12423,12424,12425,12426,12427,12428,12429,12430,12431,12432,12433,12434,12435,12436,12437,12438,12439,12440,12441,12442,12443,12444,12445,12446,12447,12448,12449,12450,12451,12452,12453,12454,12455,12457,12458,12459,12460,12461,12462,12463,12464,12465,12466,12467,12468,12469,12470,12471,12472,12473,12474,12475,12476,12477,12478,12479,12480,12481,12482,12483,12484,12485,12486,12487,12488,12489,12490,12491,12492,12493,12494,12495,12496,12497,12498,12499,12500,12501,12502,12503,12504,12505,12506,12507,12508,12509,12510,12511,12512,12513,12514,12515,12517,12518,12519,12520,12521,12522,12523,12524,12525,12526,12527,12528,12529,12530,12531,12532,12533,12534,12535,12536,12537,12538,12539,12540,12541,12542,12543,12544,12545,12546,12547,12548,12549,12550,12551,12552,12553,12554,12555,12556,12557,12558,12559,12560,12561,12562,12563,12564,12565,12566,12567,12568,12569,12570,12571,12572,12573,12574,12575,12576,12577,12578,12579,12580,12581,12582,12583,12584,12585,12586,12587,12588,12589,12590,12591,12592,12593,12594,12595,12596,12597,12598,12599,12600,12601,12602,12603,12604,12605,12606,12607,12608,12609,12610,12611,12612,12613,12614,12615,12616,12617,12618,12619,12620,12621,12622,12623,12624,12625,12626,12627,12628,12629,12630,12631,12632,12633,12634,12635,12636,12637,12638,12639,12640,12641,12642,12643,12644,12645,12646,12647,12648,12649,12650,12651,12652,12653,12654,12655,12656,12657,12658,12659,12660,12661,12662,12663,12664,12665,12666,12667,12668,12669,12670,12671,12672,12673,12674,12675,12676,12677,12678,12679,12680,12681,12682,12683,12684,12685,12686,12687,12688,12689,12690,12691,12692,12693,12694,12695,12696,12697,12698,12699,12700,12701,12702,12703,12704,12705,12706,12707,12708,12709,12710,12711,12712,12713,12714,12715,12716,12717,12718,12719,12720,12721,12722,12723,12724,12725,12726,12727,12728,12729,12730,12731,12732,12733,12734,12735,12736,12737,12738,12739,12740,12741,12742,12743,12744,12745,12746,12747,12748,12749,12749,12750,12751,12752,12753,12754,12755,12756,12757,12758,12759,12760,12761,12762,12763,12764,12765,12766,12767,12768,12769,12770,12771,12772,12773,12774,12775,12776,12777,12778,12779,12780,12781,12782,12783,12784,12785,12786,12787,12788,12789,12790,12791,12792,12793,12794,12795,12796,12797,12798,12799,12800,12801,12802,12803,12804,12805,12806,12807,12807,12808,12809,12810,12811,12812,12813,12814,12815,12816,12817,12818,12819,12820,12821,12822,12823,12824,12825,12826,12827,12828,12829,12830,12831,12832,12833,12834,12835,12836,12837,12838,12839,12840,12841,12842,12843,12844,12845,12846,12847,12848,12849,12849,12850,12851,12852,12853,12854,12855,12856,12857,12858,12859,12860,12861,12862,12863,12864,12865,12866,12867,12868,12869,12870,12871,12872,12873,12874,12875,12876,12877,12878,12879,12880,12881,12882,12883,12884,12884,12885,12886,12887,12888,12889,12890,12891,12892,12893,12894,12895,12896,12897,12898,12899,12900,12901,12902,12903,12904,12905,12906,12907,12908,12909,12910,12911,12912,12913,12914,12915,12915,12916,12917,12918,12919,12920,12921,12922,12923,12924,12925,12926,12927,12928,12929,12930,12931,12932,12933,12934,12935,12936,12937,12938,12939,12940,12941,12942,12942,12943,12944,12945,12946,12947,12948,12949,12950,12951,12952,12953,12954,12955,12956,12957,12958,12959,12960,12961,12962,12963,12964,12965,12966,12967,12967,12968,12969,12970,12971,12972,12973,12974,12975,12976,12977,12978,12979,12980,12981,12982,12983,12984,12985,12986,12987,12988,12989,12990,12990,12991,12992,12993,12994,12995,12996,12997,12998,12999,13000,13001,13002,13003,13004,13005,13006,13007,13008,13009,13010,13011,13012,13012,13013,13014,13015,13016,13017,13018,13019,13020,13021,13022,13023,13024,13025,13026,13027,13028,13029,13030,13031,13032,13032,13033,13034,13035,13036,13037,13038,13039,13040,13041,13042,13043,13044,13045,13046,13047,13048,13049,13050,13051,13051,13052,13053,13054,13055,13056,13057,13058,13059,13060,13061,13062,13063,13064,13065,13066,13067,13068,13069,13070,13070,13071,13072,13073,13074,13075,13076,13077,13078,13079,13080,13081,13082,13083,13084,13085,13086,13087,13087,13088,13089,13090,13091,13092,13093,13094,13095,13096,13097,13098,13099,13100,13101,13102,13103,13104,13104,13105,13106,13107,13108,13109,13110,13111,13112,13113,13114,13115,13116,13117,13118,13119,13120,13120,13121,13122,13123,13124,13125,13126,13127,13128,13129,13130,13131,13132,13133,13134,13135,13136,13136,13137,13138,13139,13140,13141,13142,13143,13144,13145,13146,13147,13148,13149,13150,13151,13151,13152,13153,13154,13155,13156,13157,13158,13159,13160,13161,13162,13163,13164,13165,13165,13166,13167,13168,13169,13170,13171,13172,13173,13174,13175,13176,13177,13178,13179,13180,13180,13181,13182,13183,13184,13185,13186,13187,13188,13189,13190,13191,13192,13193,13193,13194,13195,13196,13197,13198,13199,13200,13201,13202,13203,13204,13205,13206,13207,13207,13208,13209,13210,13211,13212,13213,13214,13215,13216,13217,13218,13219,13220,13220,13221,13222,13223,13224,13225,13226,13227,13228,13229,13230,13231,13232,13232,13233,13234,13235,13236,13237,13238,13239,13240,13241,13242,13243,13244,13245,13245,13246,13247,13248,13249,13250,13251,13252,13253,13254,13255,13256,13257,13257,13258,13259,13260,13261,13262,13263,13264,13265,13266,13267,13268,13269,13269,13270,13271,13272,13273,13274,13275,13276,13277,13278,13279,13280,13280,13281,13282,13283,13284,13285,13286,13287,13288,13289,13290,13291,13292,13292,13293,13294,13295,13296,13297,13298,13299,13300,13301,13302,13303,13303,13304,13305,13306,13307,13308,13309,13310,13311,13312,13313,13314,13314,13315,13316,13317,13318,13319,13320,13321,13322,13323,13324,13324,13325,13326,13327,13328,13329,13330,13331,13332,13333,13334,13335,13335,13336,13337,13338,13339,13340,13341,13342,13343,13344,13345,13345,13346,13347,13348,13349,13350,13351,13352,13353,13354,13355,13355,13356,13357,13358,13359,13360,13361,13362,13363,13364,13365,13365,13366,13367,13368,13369,13370,13371,13372,13373,13374,13375,13375,13376,13377,13378,13379,13380,13381,13382,13383,13384,13385,13385,13386,13387,13388,13389,13390,13391,13392,13393,13394,13394,13395,13396,13397,13398,13399,13400,13401,13402,13403,13404,13404,13405,13406,13407,13408,13409,13410,13411,13412,13413,13413,13414,13415,13416,13417,13418,13419,13420,13421,13422,13422,13423,13424,13425,13426,13427,13428,13429,13430,13431,13431,13432,13433,13434,13435,13436,13437,13438,13439,13440,13440,13441,13442,13443,13444,13445,13446,13447,13448,13449,13449,13450,13451,13452,13453,13454,13455,13456,13457,13457,13458,13459,13460,13461,13462,13463,13464,13465,13466,13466,13467,13468,13469,13470,13471,13472,13473,13474,13474,13475,13476,13477,13478,13479,13480,13481,13482,13483,13483,13484,13485,13486,13487,13488,13489,13490,13491,13491,13492,13493,13494,13495,13496,13497,13498,13499,13499,13500,13501,13502,13503,13504,13505,13506,13507,13507,13508,13509,13510,13511,13512,13513,13514,13515,13515,13516,13517,13518,13519,13520,13521,13522,13523,13523,13524,13525,13526,13527,13528,13529,13530,13531,13531,13532,13533,13534,13535,13536,13537,13538,13539,13539,13540,13541,13542,13543,13544,13545,13546,13546,13547,13548,13549,13550,13551,13552,13553,13554,13554,13555,13556,13557,13558,13559,13560,13561,13561,13562,13563,13564,13565,13566,13567,13568,13569,13569,13570,13571,13572,13573,13574,13575,13576,13576,13577,13578,13579,13580,13581,13582,13583,13583,13584,13585,13586,13587,13588,13589,13590,13590,13591,13592,13593,13594,13595,13596,13597,13597,13598,13599,13600,13601,13602,13603,13604,13604,13605,13606,13607,13608,13609,13610,13611,13611,13612,13613,13614,13615,13616,13617,13618,13618,13619,13620,13621,13622,13623,13624,13625,13625,13626,13627,13628,13629,13630,13631,13632,13632,13633,13634,13635,13636,13637,13638,13639,13639,13640,13641,13642,13643,13644,13645,13645,13646,13647,13648,13649,13650,13651,13652,13652,13653,13654,13655,13656,13657,13658,13659,13659,13660,13661,13662,13663,13664,13665,13665,13666,13667,13668,13669,13670,13671,13672,13672,13673,13674,13675,13676,13677,13678,13678,13679,13680,13681,13682,13683,13684,13684,13685,13686,13687,13688,13689,13690,13691,13691,13692,13693,13694,13695,13696,13697,13697,13698,13699,13700,13701,13702,13703,13703,13704,13705,13706,13707,13708,13709,13709,13710,13711,13712,13713,13714,13715,13715,13716,13717,13718,13719,13720,13721,13721,13722,13723,13724,13725,13726,13727,13727,13728,13729,13730,13731,13732,13733,13733,13734,13735,13736,13737,13738,13739,13739,13740,13741,13742,13743,13744,13745,13745,13746,13747,13748,13749,13750,13751,13751,13752,13753,13754,13755,13756,13757,13757,13758,13759,13760,13761,13762,13763,13763,13764,13765,13766,13767,13768,13768,13769,13770,13771,13772,13773,13774,13774,13775,13776,13777,13778,13779,13780,13780,13781,13782,13783,13784,13785,13785,13786,13787,13788,13789,13790,13791,13791,13792,13793,13794,13795,13796,13797,13797,13798,13799,13800,13801,13802,13802,13803,13804,13805,13806,13807,13808,13808,13809,13810,13811,13812,13813,13813,13814,13815,13816,13817,13818,13819,13819,13820,13821,13822,13823,13824,13824,13825,13826,13827,13828,13829,13829,13830,13831,13832,13833,13834,13835,13835,13836,13837,13838,13839,13840,13840,13841,13842,13843,13844,13845,13845,13846,13847,13848,13849,13850,13850,13851,13852,13853,13854,13855,13856,13856,13857,13858,13859,13860,13861,13861,13862,13863,13864,13865,13866,13866,13867,13868,13869,13870,13871,13871,13872,13873,13874,13875,13876,13876,13877,13878,13879,13880,13881,13881,13882,13883,13884,13885,13886,13886,13887,13888,13889,13890,13891,13891,13892,13893,13894,13895,13896,13896,13897,13898,13899,13900,13901,13901,13902,13903,13904,13905,13906,13906,13907,13908,13909,13910,13911,13911,13912,13913,13914,13915,13916,13916,13917,13918,13919,13920,13920,13921,13922,13923,13924,13925,13925,13926,13927,13928,13929,13930,13930,13931,13932,13933,13934,13935,13935,13936,13937,13938,13939,13940,13940,13941,13942,13943,13944,13944,13945,13946,13947,13948,13949,13949,13950,13951,13952,13953,13954,13954,13955,13956,13957,13958,13958,13959,13960,13961,13962,13963,13963,13964,13965,13966,13967,13967,13968,13969,13970,13971,13972,13972,13973,13974,13975,13976,13977,13977,13978,13979,13980,13981,13981,13982,13983,13984,13985,13986,13986,13987,13988,13989,13990,13990,13991,13992,13993,13994,13995,13995,13996,13997,13998,13999,13999,14000,14001,14002,14003,14003,14004,14005,14006,14007,14008,14008,14009,14010,14011,14012,14012,14013,14014,14015,14016,14017,14017,14018,14019,14020,14021,14021,14022,14023,14024,14025,14025,14026,14027,14028,14029,14030,14030,14031,14032,14033,14034,14034,14035,14036,14037,14038,14038,14039,14040,14041,14042,14042,14043,14044,14045,14046,14047,14047,14048,14049,14050,14051,14051,14052,14053,14054,14055,14055,14056,14057,14058,14059,14059,14060,14061,14062,14063,14063,14064,14065,14066,14067,14067,14068,14069,14070,14071,14072,14072,14073,14074,14075,14076,14076,14077,14078,14079,14080,14080,14081,14082,14083,14084,14084,14085,14086,14087,14088,14088,14089,14090,14091,14092,14092,14093,14094,14095,14096,14096,14097,14098,14099,14100,14100,14101,14102,14103,14104,14104,14105,14106,14107,14108,14108,14109,14110,14111,14112,14112,14113,14114,14115,14116,14116,14117,14118,14119,14120,14120,14121,14122,14123,14124,14124,14125,14126,14127,14128,14128,14129,14130,14131,14131,14132,14133,14134,14135,14135,14136,14137,14138,14139,14139,14140,14141,14142,14143,14143,14144,14145,14146,14147,14147,14148,14149,14150,14151,14151,14152,14153,14154,14154,14155,14156,14157,14158,14158,14159,14160,14161,14162,14162,14163,14164,14165,14166,14166,14167,14168,14169,14169,14170,14171,14172,14173,14173,14174,14175,14176,14177,14177,14178,14179,14180,14180,14181,14182,14183,14184,14184,14185,14186,14187,14188,14188,14189,14190,14191,14191,14192,14193,14194,14195,14195,14196,14197,14198,14199,14199,14200,14201,14202,14202,14203,14204,14205,14206,14206,14207,14208,14209,14210,14210,14211,14212,14213,14213,14214,14215,14216,14217,14217,14218,14219,14220,14220,14221,14222,14223,14224,14224,14225,14226,14227,14227,14228,14229,14230,14231,14231,14232,14233,14234,14234,14235,14236,14237,14238,14238,14239,14240,14241,14241,14242,14243,14244,14245,14245,14246,14247,14248,14248,14249,14250,14251,14252,14252,14253,14254,14255,14255,14256,14257,14258,14259,14259,14260,14261,14262,14262,14263,14264,14265,14265,14266,14267,14268,14269,14269,14270,14271,14272,14272,14273,14274,14275,14275,14276,14277,14278,14279,14279,14280,14281,14282,14282,14283,14284,14285,14285,14286,14287,14288,14289,14289,14290,14291,14292,14292,14293,14294,14295,14295,14296,14297,14298,14299,14299,14300,14301,14302,14302,14303,14304,14305,14305,14306,14307,14308,14309,14309,14310,14311,14312,14312,14313,14314,14315,14315,14316,14317,14318,14318,14319,14320,14321,14321,14322,14323,14324,14325,14325,14326,14327,14328,14328,14329,14330,14331,14331,14332,14333,14334,14334,14335,14336,14337,14337,14338,14339,14340,14341,14341,14342,14343,14344,14344,14345,14346,14347,14347,14348,14349,14350,14350,14351,14352,14353,14353,14354,14355,14356,14356,14357,14358,14359,14359,14360,14361,14362,14362,14363,14364,14365,14366,14366,14367,14368,14369,14369,14370,14371,14372,14372,14373,14374,14375,14375,14376,14377,14378,14378,14379,14380,14381,14381,14382,14383,14384,14384,14385,14386,14387,14387,14388,14389,14390,14390,14391,14392,14393,14393,14394,14395,14396,14396,14397,14398,14399,14399,14400,14401,14402,14402,14403,14404,14405,14405,14406,14407,14408,14408,14409,14410,14411,14411,14412,14413,14414,14414,14415,14416,14417,14417,14418,14419,14420,14420,14421,14422,14423,14423,14424,14425,14425,14426,14427,14428,14428,14429,14430,14431,14431,14432,14433,14434,14434,14435,14436,14437,14437,14438,14439,14440,14440,14441,14442,14443,14443,14444,14445,14446,14446,14447,14448,14449,14449,14450,14451,14451,14452,14453,14454,14454,14455,14456,14457,14457,14458,14459,14460,14460,14461,14462,14463,14463,14464,14465,14466,14466,14467,14468,14468,14469,14470,14471,14471,14472,14473,14474,14474,14475,14476,14477,14477,14478,14479,14479,14480,14481,14482,14482,14483,14484,14485,14485,14486,14487,14488,14488,14489,14490,14491,14491,14492,14493,14493,14494,14495,14496,14496,14497,14498,14499,14499,14500,14501,14501,14502,14503,14504,14504,14505,14506,14507,14507,14508,14509,14510,14510,14511,14512,14512,14513,14514,14515,14515,14516,14517,14518,14518,14519,14520,14520,14521,14522,14523,14523,14524,14525,14526,14526,14527,14528,14528,14529,14530,14531,14531,14532,14533,14534,14534,14535,14536,14536,14537,14538,14539,14539,14540,14541,14541,14542,14543,14544,14544,14545,14546,14547,14547,14548,14549,14549,14550,14551,14552,14552,14553,14554,14554,14555,14556,14557,14557,14558,14559,14560,14560,14561,14562,14562,14563,14564,14565,14565,14566,14567,14567,14568,14569,14570,14570,14571,14572,14572,14573,14574,14575,14575,14576,14577,14577,14578,14579,14580,14580,14581,14582,14582,14583,14584,14585,14585,14586,14587,14588,14588,14589,14590,14590,14591,14592,14593,14593,14594,14595,14595,14596,14597,14598,14598,14599,14600,14600,14601,14602,14602,14603,14604,14605,14605,14606,14607,14607,14608,14609,14610,14610,14611,14612,14612,14613,14614,14615,14615,14616,14617,14617,14618,14619,14620,14620,14621,14622,14622,14623,14624,14625,14625,14626,14627,14627,14628,14629,14629,14630,14631,14632,14632,14633,14634,14634,14635,14636,14637,14637,14638,14639,14639,14640,14641,14641,14642,14643,14644,14644,14645,14646,14646,14647,14648,14648,14649,14650,14651,14651,14652,14653,14653,14654,14655,14656,14656,14657,14658,14658,14659,14660,14660,14661,14662,14663,14663,14664,14665,14665,14666,14667,14667,14668,14669,14670,14670,14671,14672,14672,14673,14674,14674,14675,14676,14677,14677,14678,14679,14679,14680,14681,14681,14682,14683,14683,14684,14685,14686,14686,14687,14688,14688,14689,14690,14690,14691,14692,14693,14693,14694,14695,14695,14696,14697,14697,14698,14699,14699,14700,14701,14702,14702,14703,14704,14704,14705,14706,14706,14707,14708,14708,14709,14710,14711,14711,14712,14713,14713,14714,14715,14715,14716,14717,14717,14718,14719,14720,14720,14721,14722,14722,14723,14724,14724,14725,14726,14726,14727,14728,14728,14729,14730,14731,14731,14732,14733,14733,14734,14735,14735,14736,14737,14737,14738,14739,14739,14740,14741,14742,14742,14743,14744,14744,14745,14746,14746,14747,14748,14748,14749,14750,14750,14751,14752,14752,14753,14754,14755,14755,14756,14757,14757,14758,14759,14759,14760,14761,14761,14762,14763,14763,14764,14765,14765,14766,14767,14767,14768,14769,14770,14770,14771,14772,14772,14773,14774,14774,14775,14776,14776,14777,14778,14778,14779,14780,14780,14781,14782,14782,14783,14784,14784,14785,14786,14786,14787,14788,14788,14789,14790,14791,14791,14792,14793,14793,14794,14795,14795,14796,14797,14797,14798,14799,14799,14800,14801,14801,14802,14803,14803,14804,14805,14805,14806,14807,14807,14808,14809,14809,14810,14811,14811,14812,14813,14813,14814,14815,14815,14816,14817,14817,14818,14819,14819,14820,14821,14821,14822,14823,14823,14824,14825,14825,14826,14827,14827,14828,14829,14829,14830,14831,14831,14832,14833,14833,14834,14835,14835,14836,14837,14837,14838,14839,14839,14840,14841,14841,14842,14843,14843,14844,14845,14845,14846,14847,14847,14848,14849,14849,14850,14851,14851,14852,14853,14853,14854,14855,14855,14856,14857,14857,14858,14859,14859,14860,14861,14861,14862,14863,14863,14864,14865,14865,14866,14867,14867,14868,14869,14869,14870,14871,14871,14872,14873,14873,14874,14875,14875,14876,14877,14877,14878,14879,14879,14880,14880,14881,14882,14882,14883,14884,14884,14885,14886,14886,14887,14888,14888,14889,14890,14890,14891,14892,14892,14893,14894,14894,14895,14896,14896,14897,14898,14898,14899,14899,14900,14901,14901,14902,14903,14903,14904,14905,14905,14906,14907,14907,14908,14909,14909,14910,14911,14911,14912,14913,14913,14914,14914,14915,14916,14916,14917,14918,14918,14919,14920,14920,14921,14922,14922,14923,14924,14924,14925,14925,14926,14927,14927,14928,14929,14929,14930,14931,14931,14932,14933,14933,14934,14935,14935,14936,14936,14937,14938,14938,14939,14940,14940,14941,14942,14942,14943,14944,14944,14945,14946,14946,14947,14947,14948,14949,14949,14950,14951,14951,14952,14953,14953,14954,14954,14955,14956,14956,14957,14958,14958,14959,14960,14960,14961,14962,14962,14963,14963,14964,14965,14965,14966,14967,14967,14968,14969,14969,14970,14970,14971,14972,14972,14973,14974,14974,14975,14976,14976,14977,14977,14978,14979,14979,14980,14981,14981,14982,14983,14983,14984,14984,14985,14986,14986,14987,14988,14988,14989,14990,14990,14991,14991,14992,14993,14993,14994,14995,14995,14996,14997,14997,14998,14998,14999,15000,15000,15001,15002,15002,15003,15003,15004,15005,15005,15006,15007,15007,15008,15009,15009,15010,15010,15011,15012,15012,15013,15014,15014,15015,15015,15016,15017,15017,15018,15019,15019,15020,15020,15021,15022,15022,15023,15024,15024,15025,15025,15026,15027,15027,15028,15029,15029,15030,15030,15031,15032,15032,15033,15034,15034,15035,15035,15036,15037,15037,15038,15039,15039,15040,15040,15041,15042,15042,15043,15044,15044,15045,15045,15046,15047,15047,15048,15049,15049,15050,15050,15051,15052,15052,15053,15054,15054,15055,15055,15056,15057,15057,15058,15058,15059,15060,15060,15061,15062,15062,15063,15063,15064,15065,15065,15066,15066,15067,15068,15068,15069,15070,15070,15071,15071,15072,15073,15073,15074,15075,15075,15076,15076,15077,15078,15078,15079,15079,15080,15081,15081,15082,15082,15083,15084,15084,15085,15086,15086,15087,15087,15088,15089,15089,15090,15090,15091,15092,15092,15093,15094,15094,15095,15095,15096,15097,15097,15098,15098,15099,15100,15100,15101,15101,15102,15103,15103,15104,15104,15105,15106,15106,15107,15108,15108,15109,15109,15110,15111,15111,15112,15112,15113,15114,15114,15115,15115,15116,15117,15117,15118,15118,15119,15120,15120,15121,15121,15122,15123,15123,15124,15124,15125,15126,15126,15127,15127,15128,15129,15129,15130,15131,15131,15132,15132,15133,15134,15134,15135,15135,15136,15137,15137,15138,15138,15139,15140,15140,15141,15141,15142,15143,15143,15144,15144,15145,15146,15146,15147,15147,15148,15149,15149,15150,15150,15151,15151,15152,15153,15153,15154,15154,15155,15156,15156,15157,15157,15158,15159,15159,15160,15160,15161,15162,15162,15163,15163,15164,15165,15165,15166,15166,15167,15168,15168,15169,15169,15170,15171,15171,15172,15172,15173,15174,15174,15175,15175,15176,15176,15177,15178,15178,15179,15179,15180,15181,15181,15182,15182,15183,15184,15184,15185,15185,15186,15187,15187,15188,15188,15189,15189,15190,15191,15191,15192,15192,15193,15194,15194,15195,15195,15196,15197,15197,15198,15198,15199,15199,15200,15201,15201,15202,15202,15203,15204,15204,15205,15205,15206,15206,15207,15208,15208,15209,15209,15210,15211,15211,15212,15212,15213,15213,15214,15215,15215,15216,15216,15217,15218,15218,15219,15219,15220,15220,15221,15222,15222,15223,15223,15224,15225,15225,15226,15226,15227,15227,15228,15229,15229,15230,15230,15231,15231,15232,15233,15233,15234,15234,15235,15236,15236,15237,15237,15238,15238,15239,15240,15240,15241,15241,15242,15242,15243,15244,15244,15245,15245,15246,15246,15247,15248,15248,15249,15249,15250,15250,15251,15252,15252,15253,15253,15254,15254,15255,15256,15256,15257,15257,15258,15258,15259,15260,15260,15261,15261,15262,15262,15263,15264,15264,15265,15265,15266,15266,15267,15268,15268,15269,15269,15270,15270,15271,15272,15272,15273,15273,15274,15274,15275,15276,15276,15277,15277,15278,15278,15279,15280,15280,15281,15281,15282,15282,15283,15284,15284,15285,15285,15286,15286,15287,15287,15288,15289,15289,15290,15290,15291,15291,15292,15293,15293,15294,15294,15295,15295,15296,15296,15297,15298,15298,15299,15299,15300,15300,15301,15302,15302,15303,15303,15304,15304,15305,15305,15306,15307,15307,15308,15308,15309,15309,15310,15311,15311,15312,15312,15313,15313,15314,15314,15315,15316,15316,15317,15317,15318,15318,15319,15319,15320,15321,15321,15322,15322,15323,15323,15324,15324,15325,15326,15326,15327,15327,15328,15328,15329,15329,15330,15331,15331,15332,15332,15333,15333,15334,15334,15335,15336,15336,15337,15337,15338,15338,15339,15339,15340,15340,15341,15342,15342,15343,15343,15344,15344,15345,15345,15346,15347,15347,15348,15348,15349,15349,15350,15350,15351,15351,15352,15353,15353,15354,15354,15355,15355,15356,15356,15357,15358,15358,15359,15359,15360,15360,15361,15361,15362,15362,15363,15364,15364,15365,15365,15366,15366,15367,15367,15368,15368,15369,15370,15370,15371,15371,15372,15372,15373,15373,15374,15374,15375,15375,15376,15377,15377,15378,15378,15379,15379,15380,15380,15381,15381,15382,15383,15383,15384,15384,15385,15385,15386,15386,15387,15387,15388,15388,15389,15390,15390,15391,15391,15392,15392,15393,15393,15394,15394,15395,15395,15396,15397,15397,15398,15398,15399,15399,15400,15400,15401,15401,15402,15402,15403,15404,15404,15405,15405,15406,15406,15407,15407,15408,15408,15409,15409,15410,15410,15411,15412,15412,15413,15413,15414,15414,15415,15415,15416,15416,15417,15417,15418,15418,15419,15419,15420,15421,15421,15422,15422,15423,15423,15424,15424,15425,15425,15426,15426,15427,15427,15428,15428,15429,15430,15430,15431,15431,15432,15432,15433,15433,15434,15434,15435,15435,15436,15436,15437,15437,15438,15439,15439,15440,15440,15441,15441,15442,15442,15443,15443,15444,15444,15445,15445,15446,15446,15447,15447,15448,15448,15449,15450,15450,15451,15451,15452,15452,15453,15453,15454,15454,15455,15455,15456,15456,15457,15457,15458,15458,15459,15459,15460,15460,15461,15461,15462,15463,15463,15464,15464,15465,15465,15466,15466,15467,15467,15468,15468,15469,15469,15470,15470,15471,15471,15472,15472,15473,15473,15474,15474,15475,15475,15476,15476,15477,15478,15478,15479,15479,15480,15480,15481,15481,15482,15482,15483,15483,15484,15484,15485,15485,15486,15486,15487,15487,15488,15488,15489,15489,15490,15490,15491,15491,15492,15492,15493,15493,15494,15494,15495,15495,15496,15496,15497,15497,15498,15499,15499,15500,15500,15501,15501,15502,15502,15503,15503,15504,15504,15505,15505,15506,15506,15507,15507,15508,15508,15509,15509,15510,15510,15511,15511,15512,15512,15513,15513,15514,15514,15515,15515,15516,15516,15517,15517,15518,15518,15519,15519,15520,15520,15521,15521,15522,15522,15523,15523,15524,15524,15525,15525,15526,15526,15527,15527,15528,15528,15529,15529,15530,15530,15531,15531,15532,15532,15533,15533,15534,15534,15535,15535,15536,15536,15537,15537,15538,15538,15539,15539,15540,15540,15541,15541,15542,15542,15543,15543,15544,15544,15545,15545,15546,15546,15547,15547,15548,15548,15549,15549,15550,15550,15551,15551,15552,15552,15553,15553,15554,15554,15555,15555,15556,15556,15557,15557,15558,15558,15559,15559,15560,15560,15561,15561,15562,15562,15563,15563,15563,15564,15564,15565,15565,15566,15566,15567,15567,15568,15568,15569,15569,15570,15570,15571,15571,15572,15572,15573,15573,15574,15574,15575,15575,15576,15576,15577,15577,15578,15578,15579,15579,15580,15580,15581,15581,15582,15582,15583,15583,15583,15584,15584,15585,15585,15586,15586,15587,15587,15588,15588,15589,15589,15590,15590,15591,15591,15592,15592,15593,15593,15594,15594,15595,15595,15596,15596,15597,15597,15597,15598,15598,15599,15599,15600,15600,15601,15601,15602,15602,15603,15603,15604,15604,15605,15605,15606,15606,15607,15607,15608,15608,15608,15609,15609,15610,15610,15611,15611,15612,15612,15613,15613,15614,15614,15615,15615,15616,15616,15617,15617,15618,15618,15618,15619,15619,15620,15620,15621,15621,15622,15622,15623,15623,15624,15624,15625,15625,15626,15626,15627,15627,15627,15628,15628,15629,15629,15630,15630,15631,15631,15632,15632,15633,15633,15634,15634,15635,15635,15635,15636,15636,15637,15637,15638,15638,15639,15639,15640,15640,15641,15641,15642,15642,15642,15643,15643,15644,15644,15645,15645,15646,15646,15647,15647,15648,15648,15649,15649,15649,15650,15650,15651,15651,15652,15652,15653,15653,15654,15654,15655,15655,15656,15656,15656,15657,15657,15658,15658,15659,15659,15660,15660,15661,15661,15662,15662,15662,15663,15663,15664,15664,15665,15665,15666,15666,15667,15667,15667,15668,15668,15669,15669,15670,15670,15671,15671,15672,15672,15673,15673,15673,15674,15674,15675,15675,15676,15676,15677,15677,15678,15678,15678,15679,15679,15680,15680,15681,15681,15682,15682,15683,15683,15683,15684,15684,15685,15685,15686,15686,15687,15687,15688,15688,15688,15689,15689,15690,15690,15691,15691,15692,15692,15693,15693,15693,15694,15694,15695,15695,15696,15696,15697,15697,15697,15698,15698,15699,15699,15700,15700,15701,15701,15702,15702,15702,15703,15703,15704,15704,15705,15705,15706,15706,15706,15707,15707,15708,15708,15709,15709,15710,15710,15710,15711,15711,15712,15712,15713,15713,15714,15714,15714,15715,15715,15716,15716,15717,15717,15718,15718,15718,15719,15719,15720,15720,15721,15721,15722,15722,15722,15723,15723,15724,15724,15725,15725,15726,15726,15726,15727,15727,15728,15728,15729,15729,15729,15730,15730,15731,15731,15732,15732,15733,15733,15733,15734,15734,15735,15735,15736,15736,15736,15737,15737,15738,15738,15739,15739,15740,15740,15740,15741,15741,15742,15742,15743,15743,15743,15744,15744,15745,15745,15746,15746,15746,15747,15747,15748,15748,15749,15749,15750,15750,15750,15751,15751,15752,15752,15753,15753,15753,15754,15754,15755,15755,15756,15756,15756,15757,15757,15758,15758,15759,15759,15759,15760,15760,15761,15761,15762,15762,15762,15763,15763,15764,15764,15765,15765,15765,15766,15766,15767,15767,15768,15768,15768,15769,15769,15770,15770,15771,15771,15771,15772,15772,15773,15773,15774,15774,15774,15775,15775,15776,15776,15776,15777,15777,15778,15778,15779,15779,15779,15780,15780,15781,15781,15782,15782,15782,15783,15783,15784,15784,15785,15785,15785,15786,15786,15787,15787,15787,15788,15788,15789,15789,15790,15790,15790,15791,15791,15792,15792,15792,15793,15793,15794,15794,15795,15795,15795,15796,15796,15797,15797,15797,15798,15798,15799,15799,15800,15800,15800,15801,15801,15802,15802,15802,15803,15803,15804,15804,15805,15805,15805,15806,15806,15807,15807,15807,15808,15808,15809,15809,15809,15810,15810,15811,15811,15812,15812,15812,15813,15813,15814,15814,15814,15815,15815,15816,15816,15816,15817,15817,15818,15818,15819,15819,15819,15820,15820,15821,15821,15821,15822,15822,15823,15823,15823,15824,15824,15825,15825,15825,15826,15826,15827,15827,15827,15828,15828,15829,15829,15829,15830,15830,15831,15831,15832,15832,15832,15833,15833,15834,15834,15834,15835,15835,15836,15836,15836,15837,15837,15838,15838,15838,15839,15839,15840,15840,15840,15841,15841,15842,15842,15842,15843,15843,15844,15844,15844,15845,15845,15846,15846,15846,15847,15847,15848,15848,15848,15849,15849,15850,15850,15850,15851,15851,15852,15852,15852,15853,15853,15854,15854,15854,15855,15855,15856,15856,15856,15857,15857,15857,15858,15858,15859,15859,15859,15860,15860,15861,15861,15861,15862,15862,15863,15863,15863,15864,15864,15865,15865,15865,15866,15866,15867,15867,15867,15868,15868,15868,15869,15869,15870,15870,15870,15871,15871,15872,15872,15872,15873,15873,15874,15874,15874,15875,15875,15875,15876,15876,15877,15877,15877,15878,15878,15879,15879,15879,15880,15880,15881,15881,15881,15882,15882,15882,15883,15883,15884,15884,15884,15885,15885,15886,15886,15886,15887,15887,15887,15888,15888,15889,15889,15889,15890,15890,15890,15891,15891,15892,15892,15892,15893,15893,15894,15894,15894,15895,15895,15895,15896,15896,15897,15897,15897,15898,15898,15898,15899,15899,15900,15900,15900,15901,15901,15902,15902,15902,15903,15903,15903,15904,15904,15905,15905,15905,15906,15906,15906,15907,15907,15908,15908,15908,15909,15909,15909,15910,15910,15911,15911,15911,15912,15912,15912,15913,15913,15914,15914,15914,15915,15915,15915,15916,15916,15917,15917,15917,15918,15918,15918,15919,15919,15919,15920,15920,15921,15921,15921,15922,15922,15922,15923,15923,15924,15924,15924,15925,15925,15925,15926,15926,15927,15927,15927,15928,15928,15928,15929,15929,15929,15930,15930,15931,15931,15931,15932,15932,15932,15933,15933,15933,15934,15934,15935,15935,15935,15936,15936,15936,15937,15937,15937,15938,15938,15939,15939,15939,15940,15940,15940,15941,15941,15941,15942,15942,15943,15943,15943,15944,15944,15944,15945,15945,15945,15946,15946,15947,15947,15947,15948,15948,15948,15949,15949,15949,15950,15950,15950,15951,15951,15952,15952,15952,15953,15953,15953,15954,15954,15954,15955,15955,15956,15956,15956,15957,15957,15957,15958,15958,15958,15959,15959,15959,15960,15960,15960,15961,15961,15962,15962,15962,15963,15963,15963,15964,15964,15964,15965,15965,15965,15966,15966,15966,15967,15967,15968,15968,15968,15969,15969,15969,15970,15970,15970,15971,15971,15971,15972,15972,15972,15973,15973,15973,15974,15974,15975,15975,15975,15976,15976,15976,15977,15977,15977,15978,15978,15978,15979,15979,15979,15980,15980,15980,15981,15981,15981,15982,15982,15983,15983,15983,15984,15984,15984,15985,15985,15985,15986,15986,15986,15987,15987,15987,15988,15988,15988,15989,15989,15989,15990,15990,15990,15991,15991,15991,15992,15992,15992,15993,15993,15993,15994,15994,15995,15995,15995,15996,15996,15996,15997,15997,15997,15998,15998,15998,15999,15999,15999,16000,16000,16000,16001,16001,16001,16002,16002,16002,16003,16003,16003,16004,16004,16004,16005,16005,16005,16006,16006,16006,16007,16007,16007,16008,16008,16008,16009,16009,16009,16010,16010,16010,16011,16011,16011,16012,16012,16012,16013,16013,16013,16014,16014,16014,16015,16015,16015,16016,16016,16016,16017,16017,16017,16018,16018,16018,16019,16019,16019,16020,16020,16020,16021,16021,16021,16022,16022,16022,16023,16023,16023,16024,16024,16024,16025,16025,16025,16025,16026,16026,16026,16027,16027,16027,16028,16028,16028,16029,16029,16029,16030,16030,16030,16031,16031,16031,16032,16032,16032,16033,16033,16033,16034,16034,16034,16035,16035,16035,16036,16036,16036,16037,16037,16037,16037,16038,16038,16038,16039,16039,16039,16040,16040,16040,16041,16041,16041,16042,16042,16042,16043,16043,16043,16044,16044,16044,16044,16045,16045,16045,16046,16046,16046,16047,16047,16047,16048,16048,16048,16049,16049,16049,16050,16050,16050,16050,16051,16051,16051,16052,16052,16052,16053,16053,16053,16054,16054,16054,16055,16055,16055,16056,16056,16056,16056,16057,16057,16057,16058,16058,16058,16059,16059,16059,16060,16060,16060,16060,16061,16061,16061,16062,16062,16062,16063,16063,16063,16064,16064,16064,16065,16065,16065,16065,16066,16066,16066,16067,16067,16067,16068,16068,16068,16069,16069,16069,16069,16070,16070,16070,16071,16071,16071,16072,16072,16072,16072,16073,16073,16073,16074,16074,16074,16075,16075,16075,16076,16076,16076,16076,16077,16077,16077,16078,16078,16078,16079,16079,16079,16079,16080,16080,16080,16081,16081,16081,16082,16082,16082,16082,16083,16083,16083,16084,16084,16084,16085,16085,16085,16085,16086,16086,16086,16087,16087,16087,16088,16088,16088,16088,16089,16089,16089,16090,16090,16090,16090,16091,16091,16091,16092,16092,16092,16093,16093,16093,16093,16094,16094,16094,16095,16095,16095,16095,16096,16096,16096,16097,16097,16097,16098,16098,16098,16098,16099,16099,16099,16100,16100,16100,16100,16101,16101,16101,16102,16102,16102,16102,16103,16103,16103,16104,16104,16104,16104,16105,16105,16105,16106,16106,16106,16107,16107,16107,16107,16108,16108,16108,16109,16109,16109,16109,16110,16110,16110,16111,16111,16111,16111,16112,16112,16112,16113,16113,16113,16113,16114,16114,16114,16114,16115,16115,16115,16116,16116,16116,16116,16117,16117,16117,16118,16118,16118,16118,16119,16119,16119,16120,16120,16120,16120,16121,16121,16121,16122,16122,16122,16122,16123,16123,16123,16123,16124,16124,16124,16125,16125,16125,16125,16126,16126,16126,16127,16127,16127,16127,16128,16128,16128,16128,16129,16129,16129,16130,16130,16130,16130,16131,16131,16131,16131,16132,16132,16132,16133,16133,16133,16133,16134,16134,16134,16134,16135,16135,16135,16136,16136,16136,16136,16137,16137,16137,16137,16138,16138,16138,16139,16139,16139,16139,16140,16140,16140,16140,16141,16141,16141,16142,16142,16142,16142,16143,16143,16143,16143,16144,16144,16144,16144,16145,16145,16145,16146,16146,16146,16146,16147,16147,16147,16147,16148,16148,16148,16148,16149,16149,16149,16150,16150,16150,16150,16151,16151,16151,16151,16152,16152,16152,16152,16153,16153,16153,16153,16154,16154,16154,16155,16155,16155,16155,16156,16156,16156,16156,16157,16157,16157,16157,16158,16158,16158,16158,16159,16159,16159,16159,16160,16160,16160,16160,16161,16161,16161,16162,16162,16162,16162,16163,16163,16163,16163,16164,16164,16164,16164,16165,16165,16165,16165,16166,16166,16166,16166,16167,16167,16167,16167,16168,16168,16168,16168,16169,16169,16169,16169,16170,16170,16170,16170,16171,16171,16171,16171,16172,16172,16172,16172,16173,16173,16173,16173,16174,16174,16174,16174,16175,16175,16175,16175,16176,16176,16176,16176,16177,16177,16177,16177,16178,16178,16178,16178,16179,16179,16179,16179,16180,16180,16180,16180,16181,16181,16181,16181,16182,16182,16182,16182,16183,16183,16183,16183,16184,16184,16184,16184,16185,16185,16185,16185,16186,16186,16186,16186,16187,16187,16187,16187,16187,16188,16188,16188,16188,16189,16189,16189,16189,16190,16190,16190,16190,16191,16191,16191,16191,16192,16192,16192,16192,16193,16193,16193,16193,16193,16194,16194,16194,16194,16195,16195,16195,16195,16196,16196,16196,16196,16197,16197,16197,16197,16198,16198,16198,16198,16198,16199,16199,16199,16199,16200,16200,16200,16200,16201,16201,16201,16201,16202,16202,16202,16202,16202,16203,16203,16203,16203,16204,16204,16204,16204,16205,16205,16205,16205,16205,16206,16206,16206,16206,16207,16207,16207,16207,16208,16208,16208,16208,16208,16209,16209,16209,16209,16210,16210,16210,16210,16210,16211,16211,16211,16211,16212,16212,16212,16212,16213,16213,16213,16213,16213,16214,16214,16214,16214,16215,16215,16215,16215,16215,16216,16216,16216,16216,16217,16217,16217,16217,16217,16218,16218,16218,16218,16219,16219,16219,16219,16219,16220,16220,16220,16220,16221,16221,16221,16221,16221,16222,16222,16222,16222,16223,16223,16223,16223,16223,16224,16224,16224,16224,16225,16225,16225,16225,16225,16226,16226,16226,16226,16226,16227,16227,16227,16227,16228,16228,16228,16228,16228,16229,16229,16229,16229,16229,16230,16230,16230,16230,16231,16231,16231,16231,16231,16232,16232,16232,16232,16232,16233,16233,16233,16233,16234,16234,16234,16234,16234,16235,16235,16235,16235,16235,16236,16236,16236,16236,16236,16237,16237,16237,16237,16238,16238,16238,16238,16238,16239,16239,16239,16239,16239,16240,16240,16240,16240,16240,16241,16241,16241,16241,16241,16242,16242,16242,16242,16242,16243,16243,16243,16243,16244,16244,16244,16244,16244,16245,16245,16245,16245,16245,16246,16246,16246,16246,16246,16247,16247,16247,16247,16247,16248,16248,16248,16248,16248,16249,16249,16249,16249,16249,16250,16250,16250,16250,16250,16251,16251,16251,16251,16251,16252,16252,16252,16252,16252,16253,16253,16253,16253,16253,16254,16254,16254,16254,16254,16255,16255,16255,16255,16255,16256,16256,16256,16256,16256,16257,16257,16257,16257,16257,16257,16258,16258,16258,16258,16258,16259,16259,16259,16259,16259,16260,16260,16260,16260,16260,16261,16261,16261,16261,16261,16262,16262,16262,16262,16262,16262,16263,16263,16263,16263,16263,16264,16264,16264,16264,16264,16265,16265,16265,16265,16265,16265,16266,16266,16266,16266,16266,16267,16267,16267,16267,16267,16268,16268,16268,16268,16268,16268,16269,16269,16269,16269,16269,16270,16270,16270,16270,16270,16271,16271,16271,16271,16271,16271,16272,16272,16272,16272,16272,16273,16273,16273,16273,16273,16273,16274,16274,16274,16274,16274,16275,16275,16275,16275,16275,16275,16276,16276,16276,16276,16276,16276,16277,16277,16277,16277,16277,16278,16278,16278,16278,16278,16278,16279,16279,16279,16279,16279,16280,16280,16280,16280,16280,16280,16281,16281,16281,16281,16281,16281,16282,16282,16282,16282,16282,16282,16283,16283,16283,16283,16283,16284,16284,16284,16284,16284,16284,16285,16285,16285,16285,16285,16285,16286,16286,16286,16286,16286,16286,16287,16287,16287,16287,16287,16287,16288,16288,16288,16288,16288,16288,16289,16289,16289,16289,16289,16289,16290,16290,16290,16290,16290,16290,16291,16291,16291,16291,16291,16291,16292,16292,16292,16292,16292,16292,16293,16293,16293,16293,16293,16293,16294,16294,16294,16294,16294,16294,16295,16295,16295,16295,16295,16295,16296,16296,16296,16296,16296,16296,16297,16297,16297,16297,16297,16297,16298,16298,16298,16298,16298,16298,16298,16299,16299,16299,16299,16299,16299,16300,16300,16300,16300,16300,16300,16301,16301,16301,16301,16301,16301,16301,16302,16302,16302,16302,16302,16302,16303,16303,16303,16303,16303,16303,16303,16304,16304,16304,16304,16304,16304,16305,16305,16305,16305,16305,16305,16305,16306,16306,16306,16306,16306,16306,16307,16307,16307,16307,16307,16307,16307,16308,16308,16308,16308,16308,16308,16309,16309,16309,16309,16309,16309,16309,16310,16310,16310,16310,16310,16310,16310,16311,16311,16311,16311,16311,16311,16311,16312,16312,16312,16312,16312,16312,16312,16313,16313,16313,16313,16313,16313,16314,16314,16314,16314,16314,16314,16314,16315,16315,16315,16315,16315,16315,16315,16316,16316,16316,16316,16316,16316,16316,16317,16317,16317,16317,16317,16317,16317,16318,16318,16318,16318,16318,16318,16318,16318,16319,16319,16319,16319,16319,16319,16319,16320,16320,16320,16320,16320,16320,16320,16321,16321,16321,16321,16321,16321,16321,16322,16322,16322,16322,16322,16322,16322,16322,16323,16323,16323,16323,16323,16323,16323,16324,16324,16324,16324,16324,16324,16324,16324,16325,16325,16325,16325,16325,16325,16325,16326,16326,16326,16326,16326,16326,16326,16326,16327,16327,16327,16327,16327,16327,16327,16327,16328,16328,16328,16328,16328,16328,16328,16329,16329,16329,16329,16329,16329,16329,16329,16330,16330,16330,16330,16330,16330,16330,16330,16331,16331,16331,16331,16331,16331,16331,16331,16332,16332,16332,16332,16332,16332,16332,16332,16333,16333,16333,16333,16333,16333,16333,16333,16334,16334,16334,16334,16334,16334,16334,16334,16334,16335,16335,16335,16335,16335,16335,16335,16335,16336,16336,16336,16336,16336,16336,16336,16336,16337,16337,16337,16337,16337,16337,16337,16337,16337,16338,16338,16338,16338,16338,16338,16338,16338,16338,16339,16339,16339,16339,16339,16339,16339,16339,16340,16340,16340,16340,16340,16340,16340,16340,16340,16341,16341,16341,16341,16341,16341,16341,16341,16341,16342,16342,16342,16342,16342,16342,16342,16342,16342,16343,16343,16343,16343,16343,16343,16343,16343,16343,16344,16344,16344,16344,16344,16344,16344,16344,16344,16345,16345,16345,16345,16345,16345,16345,16345,16345,16345,16346,16346,16346,16346,16346,16346,16346,16346,16346,16347,16347,16347,16347,16347,16347,16347,16347,16347,16347,16348,16348,16348,16348,16348,16348,16348,16348,16348,16349,16349,16349,16349,16349,16349,16349,16349,16349,16349,16350,16350,16350,16350,16350,16350,16350,16350,16350,16350,16351,16351,16351,16351,16351,16351,16351,16351,16351,16351,16351,16352,16352,16352,16352,16352,16352,16352,16352,16352,16352,16353,16353,16353,16353,16353,16353,16353,16353,16353,16353,16354,16354,16354,16354,16354,16354,16354,16354,16354,16354,16354,16355,16355,16355,16355,16355,16355,16355,16355,16355,16355,16355,16356,16356,16356,16356,16356,16356,16356,16356,16356,16356,16356,16357,16357,16357,16357,16357,16357,16357,16357,16357,16357,16357,16358,16358,16358,16358,16358,16358,16358,16358,16358,16358,16358,16358,16359,16359,16359,16359,16359,16359,16359,16359,16359,16359,16359,16359,16360,16360,16360,16360,16360,16360,16360,16360,16360,16360,16360,16360,16361,16361,16361,16361,16361,16361,16361,16361,16361,16361,16361,16361,16362,16362,16362,16362,16362,16362,16362,16362,16362,16362,16362,16362,16362,16363,16363,16363,16363,16363,16363,16363,16363,16363,16363,16363,16363,16363,16364,16364,16364,16364,16364,16364,16364,16364,16364,16364,16364,16364,16364,16365,16365,16365,16365,16365,16365,16365,16365,16365,16365,16365,16365,16365,16366,16366,16366,16366,16366,16366,16366,16366,16366,16366,16366,16366,16366,16366,16367,16367,16367,16367,16367,16367,16367,16367,16367,16367,16367,16367,16367,16367,16367,16368,16368,16368,16368,16368,16368,16368,16368,16368,16368,16368,16368,16368,16368,16368,16369,16369,16369,16369,16369,16369,16369,16369,16369,16369,16369,16369,16369,16369,16369,16370,16370,16370,16370,16370,16370,16370,16370,16370,16370,16370,16370,16370,16370,16370,16370,16371,16371,16371,16371,16371,16371,16371,16371,16371,16371,16371,16371,16371,16371,16371,16371,16371,16372,16372,16372,16372,16372,16372,16372,16372,16372,16372,16372,16372,16372,16372,16372,16372,16372,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16373,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16374,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16375,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16376,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16377,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16378,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16379,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16380,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16381,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16382,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,16383,}
+#define RECIP_TABLE_128 {65535,65028,64528,64035,63550,63072,62602,62138,61681,61231,60787,60350,59919,59494,59075,58662,58254,57852,57456,57065,56680,56299,55924,55554,55188,54828,54471,54120,53773,53431,53092,52759,52429,52103,51782,51464,51150,50840,50534,50231,49932,49637,49345,49056,48771,48489,48210,47935,47663,47393,47127,46864,46603,46346,46091,45839,45590,45344,45100,44859,44620,44384,44151,43919,43691,43464,43240,43019,42799,42582,42367,42154,41943,41734,41528,41323,41121,40920,40721,40525,40330,40137,39946,39756,39569,39383,39199,39017,38836,38657,38480,38304,38130,37958,37787,37617,37449,37283,37118,36954,36792,36631,36472,36314,36158,36003,35849,35696,35545,35395,35246,35099,34953,34808,34664,34521,34380,34239,34100,33962,33825,33689,33554,33421,33288,33157,33026,32897,32768,}
+#define ATAN_TABLE_64 {0,3,5,8,10,13,15,18,20,23,25,28,30,33,35,38,40,42,45,47,49,52,54,56,58,61,63,65,67,69,71,74,76,78,80,82,84,85,87,89,91,93,95,96,98,100,102,103,105,106,108,110,111,113,114,116,117,119,120,121,123,124,125,127,128,}
+#define LOG2_TABLE_64 {0,733,1455,2166,2866,3556,4236,4907,5568,6220,6863,7498,8124,8742,9352,9954,10549,11136,11716,12289,12855,13415,13968,14514,15055,15589,16117,16639,17156,17667,18173,18673,19168,19658,20143,20623,21098,21568,22034,22495,22952,23404,23852,24296,24736,25172,25604,26031,26455,26876,27292,27705,28114,28520,28922,29321,29717,30109,30498,30884,31267,31647,32024,32397,32768,}
+#define EXP2_TABLE_64 {16384,16562,16743,16925,17109,17296,17484,17674,17867,18061,18258,18457,18658,18861,19066,19274,19484,19696,19911,20127,20347,20568,20792,21019,21247,21479,21713,21949,22188,22430,22674,22921,23170,23423,23678,23936,24196,24460,24726,24995,25268,25543,25821,26102,26386,26674,26964,27258,27554,27855,28158,28464,28774,29088,29405,29725,30048,30376,30706,31041,31379,31720,32066,32415,32768,}
+#define SIN_Q15_TABLE_64 {0,804,1608,2410,3212,4011,4808,5602,6393,7179,7962,8739,9512,10278,11039,11793,12539,13279,14010,14732,15446,16151,16846,17530,18204,18868,19519,20159,20787,21403,22005,22594,23170,23731,24279,24811,25329,25832,26319,26790,27245,27683,28105,28510,28898,29268,29621,29956,30273,30571,30852,31113,31356,31580,31785,31971,32137,32285,32412,32521,32609,32678,32728,32757,32767,}
+#define IIR_ALPHA_FMIN 20
+#define IIR_ALPHA_STEPS 24
+#define IIR_ALPHA_TABLE_8000 {1014,1043,1073,1104,1135,1168,1202,1236,1272,1308,1346,1385,1424,1465,1507,1550,1594,1640,1687,1735,1784,1835,1887,1941,1996,2053,2111,2171,2232,2295,2360,2427,2495,2566,2638,2712,2788,2866,2946,3028,3113,3200,3289,3380,3474,3570,3669,3770,3874,3981,4090,4202,4318,4435,4556,4680,4807,4938,5071,5208,5348,5492,5639,5789,5944,6102,6263,6429,6598,6772,6949,7131,7316,7506,7700,7898,8101,8309,8520,8737,8958,9184,9414,9649,9889,10134,10384,10639,10899,11164,11434,11709,11989,12275,12566,12862,13163,13469,13781,14098,14420,14748,15080,15418,15761,16110,16463,16822,17185,17554,17928,18306,18690,19078,19471,19868,20271,20677,21088,21503,21923,22346,22773,23204,23639,24077,24519,24963,25411,25862,26316,26772,27230,27691,28154,28618,29085,29553,30022,30492,30964,31436,31909,32382,32855,33328,33801,34273,34745,35216,35686,36155,36622,37088,37552,38014,38474,38932,39387,39840,40289,40736,41180,41620,42057,42490,42920,43346,43768,44186,44599,45009,45413,45814,46210,46601,46987,47369,47746,48118,48485,48846,49203,49555,49901,50242,50578,50909,51235,51555,51870,52180,52484,52783,53078,53366,53650,53928,54202,54470,54733,54991,55244,55492,55735,55974,56207,56436,56660,56879,57094,57304,57510,57711,57908,58100,58288,58473,58652,58828,59000,59168,59332,59493,59649,59802,59952,60097,60240,60379,60514,60646,60776,60901,61024,61144,61261,61375,61486,61594,61700,61803,61903,62001,62097,62190,62280,62368,62454,62538,62620,62699,62776,62852,62925,62996,63066,}
+#define IIR_ALPHA_TABLE_11025 {739,760,782,805,828,852,876,902,928,955,982,1010,1040,1070,1100,1132,1165,1198,1233,1268,1304,1342,1380,1420,1461,1502,1545,1590,1635,1682,1730,1779,1830,1882,1935,1990,2047,2105,2164,2226,2289,2353,2420,2488,2558,2630,2704,2780,2858,2938,3020,3104,3191,3279,3371,3464,3560,3659,3760,3863,3970,4079,4191,4305,4423,4544,4667,4794,4924,5057,5193,5333,5476,5623,5773,5927,6085,6246,6411,6580,6753,6930,7111,7296,7486,7679,7877,8080,8287,8498,8714,8934,9160,9390,9624,9864,10108,10358,10612,10871,11136,11405,11680,11960,12245,12535,12830,13131,13437,13748,14064,14386,14713,15045,15382,15725,16073,16426,16784,17147,17515,17888,18266,18649,19037,19429,19826,20228,20634,21045,21459,21878,22301,22728,23159,23593,24031,24472,24917,25364,25815,26268,26724,27182,27642,28105,28570,29036,29504,29973,30443,30914,31386,31859,32332,32805,33278,33751,34224,34696,35167,35637,36106,36573,37039,37504,37966,38426,38884,39339,39792,40242,40689,41133,41574,42011,42445,42875,43301,43724,44142,44556,44966,45371,45772,46168,46560,46947,47329,47707,48079,48446,48809,49166,49518,49865,50207,50543,50875,51201,51522,51837,52147,52453,52752,53047,53336,53620,53899,54173,54442,54706,54964,55218,55466,55710,55949,56183,56412,56636,56856,57071,57282,57488,57690,57887,58080,58269,58453,58634,58810,58982,59151,59315,59476,59633,59786,59936,60082,60225,60364,60500,60633,60762,60888,61012,61132,61249,61363,61475,61583,61689,61792,61893,61991,62087,62180,}
+#define IIR_ALPHA_TABLE_16000 {511,526,541,557,573,589,606,624,642,661,680,700,720,741,762,784,807,830,854,879,904,931,957,985,1014,1043,1073,1104,1135,1168,1202,1236,1272,1308,1346,1385,1424,1465,1507,1550,1594,1640,1687,1735,1784,1835,1887,1941,1996,2053,2111,2171,2232,2295,2360,2427,2495,2566,2638,2712,2788,2866,2946,3028,3113,3200,3289,3380,3474,3570,3669,3770,3874,3981,4090,4202,4318,4435,4556,4680,4807,4938,5071,5208,5348,5492,5639,5789,5944,6102,6263,6429,6598,6772,6949,7131,7316,7506,7700,7898,8101,8309,8520,8737,8958,9184,9414,9649,9889,10134,10384,10639,10899,11164,11434,11709,11989,12275,12566,12862,13163,13469,13781,14098,14420,14748,15080,15418,15761,16110,16463,16822,17185,17554,17928,18306,18690,19078,19471,19868,20271,20677,21088,21503,21923,22346,22773,23204,23639,24077,24519,24963,25411,25862,26316,26772,27230,27691,28154,28618,29085,29553,30022,30492,30964,31436,31909,32382,32855,33328,33801,34273,34745,35216,35686,36155,36622,37088,37552,38014,38474,38932,39387,39840,40289,40736,41180,41620,42057,42490,42920,43346,43768,44186,44599,45009,45413,45814,46210,46601,46987,47369,47746,48118,48485,48846,49203,49555,49901,50242,50578,50909,51235,51555,51870,52180,52484,52783,53078,53366,53650,53928,54202,54470,54733,54991,55244,55492,55735,55974,56207,56436,56660,56879,57094,57304,57510,57711,57908,58100,58288,58473,58652,58828,59000,59168,59332,59493,59649,59802,59952,60097,60240,60379,60514,60646,60776,}
+#define IIR_ALPHA_TABLE_22050 {371,382,393,405,417,429,441,454,467,481,495,509,524,539,555,571,588,605,622,640,659,678,698,718,739,760,782,805,828,852,876,902,928,955,982,1010,1040,1070,1100,1132,1165,1198,1233,1268,1304,1342,1380,1420,1461,1502,1545,1590,1635,1682,1730,1779,1830,1882,1935,1990,2047,2105,2164,2226,2289,2353,2420,2488,2558,2630,2704,2780,2858,2938,3020,3104,3191,3279,3371,3464,3560,3659,3760,3863,3970,4079,4191,4305,4423,4544,4667,4794,4924,5057,5193,5333,5476,5623,5773,5927,6085,6246,6411,6580,6753,6930,7111,7296,7486,7679,7877,8080,8287,8498,8714,8934,9160,9390,9624,9864,10108,10358,10612,10871,11136,11405,11680,11960,12245,12535,12830,13131,13437,13748,14064,14386,14713,15045,15382,15725,16073,16426,16784,17147,17515,17888,18266,18649,19037,19429,19826,20228,20634,21045,21459,21878,22301,22728,23159,23593,24031,24472,24917,25364,25815,26268,26724,27182,27642,28105,28570,29036,29504,29973,30443,30914,31386,31859,32332,32805,33278,33751,34224,34696,35167,35637,36106,36573,37039,37504,37966,38426,38884,39339,39792,40242,40689,41133,41574,42011,42445,42875,43301,43724,44142,44556,44966,45371,45772,46168,46560,46947,47329,47707,48079,48446,48809,49166,49518,49865,50207,50543,50875,51201,51522,51837,52147,52453,52752,53047,53336,53620,53899,54173,54442,54706,54964,55218,55466,55710,55949,56183,56412,56636,56856,57071,57282,57488,57690,57887,58080,58269,58453,58634,58810,58982,59151,}
+#define IIR_ALPHA_TABLE_32000 {256,264,272,279,288,296,305,314,323,332,342,352,362,372,383,395,406,418,430,442,455,469,482,496,511,526,541,557,573,589,606,624,642,661,680,700,720,741,762,784,807,830,854,879,904,931,957,985,1014,1043,1073,1104,1135,1168,1202,1236,1272,1308,1346,1385,1424,1465,1507,1550,1594,1640,1687,1735,1784,1835,1887,1941,1996,2053,2111,2171,2232,2295,2360,2427,2495,2566,2638,2712,2788,2866,2946,3028,3113,3200,3289,3380,3474,3570,3669,3770,3874,3981,4090,4202,4318,4435,4556,4680,4807,4938,5071,5208,5348,5492,5639,5789,5944,6102,6263,6429,6598,6772,6949,7131,7316,7506,7700,7898,8101,8309,8520,8737,8958,9184,9414,9649,9889,10134,10384,10639,10899,11164,11434,11709,11989,12275,12566,12862,13163,13469,13781,14098,14420,14748,15080,15418,15761,16110,16463,16822,17185,17554,17928,18306,18690,19078,19471,19868,20271,20677,21088,21503,21923,22346,22773,23204,23639,24077,24519,24963,25411,25862,26316,26772,27230,27691,28154,28618,29085,29553,30022,30492,30964,31436,31909,32382,32855,33328,33801,34273,34745,35216,35686,36155,36622,37088,37552,38014,38474,38932,39387,39840,40289,40736,41180,41620,42057,42490,42920,43346,43768,44186,44599,45009,45413,45814,46210,46601,46987,47369,47746,48118,48485,48846,49203,49555,49901,50242,50578,50909,51235,51555,51870,52180,52484,52783,53078,53366,53650,53928,54202,54470,54733,54991,55244,55492,55735,55974,56207,56436,56660,}
+#define IIR_ALPHA_TABLE_44100 {186,192,197,203,209,215,221,228,234,241,248,256,263,271,279,287,295,304,313,322,331,341,351,361,371,382,393,405,417,429,441,454,467,481,495,509,524,539,555,571,588,605,622,640,659,678,698,718,739,760,782,805,828,852,876,902,928,955,982,1010,1040,1070,1100,1132,1165,1198,1233,1268,1304,1342,1380,1420,1461,1502,1545,1590,1635,1682,1730,1779,1830,1882,1935,1990,2047,2105,2164,2226,2289,2353,2420,2488,2558,2630,2704,2780,2858,2938,3020,3104,3191,3279,3371,3464,3560,3659,3760,3863,3970,4079,4191,4305,4423,4544,4667,4794,4924,5057,5193,5333,5476,5623,5773,5927,6085,6246,6411,6580,6753,6930,7111,7296,7486,7679,7877,8080,8287,8498,8714,8934,9160,9390,9624,9864,10108,10358,10612,10871,11136,11405,11680,11960,12245,12535,12830,13131,13437,13748,14064,14386,14713,15045,15382,15725,16073,16426,16784,17147,17515,17888,18266,18649,19037,19429,19826,20228,20634,21045,21459,21878,22301,22728,23159,23593,24031,24472,24917,25364,25815,26268,26724,27182,27642,28105,28570,29036,29504,29973,30443,30914,31386,31859,32332,32805,33278,33751,34224,34696,35167,35637,36106,36573,37039,37504,37966,38426,38884,39339,39792,40242,40689,41133,41574,42011,42445,42875,43301,43724,44142,44556,44966,45371,45772,46168,46560,46947,47329,47707,48079,48446,48809,49166,49518,49865,50207,50543,50875,51201,51522,51837,52147,52453,52752,53047,53336,53620,53899,}
+#define IIR_ALPHA_TABLE_48000 {171,176,181,187,192,198,203,209,215,222,228,235,242,249,256,264,271,279,287,296,304,313,322,332,341,351,362,372,383,394,406,417,430,442,455,468,482,496,510,525,540,556,572,589,606,623,641,660,679,699,719,740,761,783,806,829,853,878,903,930,956,984,1012,1042,1072,1102,1134,1167,1200,1235,1270,1307,1344,1383,1423,1463,1505,1548,1593,1638,1685,1733,1782,1833,1885,1939,1994,2051,2109,2168,2230,2293,2358,2424,2493,2563,2635,2709,2785,2863,2943,3025,3110,3196,3285,3377,3470,3566,3665,3766,3870,3977,4086,4198,4313,4431,4552,4675,4802,4933,5066,5203,5343,5486,5633,5783,5938,6095,6257,6422,6592,6765,6942,7123,7309,7498,7692,7891,8093,8300,8512,8728,8949,9175,9405,9640,9880,10125,10374,10629,10889,11153,11423,11698,11978,12264,12554,12850,13151,13457,13769,14085,14407,14735,15067,15405,15748,16096,16449,16808,17171,17539,17913,18291,18675,19063,19455,19853,20255,20661,21072,21487,21906,22329,22756,23187,23622,24060,24501,24946,25394,25844,26298,26754,27212,27673,28136,28600,29067,29534,30004,30474,30945,31417,31890,32363,32836,33309,33782,34255,34727,35198,35668,36137,36604,37070,37534,37996,38456,38914,39369,39822,40272,40719,41162,41603,42040,42473,42903,43329,43751,44169,44583,44993,45398,45798,46194,46586,46972,47354,47731,48103,48470,48832,49189,49541,49888,50229,50565,50896,51222,51543,51858,52168,52472,52772,53066,}
+#define LFSR_JUMP_TABLE {0x80200003,0xc0300002,0xb02c0003,0xdb36c002,0xb6f6b6c3,0x8a0f3db5,0x90bd2fa6,0x972542a4,0x875e9ed7,0x850f2162,0xc1061468,0xe47b0eec,0xac0f3857,0xdc876165,0xe6dd6361,0xf903a31d,0xaae8aa26,0xddaec363,0xa2de7f75,0xc93fb911,0xf0ea7171,0xfe2a6206,0xbac2ac64,0xcffb0ecc,0xf4d28b3b,0xfb1e7482,0xefa1eac4,0xfcc5fc7b,0xab8b13f5,0x88e8ffa6,0x80a485a3,0x80208402,}
+#define NOISE_PERM_TABLE {48,221,169,88,185,106,81,77,17,208,180,177,239,33,131,42,230,51,38,203,150,184,202,95,6,65,204,87,149,168,70,50,102,216,76,75,45,49,30,225,9,159,136,57,124,94,2,252,130,7,226,90,83,212,121,47,104,144,68,69,217,234,119,32,60,241,79,142,236,93,66,250,135,28,44,91,139,53,143,182,213,23,4,141,154,189,67,112,232,243,163,192,19,205,52,219,109,166,193,73,179,229,31,3,210,197,111,114,181,120,157,78,89,107,125,187,113,63,133,246,123,167,164,158,165,156,190,162,235,71,248,5,101,152,242,176,195,64,132,108,249,99,116,160,103,251,118,238,117,86,215,110,12,122,26,54,145,126,174,74,233,196,211,223,80,82,35,0,18,1,220,128,173,97,237,175,36,224,228,16,13,140,72,146,115,194,29,222,8,98,240,218,34,127,254,171,172,161,206,200,22,84,37,40,100,41,201,186,244,15,178,183,96,199,138,20,188,21,227,214,61,209,25,170,155,14,85,46,247,11,24,231,59,137,245,62,253,147,151,129,191,39,153,56,27,43,134,92,255,10,105,55,58,207,148,198,}
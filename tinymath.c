@@ -29,3 +29,145 @@
 #include "tiny_table.h"
 
 const PROGMEM uint8_t tiny_sintable_64[] = SIN_TABLE_64;
+const PROGMEM uint16_t tiny_reciptable_128[] = RECIP_TABLE_128;
+const PROGMEM uint8_t tiny_atantable_64[] = ATAN_TABLE_64;
+const PROGMEM uint16_t tiny_log2table_64[] = LOG2_TABLE_64;
+const PROGMEM uint16_t tiny_exp2table_64[] = EXP2_TABLE_64;
+
+uint8_t sqrt_u16(uint16_t x) {
+	// classic bit-by-bit method, one result bit per iteration
+	uint16_t res = 0;
+	for (uint16_t bit = 1 << 14; bit != 0; bit >>= 2) {
+		if (x >= res + bit) {
+			x -= res + bit;
+			res = (res >> 1) + bit;
+		} else {
+			res >>= 1;
+		}
+	}
+	return (uint8_t) res;
+}
+
+uint16_t sqrt_u32(uint32_t x) {
+	uint32_t res = 0;
+	for (uint32_t bit = (uint32_t) 1 << 30; bit != 0; bit >>= 2) {
+		if (x >= res + bit) {
+			x -= res + bit;
+			res = (res >> 1) + bit;
+		} else {
+			res >>= 1;
+		}
+	}
+	return (uint16_t) res;
+}
+
+uint16_t recip_fix_u16(uint16_t d) {
+	if (d <= 1) {
+		return 0xffff;
+	}
+	// normalise to 0x8000..0xffff, d >= 2 so shift <= 14
+	uint8_t shift = 0;
+	while (!(d & 0x8000)) {
+		d <<= 1;
+		shift++;
+	}
+	// upper byte is the table index, lower byte the interpolation weight
+	uint8_t i = (uint8_t) (d >> 8) - 128;
+	uint8_t f = (uint8_t) d;
+	uint16_t r0 = pgm_read_word(&tiny_reciptable_128[i]);
+	uint16_t r1 = pgm_read_word(&tiny_reciptable_128[i + 1]);
+	// the table slope is < 512, so this fits into 16 bits
+	uint16_t r = r0 - (((r0 - r1) >> 1) * f >> 7);
+	// r = 2^31 / (d << shift), so 65536 / d = r >> (15 - shift)
+	return (uint16_t) (((uint32_t) r + (1 << (14 - shift))) >> (15 - shift));
+}
+
+uint8_t atan2_8(int16_t y, int16_t x) {
+	uint16_t ax = x < 0 ? -(uint16_t) x : (uint16_t) x;
+	uint16_t ay = y < 0 ? -(uint16_t) y : (uint16_t) y;
+	if (ax == 0 && ay == 0) {
+		return 0;
+	}
+	// fold into the first octant, so that b <= a
+	uint8_t swap = ay > ax;
+	uint16_t a = swap ? ay : ax;
+	uint16_t b = swap ? ax : ay;
+	// normalise a to 128..255, b follows along
+	while (a & 0xff00) {
+		a >>= 1;
+		b >>= 1;
+	}
+	while (!(a & 0x80)) {
+		a <<= 1;
+		b <<= 1;
+	}
+	// ratio b / a in Q0.8, using the reciprocal table (2^23 / a)
+	uint16_t ratio = (uint16_t) (((uint32_t) b * pgm_read_word(&tiny_reciptable_128[a - 128])) >> 15);
+	// interpolate the octant angle, the table is in 1/4 steps
+	uint8_t i = ratio >> 2;
+	uint8_t f = ratio & 3;
+	uint8_t t0 = pgm_read_byte(&tiny_atantable_64[i]);
+	uint8_t t1 = i < 64 ? pgm_read_byte(&tiny_atantable_64[i + 1]) : t0;
+	uint8_t angle = (uint8_t) ((t0 * 4 + (t1 - t0) * f + 8) >> 4);
+	// unfold
+	if (swap) {
+		angle = 64 - angle;
+	}
+	if (x < 0) {
+		angle = 128 - angle;
+	}
+	if (y < 0) {
+		angle = -angle;
+	}
+	return angle;
+}
+
+int16_t log2_fix16(uint32_t x) {
+	if (x == 0) {
+		return INT16_MIN;
+	}
+	// normalise to 1.m, tracking the exponent in Q8.8 (x is Q16.16)
+	int16_t e = (31 - 16) << 8;
+	while (!(x & 0xff000000)) {
+		x <<= 8;
+		e -= 8 << 8;
+	}
+	while (!(x & 0x80000000)) {
+		x <<= 1;
+		e -= 1 << 8;
+	}
+	// 6 bits of mantissa index, 8 bits of interpolation weight
+	uint8_t i = (uint8_t) (x >> 25) & 0x3f;
+	uint8_t f = (uint8_t) (x >> 17);
+	uint16_t l0 = pgm_read_word(&tiny_log2table_64[i]);
+	uint16_t l1 = pgm_read_word(&tiny_log2table_64[i + 1]);
+	// the table slope is < 1024
+	uint16_t l = l0 + (((l1 - l0) >> 2) * f >> 6);
+	// Q1.15 -> Q8.8
+	return e + ((l + 64) >> 7);
+}
+
+uint32_t exp2_fix16(int16_t x) {
+	// split into integer exponent and fraction
+	int8_t e = (int8_t) (x >> 8);
+	uint8_t fr = (uint8_t) x;
+	if (e >= 16) {
+		return 0xffffffff;
+	}
+	if (e < -16) {
+		return 0;
+	}
+	uint8_t i = fr >> 2;
+	uint8_t f = fr & 3;
+	uint16_t m0 = pgm_read_word(&tiny_exp2table_64[i]);
+	uint16_t m1 = pgm_read_word(&tiny_exp2table_64[i + 1]);
+	// Q2.14 mantissa
+	uint32_t m = m0 + (((m1 - m0) * f) >> 2);
+	// Q2.14 * 2^e -> Q16.16
+	int8_t shift = e + 2;
+	if (shift >= 0) {
+		return m << shift;
+	} else {
+		return (m + ((uint32_t) 1 << (-shift - 1))) >> -shift;
+	}
+}
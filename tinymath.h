@@ -34,9 +34,15 @@
 #else
 #define PROGMEM
 #define pgm_read_byte(ref) (*(uint8_t *) (ref))
+#define pgm_read_word(ref) (*(uint16_t *) (ref))
+#define pgm_read_dword(ref) (*(uint32_t *) (ref))
 #endif
 
 extern const PROGMEM uint8_t tiny_sintable_64[];
+extern const PROGMEM uint16_t tiny_reciptable_128[];
+extern const PROGMEM uint8_t tiny_atantable_64[];
+extern const PROGMEM uint16_t tiny_log2table_64[];
+extern const PROGMEM uint16_t tiny_exp2table_64[];
 
 static inline int8_t fastsin8(uint8_t angle) {
   uint8_t quadrant = angle >> 6;
@@ -153,4 +159,60 @@ static inline int8_t blend_fix_su8(int8_t a, int8_t b, uint8_t alpha) {
 	return mad_fix_su8(a, 255 - alpha, mul_us_su8(b, alpha));
 }
 
+// 16 bit fixed-point functions
+// these are table based. apart from dist_s8, which uses the 8x8 multiply
+// primitives above, they use plain 16 and 32 bit arithmetic.
+//
+// accuracy was measured against double precision over the full input range,
+// cycle counts are rough estimates for avr-gcc -Os on a 16MHz ATmega (MUL available).
+//
+// function       input        output      max. error        ~cycles
+// sqrt_u16       uint16_t     uint8_t     exact (floor)     150..180
+// sqrt_u32       uint32_t     uint16_t    exact (floor)     550..650
+// dist_s8        2x int8_t    uint8_t     exact (floor)     170..200
+// recip_fix_u16  uint16_t     Q0.16       0.67 LSB          60..150
+// atan2_8        2x int16_t   angle8      0.92 LSB          100..220
+// log2_fix16     Q16.16       Q8.8        0.55 LSB          80..260
+// exp2_fix16     Q8.8         Q16.16      0.005% + 0.5 LSB  70..200
+//
+// exp2_fix16 error is relative over the whole range, plus rounding. for x < 0
+// that is up to 1.83 LSB (e.g. x = -201), for tiny outputs it is all rounding.
+//
+// the spread in cycle counts comes from normalisation loops, which take longer
+// for inputs far from the table range.
+
+// integer square root, 16 -> 8 bit
+// returns floor(sqrt(x))
+uint8_t sqrt_u16(uint16_t x);
+
+// integer square root, 32 -> 16 bit
+// returns floor(sqrt(x))
+uint16_t sqrt_u32(uint32_t x);
+
+// euclidean distance of a vector
+// returns floor(sqrt(dx * dx + dy * dy)), which is at most 181
+static inline uint8_t dist_s8(int8_t dx, int8_t dy) {
+	return sqrt_u16((uint16_t) mul_us_s8(dx, dx) + (uint16_t) mul_us_s8(dy, dy));
+}
+
+// reciprocal in Q0.16 fixed point
+// returns 65536 / d, saturated to 65535 for d = 0 and d = 1
+uint16_t recip_fix_u16(uint16_t d);
+
+// four-quadrant arctangent
+// returns the angle of the vector (x, y) in the same units as fastsin8():
+// 0 = +x, 64 = +y, 128 = -x, 192 = -y
+// returns 0 for x = y = 0
+uint8_t atan2_8(int16_t y, int16_t x);
+
+// binary logarithm
+// x = Q16.16 fixed point value
+// returns log2(x) in Q8.8 fixed point, or INT16_MIN for x = 0
+int16_t log2_fix16(uint32_t x);
+
+// binary exponential
+// x = Q8.8 fixed point value
+// returns 2^x in Q16.16 fixed point, saturated for x >= 16.0 and 0 for x < -16.0
+uint32_t exp2_fix16(int16_t x);
+
 #endif /*_TINYMATH_H*/
@@ -0,0 +1,103 @@
+/*
+ * Interrupt driven UART receiver for AVR microcontrollers
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "uart.h"
+
+#ifdef UART_BAUD
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+// double speed mode divisor
+#define _UART_UBRR ((F_CPU) / 8 / (UART_BAUD) - 1)
+#if (F_CPU) % (8UL * (UART_BAUD)) != 0
+#error UART_BAUD can not be generated exactly from F_CPU
+#endif
+#define _UART_MASK (UART_RX_BUFFER - 1)
+
+static uint8_t uart_rx[UART_RX_BUFFER];
+static volatile uint8_t uart_head;
+static volatile uint8_t uart_tail;
+static volatile uint8_t uart_errors;
+
+ISR(USART_RX_vect) {
+	// flags must be read before the data register
+	uint8_t status = UCSR0A;
+	uint8_t byte = UDR0;
+	if (status & _BV(DOR0)) {
+		uart_errors |= UART_ERROR_OVERRUN;
+	}
+	if (status & _BV(FE0)) {
+		uart_errors |= UART_ERROR_FRAME;
+	}
+	uint8_t head = uart_head;
+	uint8_t next = (head + 1) & _UART_MASK;
+	if (next == uart_tail) {
+		uart_errors |= UART_ERROR_OVERFLOW;
+	} else {
+		uart_rx[head] = byte;
+		uart_head = next;
+	}
+}
+
+void uart_init() {
+	uart_head = 0;
+	uart_tail = 0;
+	uart_errors = 0;
+	UBRR0 = _UART_UBRR;
+	UCSR0A = _BV(U2X0);
+	// 8N1
+	UCSR0C = _BV(UCSZ01) | _BV(UCSZ00);
+	UCSR0B = _BV(RXCIE0) | _BV(RXEN0) | _BV(TXEN0);
+}
+
+uint8_t uart_available() {
+	return (uart_head - uart_tail) & _UART_MASK;
+}
+
+uint8_t uart_get() {
+	uint8_t tail = uart_tail;
+	uint8_t byte = uart_rx[tail];
+	uart_tail = (tail + 1) & _UART_MASK;
+	return byte;
+}
+
+void uart_put(uint8_t byte) {
+	while (!(UCSR0A & _BV(UDRE0)));
+	UDR0 = byte;
+}
+
+uint8_t uart_get_errors() {
+	uint8_t errors;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		errors = uart_errors;
+		uart_errors = 0;
+	}
+	return errors;
+}
+
+#endif
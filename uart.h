@@ -0,0 +1,75 @@
+/*
+ * Interrupt driven UART receiver for AVR microcontrollers
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _UART_H
+#define _UART_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+
+// Supported configuration variables:
+// UART_BAUD: Baud rate of USART0. Define to enable the UART.
+// The receiver runs in double speed mode, so F_CPU / 8 / UART_BAUD
+// must be an integer. 1000000 and 2000000 are exact at 16MHz.
+// Defaults to undefined.
+//#define UART_BAUD 1000000
+// UART_RX_BUFFER: Size of the receive ring buffer in bytes.
+// Must be a power of two and no larger than 256.
+// Defaults to 64.
+#ifndef UART_RX_BUFFER
+#define UART_RX_BUFFER 64
+#endif
+#if UART_RX_BUFFER > 256 || (UART_RX_BUFFER & (UART_RX_BUFFER - 1)) != 0
+#error UART_RX_BUFFER must be a power of two <= 256
+#endif
+
+// Receive error flags, see uart_get_errors()
+// receive buffer overflow
+#define UART_ERROR_OVERFLOW 0x01
+// hardware data overrun (a byte was lost while interrupts were disabled)
+#define UART_ERROR_OVERRUN 0x02
+// framing error
+#define UART_ERROR_FRAME 0x04
+
+// Initializes the UART: 8N1, receive interrupt enabled.
+// Interrupts must be enabled globally for reception.
+void uart_init();
+
+// Returns the number of bytes waiting in the receive buffer.
+uint8_t uart_available();
+
+// Returns the next byte from the receive buffer.
+// Must only be called when uart_available() is > 0.
+uint8_t uart_get();
+
+// Sends one byte, blocks until the transmit register is free.
+void uart_put(uint8_t byte);
+
+// Returns and clears the accumulated receive error flags.
+uint8_t uart_get_errors();
+
+#endif /*_UART_H*/
@@ -0,0 +1,279 @@
+/*
+ * Frame streaming sender
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include "ws2812.h"
+#include "pxcodec.h"
+#include "stream.h"
+
+// in-process stand-ins for the receiver, used by the loopback mode
+uint8_t ws_fb[_WS_FB_SIZE];
+#if PAL_MODE == PAL_MODE_RAM
+pal_t PAL_TABLE_VAR;
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+// Time the controller needs to show a frame, in us: ws_scan_fb() sends
+// WS_PIXEL_BYTES per pixel with interrupts disabled, then latches. The bit
+// period is the one of the code in ws2812.c, not the data sheet minimum.
+#if WS_DRIVER == WS_DRIVER_APA102
+#define SCAN_CYCLES_BIT (WS_SPI_DIV)
+#else
+#include "clocks.h"
+#define SCAN_CYCLES_BIT _WS_CYCLES_BIT
+#endif
+#define SCAN_US ((WS_START_BYTES + (double) _WS_FB_SIZE * WS_PIXEL_BYTES + WS_END_BYTES) * 8 * SCAN_CYCLES_BIT / (F_CPU / 1e6) + WS_T_RES)
+
+// largest possible packet: header, palette or frame payload, checksum
+#define PACKET_MAX (4 + 1 + 3 * 256 + pxc_encode_bound(_WS_FB_SIZE) + _WS_FB_SIZE + 1)
+
+static void usage(const char *name) {
+	fprintf(stderr, "Usage: %s [-d <device>] [-b <baud>] [-p <palette>] [-t] [-n <frames>] [-l]\n", name);
+	fprintf(stderr, "Streams raw frames (%u bytes each) from stdin to the controller.\n", _WS_FB_SIZE);
+	fprintf(stderr, "-d  Serial device (default: /dev/ttyUSB0)\n");
+	fprintf(stderr, "-b  Baud rate (default: 1000000)\n");
+	fprintf(stderr, "-p  Send a palette file first (256 r, g, b triples)\n");
+	fprintf(stderr, "-t  Send a test pattern instead of reading stdin\n");
+	fprintf(stderr, "-n  Number of test pattern frames (default: 1000)\n");
+	fprintf(stderr, "-l  Loopback: decode in-process instead of sending\n");
+	exit(1);
+}
+
+// builds a packet around a payload, returns the packet size
+static size_t packetize(uint8_t type, const uint8_t *payload, size_t len, uint8_t *out) {
+	out[0] = STREAM_SYNC;
+	out[1] = type;
+	out[2] = (uint8_t) len;
+	out[3] = (uint8_t) (len >> 8);
+	memcpy(&out[4], payload, len);
+	uint8_t sum = type + out[2] + out[3];
+	for (size_t i = 0; i < len; i++) {
+		sum += payload[i];
+	}
+	out[4 + len] = -sum;
+	return len + 5;
+}
+
+// builds the smallest frame packet, delta encoded against prev if not NULL
+static size_t frame_packet(const uint8_t *frame, const uint8_t *prev, uint8_t *out) {
+	uint8_t coded[pxc_encode_bound(_WS_FB_SIZE)];
+	size_t len = pxc_encode(frame, prev, _WS_FB_SIZE, coded);
+	if (len < _WS_FB_SIZE) {
+		return packetize(STREAM_TYPE_CODED, coded, len, out);
+	}
+	return packetize(STREAM_TYPE_FRAME, frame, _WS_FB_SIZE, out);
+}
+
+// a static gradient with a bar moving across it
+static void test_pattern(unsigned int t, uint8_t *frame) {
+	for (unsigned int y = 0; y < WS_HEIGHT; y++) {
+		for (unsigned int x = 0; x < WS_WIDTH; x++) {
+			unsigned int bar = (t / 2) % WS_WIDTH;
+			frame[y * WS_WIDTH + x] = (x >= bar && x < bar + 2) ? 255 : (uint8_t) (y * 16 + x * 4);
+		}
+	}
+}
+
+static bool next_frame(bool pattern, unsigned int t, unsigned int frames, uint8_t *frame) {
+	if (pattern) {
+		test_pattern(t, frame);
+		return t < frames;
+	}
+	return fread(frame, _WS_FB_SIZE, 1, stdin) == 1;
+}
+
+static int open_serial(const char *device, unsigned long baud) {
+	speed_t speed;
+	switch (baud) {
+	case 115200: speed = B115200; break;
+	case 500000: speed = B500000; break;
+	case 1000000: speed = B1000000; break;
+	case 2000000: speed = B2000000; break;
+	default:
+		fprintf(stderr, "Unsupported baud rate %lu\n", baud);
+		return -1;
+	}
+	int fd = open(device, O_RDWR | O_NOCTTY);
+	if (fd < 0) {
+		perror(device);
+		return -1;
+	}
+	struct termios tio;
+	tcgetattr(fd, &tio);
+	cfmakeraw(&tio);
+	cfsetspeed(&tio, speed);
+	// wait up to 0.5s for a response
+	tio.c_cc[VMIN] = 0;
+	tio.c_cc[VTIME] = 5;
+	tcsetattr(fd, TCSANOW, &tio);
+	return fd;
+}
+
+// waits for an ACK or NAK, returns true on ACK
+static bool wait_ack(int fd) {
+	uint8_t byte;
+	while (read(fd, &byte, 1) == 1) {
+		if (byte == STREAM_ACK) {
+			return true;
+		}
+		if (byte == STREAM_NAK) {
+			return false;
+		}
+	}
+	fprintf(stderr, "Timeout waiting for the controller\n");
+	return false;
+}
+
+// feeds a packet to the in-process receiver, returns the last status
+static uint8_t loopback(const uint8_t *packet, size_t len) {
+	uint8_t status = STREAM_NONE;
+	for (size_t i = 0; i < len; i++) {
+		uint8_t s = stream_feed(packet[i]);
+		if (s != STREAM_NONE) {
+			status = s;
+		}
+	}
+	return status;
+}
+
+int main(int argc, char **argv) {
+	const char *device = "/dev/ttyUSB0";
+	const char *palfile = NULL;
+	unsigned long baud = 1000000;
+	unsigned int frames = 1000;
+	bool pattern = false, loop = false;
+	int opt;
+	while ((opt = getopt(argc, argv, "d:b:p:tn:lh")) != -1) {
+		switch (opt) {
+		case 'd': device = optarg; break;
+		case 'b': baud = strtoul(optarg, NULL, 0); break;
+		case 'p': palfile = optarg; break;
+		case 't': pattern = true; break;
+		case 'n': frames = strtoul(optarg, NULL, 0); break;
+		case 'l': loop = true; break;
+		default: usage(argv[0]);
+		}
+	}
+
+	int fd = -1;
+	if (loop) {
+		stream_init();
+	} else {
+		fd = open_serial(device, baud);
+		if (fd < 0) {
+			return 1;
+		}
+		// the controller sends an ACK after reset, but we may have missed it
+		tcflush(fd, TCIFLUSH);
+	}
+
+	static uint8_t packet[PACKET_MAX];
+	if (palfile) {
+		uint8_t pal[1 + 3 * 256];
+		FILE *pf = fopen(palfile, "rb");
+		if (!pf || fread(&pal[1], 3 * 256, 1, pf) != 1) {
+			fprintf(stderr, "Can't read palette %s\n", palfile);
+			return 1;
+		}
+		fclose(pf);
+		pal[0] = 0;
+		size_t len = packetize(STREAM_TYPE_PALETTE, pal, sizeof(pal), packet);
+		if (loop) {
+			loopback(packet, len);
+		} else {
+			write(fd, packet, len);
+			wait_ack(fd);
+		}
+	}
+
+	uint8_t frame[_WS_FB_SIZE], prev[_WS_FB_SIZE];
+	bool key = true;
+	unsigned int count = 0, errors = 0;
+	size_t bytes = 0;
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	while (next_frame(pattern, count, frames, frame)) {
+		size_t len = frame_packet(frame, key ? NULL : prev, packet);
+		bool ok;
+		if (loop) {
+			ok = loopback(packet, len) == STREAM_SHOW && memcmp(ws_fb, frame, _WS_FB_SIZE) == 0;
+		} else {
+			ok = write(fd, packet, len) == (ssize_t) len && wait_ack(fd);
+		}
+		if (!ok) {
+			// the receiver's frame buffer is unknown now, resend as key frame
+			errors++;
+			len = frame_packet(frame, NULL, packet);
+			if (loop) {
+				loopback(packet, len);
+			} else {
+				write(fd, packet, len);
+				wait_ack(fd);
+			}
+		}
+		bytes += len;
+		memcpy(prev, frame, _WS_FB_SIZE);
+		key = false;
+		count++;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	double secs = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	double avg = count ? (double) bytes / count : 0;
+	fprintf(stderr, "%u frames, %u errors, %.1f bytes/frame (raw %u)\n", count, errors, avg, _WS_FB_SIZE + 5);
+	if (loop) {
+		// only the speed of the decoder on this computer, not the controller's
+		fprintf(stderr, "%.0f frames/s decoded in-process\n", secs > 0 ? count / secs : 0);
+	} else {
+		fprintf(stderr, "%.0f frames/s sustained\n", secs > 0 ? count / secs : 0);
+	}
+	if (avg > 0) {
+		// Each frame is a round trip: the packet goes out, the controller
+		// shows it and answers with a 1 byte ACK. Bytes are 10 bits on the
+		// wire. The decoder keeps up with the UART, so decoding is hidden
+		// in the packet time. The latency of the host's serial driver is
+		// not included.
+		double packet = avg * 10 * 1e6 / baud, ack = 10 * 1e6 / baud;
+		fprintf(stderr, "%.0f frames/s expected at %lu baud: %.0fus packet, %.0fus ACK, %.0fus scan and latch\n",
+			1e6 / (packet + ack + SCAN_US), baud, packet, ack, SCAN_US);
+	}
+
+	if (fd >= 0) {
+		close(fd);
+	}
+	return 0;
+}
@@ -36,57 +36,91 @@
 // Some internal conveniences
 #define _WS_REG_PORT _WS_CONCAT(PORT, WS_PORT)
 #define _WS_REG_DDR _WS_CONCAT(DDR, WS_PORT)
-// the total size of the frame buffer
-#define _WS_FB_SIZE ((WS_WIDTH) * (WS_HEIGHT))
-// number of chains: width * height / chain length
-#define _WS_NUM_CHAINS ((_WS_FB_SIZE) / (WS_CHAIN))
+// Check if the frame buffer fits into RAM, leaving some space for the stack
+// and the palette (if it lives in RAM).
+#define _WS_RAM_RESERVE 256
+#if PAL_MODE == PAL_MODE_RAM
+#define _WS_RAM_PALETTE (256 * 3)
+#else
+#define _WS_RAM_PALETTE 0
+#endif
+#if defined(RAMEND) && defined(RAMSTART)
+#if _WS_FB_SIZE + _WS_RAM_PALETTE + _WS_RAM_RESERVE > RAMEND - RAMSTART + 1
+#error The frame buffer is too big for this MCU
+#endif
+#endif
 
 uint8_t ws_fb[_WS_FB_SIZE] __attribute__((section(".noinit")));
 
-// Latch timing, the data sheet says >50us
-// Oh, and a latch is not a reset, by the way.
-#define WS_T_RES 60.0
-// The timings in the data sheet are wrong and inconsistent (t1 != t0).
-// What the fuck were these freaks smoking?
-// The correct timings are courtesy of Adafruit. Thanks!
-// With these values, they sum up to 1.25us and fit nicely into
-// 20 clock cycles at 16MHz.
-#define WS_T_0H 0.4375
-#define WS_T_0L 0.8125
-#define WS_T_1H 0.8125
-#define WS_T_1L 0.4375
+#if WS_DRIVER == WS_DRIVER_WS2812 || WS_DRIVER == WS_DRIVER_SK6812
+
+// Bit timing for F_CPU: delay cycles between the edges (_WS_PAD_A/B/C) and
+// the encoding to use, generated by genclocks.pl.
+#include "clocks.h"
 
 #define _ws_latch(port, bit) \
 	PORT##port &= ~_BV(bit); \
 	_delay_us(WS_T_RES);
-static inline void _ws_write_real(uint8_t port, uint8_t high, uint8_t pattern, uint8_t low) {
+// Delays are built from 2 cycle relative jumps (one word each),
+// plus a nop for odd cycle counts.
+#define _WS_DELAY(pad) \
+	".rept %[" #pad "] / 2\n\trjmp .+0\n\t.endr\n\t" \
+	".rept %[" #pad "] %% 2\n\tnop\n\t.endr\n\t"
+#if _WS_ENCODING == _WS_ENCODING_BIT
+// Sends one bit on each output that has its bit set in pattern.
+// padc is the delay after the bit, which may be shorter if the code that
+// follows takes long enough.
+static inline void _ws_write_real(uint8_t port, uint8_t high, uint8_t pattern, uint8_t low, uint8_t padc) {
 	asm volatile (
-		// write stage a: all high T=0
+		// write stage a: all high
 		"out %[Port], %[High]\n\t"
-		// wait 6 clock cycles (+ 1 cycle for out = 7) T=1
-		"rjmp .+0\n\t"
-		"rjmp .+0\n\t"
-		"rjmp .+0\n\t"
-		// write stage b: bit pattern T=7
+		// wait A clock cycles
+		_WS_DELAY(PadA)
+		// write stage b: bit pattern
 		"out %[Port], %[Pattern]\n\t"
-		// wait 5 more clock cycles (+ out = 6) T=8
-		"rjmp .+0\n\t"
-		"rjmp .+0\n\t"
-		"nop\n\t"
-		// write stage c: all low T=13
+		// wait B clock cycles
+		_WS_DELAY(PadB)
+		// write stage c: all low
 		"out %[Port], %[Low]\n\t"
-		// wait 7 clock cycles T=14
-		"rjmp .+0\n\t"
-		"rjmp .+0\n\t"
-		"rjmp .+0\n\t"
-		"nop\n\t"
-		// transfer complete T=21
+		// wait C clock cycles
+		_WS_DELAY(PadC)
+		// transfer complete
 		:
-		: [High] "r" (high), [Pattern] "r" (pattern), [Low] "r" (low), [Port] "I" (port)
+		: [High] "r" (high), [Pattern] "r" (pattern), [Low] "r" (low), [Port] "I" (port),
+		  [PadA] "I" (_WS_PAD_A), [PadB] "I" (_WS_PAD_B), [PadC] "I" (padc)
 		:
 	);
 }
-#define _ws_write(port, high, pattern, low) _ws_write_real(_SFR_IO_ADDR(port), high, pattern, low)
+#define _ws_write(port, high, pattern, low, padc) _ws_write_real(_SFR_IO_ADDR(port), high, pattern, low, padc)
+#else
+// Sends a whole byte, most significant bit first, on all outputs.
+// For slow clocks: there is no time to compute the pattern in C between the
+// bits, so a skip over the early low write decides between a 0 and a 1.
+static inline void _ws_write_byte_real(uint8_t port, uint8_t high, uint8_t data, uint8_t low) {
+	uint8_t count = 8;
+	asm volatile (
+		"1:\n\t"
+		// all high
+		"out %[Port], %[High]\n\t"
+		_WS_DELAY(PadA)
+		// end of a 0
+		"sbrs %[Data], 7\n\t"
+		"out %[Port], %[Low]\n\t"
+		"lsl %[Data]\n\t"
+		_WS_DELAY(PadB)
+		// end of a 1
+		"out %[Port], %[Low]\n\t"
+		_WS_DELAY(PadC)
+		"dec %[Count]\n\t"
+		"brne 1b\n\t"
+		: [Data] "+r" (data), [Count] "+r" (count)
+		: [High] "r" (high), [Low] "r" (low), [Port] "I" (port),
+		  [PadA] "I" (_WS_PAD_A), [PadB] "I" (_WS_PAD_B), [PadC] "I" (_WS_PAD_C)
+		:
+	);
+}
+#define _ws_write_byte(port, high, data, low) _ws_write_byte_real(_SFR_IO_ADDR(port), high, data, low)
+#endif
 
 void ws_init() {
 	_WS_REG_PORT &= ~0xfc;
@@ -95,6 +129,7 @@ void ws_init() {
 }
 
 void ws_scan_fb() {
+	uint8_t dither = ws_dither_next();
 	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
 		// fetch current port state and mask unused outputs
 		uint8_t low = _WS_REG_PORT & ~0xfc;
@@ -104,25 +139,37 @@ void ws_scan_fb() {
 #if 0
 		for (uint8_t i = 0; i < 8; i++) {
 			uint8_t pattern = low | 0x04;
-			_ws_write(D, high, pattern, low);
+			_ws_write(D, high, pattern, low, _WS_PAD_C);
 		}
 #endif
-		for (uint8_t p = 0; p < WS_CHAIN; p++) {
-			// fetch a color from the frame buffer
-			rgb_t rgb = pal_lookup(ws_fb[p]);
-			// arrayize and flip
-			uint8_t grb[] = { rgb.g, rgb.r, rgb.b };
-			//uint8_t grb[] = { 255, 0, 0 };
-			for (uint8_t c = 0; c < 3; c++) {
-				uint8_t g = grb[c];
-				for (uint8_t b = 0; b < 8; b++) {
+		// the pixel counter is only 16 bit wide on long chains. the extra
+		// cycles fall between two pixels, where the data line is low and
+		// the timing is not critical. the bit loop below is unaffected.
+		for (ws_index_t p = 0; p < WS_CHAIN; p++) {
+			// fetch a color from the frame buffer and bring it into wire order
+			uint8_t data[WS_PIXEL_BYTES];
+			ws_encode_pixel(ws_pixel_color(p, dither), data);
+#if _WS_ENCODING == _WS_ENCODING_BIT
+			uint8_t g = 0;
+			for (uint8_t c = 0; c < WS_PIXEL_BYTES; c++) {
+				g = data[c];
+				// all bits except the last one of the pixel
+				for (uint8_t b = c < WS_PIXEL_BYTES - 1 ? 8 : 7; b > 0; b--) {
 					// apply pixel pattern (during transition period high-low)
 					uint8_t pattern = low;
 					pattern |= (g & 0x80) ? 0x04 : 0x00;
-					_ws_write(_WS_REG_PORT, high, pattern, low);
+					_ws_write(_WS_REG_PORT, high, pattern, low, _WS_PAD_C);
 					g <<= 1;
 				}
 			}
+			// the last bit needs no padding, the palette lookup (and
+			// dithering) of the next pixel takes longer than that
+			_ws_write(_WS_REG_PORT, high, low | ((g & 0x80) ? 0x04 : 0x00), low, 0);
+#else
+			for (uint8_t c = 0; c < WS_PIXEL_BYTES; c++) {
+				_ws_write_byte(_WS_REG_PORT, high, data[c], low);
+			}
+#endif
 		}
 #if 0
 		// loop over the first chain - the other chains are referenced relative to that
@@ -145,3 +192,73 @@ void ws_scan_fb() {
 	// latch
 	_delay_us(WS_T_RES);
 }
+
+#elif WS_DRIVER == WS_DRIVER_APA102
+
+// SPI clock rate selection: SPR1, SPR0 and SPI2X
+#if WS_SPI_DIV == 2
+#define _WS_SPCR 0
+#define _WS_SPSR _BV(SPI2X)
+#elif WS_SPI_DIV == 4
+#define _WS_SPCR 0
+#define _WS_SPSR 0
+#elif WS_SPI_DIV == 8
+#define _WS_SPCR _BV(SPR0)
+#define _WS_SPSR _BV(SPI2X)
+#elif WS_SPI_DIV == 16
+#define _WS_SPCR _BV(SPR0)
+#define _WS_SPSR 0
+#elif WS_SPI_DIV == 32
+#define _WS_SPCR _BV(SPR1)
+#define _WS_SPSR _BV(SPI2X)
+#elif WS_SPI_DIV == 64
+#define _WS_SPCR _BV(SPR1)
+#define _WS_SPSR 0
+#elif WS_SPI_DIV == 128
+#define _WS_SPCR (_BV(SPR1) | _BV(SPR0))
+#define _WS_SPSR 0
+#else
+#error WS_SPI_DIV must be one of 2, 4, 8, 16, 32, 64, 128
+#endif
+
+void ws_init() {
+	// SS must be an output, or a low level on it would switch the SPI to slave mode
+	DDRB |= _BV(PB2) | _BV(PB3) | _BV(PB5);
+	// master, MSB first, clock idles low, sample on the rising edge
+	SPCR = _BV(SPE) | _BV(MSTR) | _WS_SPCR;
+	SPSR = _WS_SPSR;
+	memset(ws_fb, 0, WS_WIDTH * WS_HEIGHT * sizeof(ws_fb[0]));
+}
+
+// Waits until the previous byte has been shifted out, then starts the next one.
+// Whatever is computed between two calls overlaps with the transfer.
+static inline void _ws_spi_put(uint8_t data) {
+	loop_until_bit_is_set(SPSR, SPIF);
+	SPDR = data;
+}
+
+void ws_scan_fb() {
+	uint8_t dither = ws_dither_next();
+	// start frame. the first byte goes out without waiting,
+	// SPIF is only set after a transfer.
+	SPDR = 0;
+	for (uint8_t i = 1; i < WS_START_BYTES; i++) {
+		_ws_spi_put(0);
+	}
+	for (ws_index_t p = 0; p < WS_CHAIN; p++) {
+		// the palette lookup and dithering overlap with the transfer
+		// of the previous pixel
+		uint8_t data[WS_PIXEL_BYTES];
+		ws_encode_pixel(ws_pixel_color(p, dither), data);
+		for (uint8_t c = 0; c < WS_PIXEL_BYTES; c++) {
+			_ws_spi_put(data[c]);
+		}
+	}
+	for (ws_index_t i = 0; i < WS_END_BYTES; i++) {
+		_ws_spi_put(0);
+	}
+	loop_until_bit_is_set(SPSR, SPIF);
+	// no latch needed, the LEDs update as soon as their data has arrived
+}
+
+#endif
@@ -49,26 +49,226 @@
 // WS_ZIGZAG: Define if LED rows are connected head-to-head and tail-to-tail.
 // Defaults to undefined; rows are all scanned in the same direction.
 //#undef WS_ZIGZAG
-// WS_PORT: The GPIO port to use.
+// WS_DRIVER: The LED type, one of WS_DRIVER_WS2812, WS_DRIVER_SK6812, WS_DRIVER_APA102
+// Defaults to WS_DRIVER_WS2812.
+#ifndef WS_DRIVER
+#define WS_DRIVER WS_DRIVER_WS2812
+#endif
+// WS_DRIVER_WS2812: WS2812(B) RGB LEDs, bit-banged on WS_PORT.
+#define WS_DRIVER_WS2812 1
+// WS_DRIVER_SK6812: SK6812 RGBW LEDs, bit-banged on WS_PORT.
+// The white channel is extracted from the palette colors.
+#define WS_DRIVER_SK6812 2
+// WS_DRIVER_APA102: APA102 (or SK9822) RGB LEDs with a clock line, driven by
+// the hardware SPI peripheral. Data goes to MOSI (PB3/IO11), the clock to
+// SCK (PB5/IO13). Supports a single chain only.
+// Interrupts stay enabled during the transfer.
+#define WS_DRIVER_APA102 3
+// WS_PORT: The GPIO port to use (bit-banged drivers only).
 // This should be a single letter, not the PORTx register.
 // The following pins are available on the Arduino Uno/Pro:
 // PD2..7 (IO2..7)
 // PC0..5 (AD0..5)
 // PB0..1 (IO8..9)
-#ifndef WS_PORT
+#if WS_DRIVER != WS_DRIVER_APA102 && !defined(WS_PORT)
 #error WS_PORT must be defined
 #endif
+// WS_SPI_DIV: SPI clock divider for WS_DRIVER_APA102, one of 2, 4, 8, 16, 32, 64, 128.
+// Defaults to 2 (8MHz at F_CPU = 16MHz).
+#ifndef WS_SPI_DIV
+#define WS_SPI_DIV 2
+#endif
+// WS_APA102_BRIGHTNESS: Global brightness for WS_DRIVER_APA102, 0..31.
+// Defaults to 31.
+#ifndef WS_APA102_BRIGHTNESS
+#define WS_APA102_BRIGHTNESS 31
+#endif
 // WS_FIRST_PIN: The first GPIO pin number to use.
 // Defaults to 0.
 #ifndef WS_FIRST_PIN
 #define WS_FIRST_PIN 0
 #endif
+// WS_VIRTUAL: Define to replace the LED driver with a virtual display
+// for host builds, see ws_virtual.c.
+// Defaults to undefined.
+//#define WS_VIRTUAL
+
+// the total size of the frame buffer
+#define _WS_FB_SIZE ((WS_WIDTH) * (WS_HEIGHT))
+// number of chains: width * height / chain length
+#define _WS_NUM_CHAINS ((_WS_FB_SIZE) / (WS_CHAIN))
+
+#if _WS_FB_SIZE > 65535
+#error The frame buffer may not contain more than 65535 pixels
+#endif
+#if (_WS_FB_SIZE) % (WS_CHAIN) != 0
+#error WS_WIDTH x WS_HEIGHT must be a multiple of WS_CHAIN
+#endif
+#if WS_DRIVER == WS_DRIVER_APA102
+#if _WS_NUM_CHAINS != 1
+#error WS_DRIVER_APA102 only supports a single chain
+#endif
+#if WS_APA102_BRIGHTNESS > 31
+#error WS_APA102_BRIGHTNESS must be in the range 0..31
+#endif
+#elif WS_DRIVER == WS_DRIVER_WS2812 || WS_DRIVER == WS_DRIVER_SK6812
+#if _WS_NUM_CHAINS > 8 - WS_FIRST_PIN
+#error Not enough GPIO pins after WS_FIRST_PIN for all LED chains
+#endif
+#else
+#error Unsupported WS_DRIVER
+#endif
+
+// Pixel index and coordinate types.
+// These are 8 bit wide unless the display geometry needs more,
+// so small displays keep the fast 8 bit loops.
+#if _WS_FB_SIZE > 255
+typedef uint16_t ws_index_t;
+#else
+typedef uint8_t ws_index_t;
+#endif
+#if WS_WIDTH > 255 || WS_HEIGHT > 255
+typedef uint16_t ws_coord_t;
+#else
+typedef uint8_t ws_coord_t;
+#endif
 
 // The frame buffer
 extern uint8_t ws_fb[];
 
+// Wire format of each driver.
+// A frame is WS_START_BYTES zero bytes, then WS_PIXEL_BYTES per pixel as
+// produced by ws_encode_pixel(), then WS_END_BYTES zero bytes.
+// These are shared by the hardware drivers and the virtual display,
+// so the encoding can be checked on the host.
+// WS_T_RES is the latch time in us that ends a frame.
+#if WS_DRIVER == WS_DRIVER_WS2812
+#define WS_PIXEL_BYTES 3
+#define WS_START_BYTES 0
+#define WS_END_BYTES 0
+// the data sheet says >50us
+// Oh, and a latch is not a reset, by the way.
+#define WS_T_RES 60.0
+#elif WS_DRIVER == WS_DRIVER_SK6812
+#define WS_PIXEL_BYTES 4
+#define WS_START_BYTES 0
+#define WS_END_BYTES 0
+// The SK6812 needs a longer latch.
+#define WS_T_RES 80.0
+#elif WS_DRIVER == WS_DRIVER_APA102
+#define WS_PIXEL_BYTES 4
+// the LEDs update as soon as their data has arrived
+#define WS_T_RES 0.0
+// 32 zero bits start a frame
+#define WS_START_BYTES 4
+// data is delayed by half a clock per LED, so the end needs
+// WS_CHAIN / 2 extra clock edges to push it all the way through
+#define WS_END_BYTES (((WS_CHAIN) + 15) / 16)
+#endif
+
+// Encodes one pixel in the order the LEDs expect it.
+static inline void ws_encode_pixel(rgb_t rgb, uint8_t *out) {
+#if WS_DRIVER == WS_DRIVER_WS2812
+	out[0] = rgb.g;
+	out[1] = rgb.r;
+	out[2] = rgb.b;
+#elif WS_DRIVER == WS_DRIVER_SK6812
+	// move the grey part of the color to the white LED
+	uint8_t w = rgb.r < rgb.g ? rgb.r : rgb.g;
+	if (rgb.b < w) {
+		w = rgb.b;
+	}
+	out[0] = rgb.g - w;
+	out[1] = rgb.r - w;
+	out[2] = rgb.b - w;
+	out[3] = w;
+#elif WS_DRIVER == WS_DRIVER_APA102
+	out[0] = 0xe0 | WS_APA102_BRIGHTNESS;
+	out[1] = rgb.b;
+	out[2] = rgb.g;
+	out[3] = rgb.r;
+#endif
+}
+
+#ifdef PAL_DITHER
+// Temporal dithering
+//
+// Each channel is rounded up if its fraction is above a threshold. Over 256
+// frames, the threshold takes every value once, so the average is exact.
+// The thresholds come from a bit-reversed frame counter, which spreads them
+// evenly over any aligned run of 2, 4, 8... frames as well, and makes the
+// flicker as fast as possible. Each pixel gets its own offset, so pixels of
+// the same colour don't flicker in step.
+//
+// Cost: about 25 cycles per pixel on top of the 16 bit palette lookup.
+
+// Returns the base threshold for a frame counter. Call once per frame.
+static inline uint8_t ws_dither_frame(uint8_t frame) {
+	frame = (uint8_t) (frame << 4 | frame >> 4);
+	frame = (uint8_t) ((frame & 0x33) << 2 | (frame & 0xcc) >> 2);
+	return (uint8_t) ((frame & 0x55) << 1 | (frame & 0xaa) >> 1);
+}
+
+static inline uint8_t _ws_dither_channel(uint16_t value, uint8_t threshold) {
+	uint8_t result = value >> 8;
+	if ((uint8_t) value > threshold && result < 255) {
+		result++;
+	}
+	return result;
+}
+
+// Rounds a 16 bit color to 8 bits, for one frame.
+static inline rgb_t ws_dither(rgb16_t color, uint8_t threshold) {
+	return rgb_mk(_ws_dither_channel(color.r, threshold), _ws_dither_channel(color.g, threshold), _ws_dither_channel(color.b, threshold));
+}
+
+// Returns the threshold of a pixel, from the base threshold of the frame.
+// The xor keeps every pixel's sequence a bit-reversed counter.
+static inline uint8_t ws_dither_threshold(uint8_t base, ws_index_t pixel) {
+	return base ^ (uint8_t) ((uint8_t) pixel * 0x9d);
+}
+#endif
+
+// Returns the base threshold for the next frame, to be passed to
+// ws_pixel_color(). Call once per frame.
+static inline uint8_t ws_dither_next() {
+#ifdef PAL_DITHER
+	static uint8_t frame;
+	return ws_dither_frame(frame++);
+#else
+	return 0;
+#endif
+}
+
+// Returns the color of pixel p as it is sent. dither is the base threshold
+// of the current frame, from ws_dither_frame(). It's ignored if PAL_DITHER
+// is not defined.
+static inline rgb_t ws_pixel_color(ws_index_t p, uint8_t dither) {
+#ifdef PAL_DITHER
+	return ws_dither(pal_lookup16(ws_fb[p]), ws_dither_threshold(dither, p));
+#else
+	(void) dither;
+	return pal_lookup(ws_fb[p]);
+#endif
+}
+
+#ifdef WS_VIRTUAL
+// Number of pixel accesses through ws_set_pixel() and ws_get_pixel(),
+// used by the virtual display to model the rendering cost.
+extern uint32_t ws_virtual_accesses;
+// Estimated cycles of code that writes to ws_fb directly. Modules that
+// bypass ws_set_pixel() charge their own cost with _ws_count_cycles(),
+// using the named estimates from their headers, never bare numbers.
+extern uint32_t ws_virtual_cycles;
+#define _ws_count_access() (ws_virtual_accesses++)
+#define _ws_count_cycles(cycles) (ws_virtual_cycles += (cycles))
+#else
+#define _ws_count_access()
+#define _ws_count_cycles(cycles)
+#endif
+
 // Returns the index of a specific pixel inside the framebuffer.
-#define ws_get_pixel_index(x, y, width) ((y) * (width) + (x))
+#define ws_get_pixel_index(x, y, width) ((ws_index_t) ((ws_index_t) (y) * (width) + (x)))
 
 // Initializes the IO ports and clears the frame buffer
 void ws_init();
@@ -78,12 +278,14 @@ void ws_init();
 void ws_scan_fb();
 
 // Sets the pixel at x,y to a color value index
-static inline void ws_set_pixel(uint8_t x, uint8_t y, uint8_t index) {
+static inline void ws_set_pixel(ws_coord_t x, ws_coord_t y, uint8_t index) {
+	_ws_count_access();
 	ws_fb[ws_get_pixel_index(x, y, WS_WIDTH)] = index;
 }
 
 // Gets the color value of the pixel at x,y
-static inline uint8_t ws_get_pixel(uint8_t x, uint8_t y) {
+static inline uint8_t ws_get_pixel(ws_coord_t x, ws_coord_t y) {
+	_ws_count_access();
 	return ws_fb[ws_get_pixel_index(x, y, WS_WIDTH)];
 }
 
@@ -0,0 +1,311 @@
+/*
+ * Virtual display backend for host builds
+ * Copyright 2017 Gregor Riepl <onitake@gmail.com>
+ *
+ * Redistribution and use in source and binary forms, with or without modification, 
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this 
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, 
+ * this list of conditions and the following disclaimer in the documentation and/or 
+ * other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR 
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS 
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ws2812.h"
+
+// Replaces ws2812.c on the host. Instead of driving LEDs, every call to
+// ws_scan_fb() resolves the frame buffer through the palette, encodes it for
+// the configured WS_DRIVER, decodes it again and writes the frame to a file
+// or the terminal. It also models how many cycles the frame would take on
+// the target.
+//
+// Controlled through environment variables:
+// WP_FORMAT: ppm (concatenated binary PPM images), y4m (YUV4MPEG2 video)
+//            or ansi (true color terminal preview).
+//            Defaults to ansi if the output is a terminal, ppm otherwise.
+// WP_OUTPUT: output file, - for stdout (default)
+// WP_FRAMES: exit after this many frames, 0 = never (default)
+// WP_SCALE:  size of a pixel in ppm and y4m output (default: 8)
+// WP_FPS:    target frame rate for the cycle budget and the terminal
+//            preview (default: 50)
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+// Cycle model, after the code generated for ws2812.c.
+#if WS_DRIVER == WS_DRIVER_APA102
+// Transmission: each byte takes 8 SPI clocks, but at least as long as the
+// loop feeding the data register. The LEDs need no latch.
+#define _VD_CYCLES_BYTE (8 * WS_SPI_DIV > 12 ? 8 * WS_SPI_DIV : 12)
+#define _VD_CYCLES_BIT 0
+#define _VD_CYCLES_PIXEL 15
+#define _VD_CYCLES_LATCH 0
+#else
+// Transmission: the bit period for F_CPU comes from clocks.h, each byte
+// and pixel adds loop and palette lookup overhead, and the latch is a fixed
+// delay.
+#include "clocks.h"
+#define _VD_CYCLES_BIT _WS_CYCLES_BIT
+#define _VD_CYCLES_BYTE 4
+#define _VD_CYCLES_PIXEL 15
+#define _VD_CYCLES_LATCH ((uint32_t) (WS_T_RES * (F_CPU / 1000000)))
+#endif
+#ifdef PAL_DITHER
+// 16 bit palette lookup and dithering, per pixel
+#define _VD_CYCLES_DITHER 25
+#else
+#define _VD_CYCLES_DITHER 0
+#endif
+// Rendering: every access through ws_get_pixel() or ws_set_pixel(),
+// including the address calculation and a share of the surrounding
+// arithmetic. Modules writing to ws_fb directly (plasma, draw, blit, anim,
+// pxcodec) add their own estimates through _ws_count_cycles(). Any other
+// code that writes to ws_fb directly is not accounted for.
+#define _VD_CYCLES_ACCESS 12
+
+#define _VD_FORMAT_PPM 0
+#define _VD_FORMAT_Y4M 1
+#define _VD_FORMAT_ANSI 2
+
+// size of the data sent to the LEDs for one frame
+#define _VD_WIRE_SIZE (WS_START_BYTES + (uint32_t) _WS_FB_SIZE * WS_PIXEL_BYTES + WS_END_BYTES)
+
+uint8_t ws_fb[_WS_FB_SIZE];
+uint32_t ws_virtual_accesses;
+uint32_t ws_virtual_cycles;
+
+static FILE *vd_out;
+static uint8_t vd_format;
+static unsigned long vd_frames, vd_frame_limit;
+static unsigned int vd_scale, vd_fps;
+// statistics
+static unsigned long vd_over_budget;
+static uint64_t vd_render_total, vd_transmit_total;
+static uint32_t vd_render_max;
+
+static unsigned long _vd_env(const char *name, unsigned long def) {
+	const char *value = getenv(name);
+	return value ? strtoul(value, NULL, 0) : def;
+}
+
+static uint32_t _vd_budget() {
+	return F_CPU / vd_fps;
+}
+
+static void _vd_summary() {
+	if (vd_frames == 0) {
+		return;
+	}
+	fprintf(stderr, "%lu frames, estimated cycles per frame: render avg %llu max %lu, transmit %llu, budget %lu at %u fps\n",
+		vd_frames,
+		(unsigned long long) (vd_render_total / vd_frames), (unsigned long) vd_render_max,
+		(unsigned long long) (vd_transmit_total / vd_frames),
+		(unsigned long) _vd_budget(), vd_fps);
+	if (vd_over_budget) {
+		fprintf(stderr, "warning: %lu frames over budget\n", vd_over_budget);
+	}
+	if (vd_out && vd_out != stdout) {
+		fclose(vd_out);
+	}
+}
+
+void ws_init() {
+	const char *output = getenv("WP_OUTPUT");
+	if (!output || strcmp(output, "-") == 0) {
+		vd_out = stdout;
+	} else {
+		vd_out = fopen(output, "wb");
+		if (!vd_out) {
+			perror(output);
+			exit(1);
+		}
+	}
+	const char *format = getenv("WP_FORMAT");
+	if (format && strcmp(format, "ppm") == 0) {
+		vd_format = _VD_FORMAT_PPM;
+	} else if (format && strcmp(format, "y4m") == 0) {
+		vd_format = _VD_FORMAT_Y4M;
+	} else if (format && strcmp(format, "ansi") == 0) {
+		vd_format = _VD_FORMAT_ANSI;
+	} else {
+		vd_format = isatty(fileno(vd_out)) ? _VD_FORMAT_ANSI : _VD_FORMAT_PPM;
+	}
+	vd_frame_limit = _vd_env("WP_FRAMES", 0);
+	vd_scale = _vd_env("WP_SCALE", 8);
+	vd_fps = _vd_env("WP_FPS", 50);
+	if (vd_scale == 0) {
+		vd_scale = 1;
+	}
+	if (vd_fps == 0) {
+		vd_fps = 50;
+	}
+	if (vd_format == _VD_FORMAT_Y4M) {
+		fprintf(vd_out, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C444\n", WS_WIDTH * vd_scale, WS_HEIGHT * vd_scale, vd_fps);
+	} else if (vd_format == _VD_FORMAT_ANSI) {
+		// clear screen
+		fprintf(vd_out, "\x1b[2J");
+	}
+	atexit(_vd_summary);
+	memset(ws_fb, 0, sizeof(ws_fb));
+	ws_virtual_accesses = 0;
+	ws_virtual_cycles = 0;
+}
+
+static void _vd_write_ppm(const rgb_t *frame) {
+	fprintf(vd_out, "P6\n%u %u\n255\n", WS_WIDTH * vd_scale, WS_HEIGHT * vd_scale);
+	for (unsigned int y = 0; y < WS_HEIGHT * vd_scale; y++) {
+		for (unsigned int x = 0; x < WS_WIDTH * vd_scale; x++) {
+			const rgb_t *c = &frame[(y / vd_scale) * WS_WIDTH + x / vd_scale];
+			uint8_t rgb[3] = { c->r, c->g, c->b };
+			fwrite(rgb, 3, 1, vd_out);
+		}
+	}
+}
+
+static void _vd_write_y4m(const rgb_t *frame) {
+	fprintf(vd_out, "FRAME\n");
+	// one plane after the other, BT.601 studio range
+	for (uint8_t plane = 0; plane < 3; plane++) {
+		for (unsigned int y = 0; y < WS_HEIGHT * vd_scale; y++) {
+			for (unsigned int x = 0; x < WS_WIDTH * vd_scale; x++) {
+				const rgb_t *c = &frame[(y / vd_scale) * WS_WIDTH + x / vd_scale];
+				int v;
+				switch (plane) {
+				case 0:
+					v = ((66 * c->r + 129 * c->g + 25 * c->b + 128) >> 8) + 16;
+					break;
+				case 1:
+					v = ((-38 * c->r - 74 * c->g + 112 * c->b + 128) >> 8) + 128;
+					break;
+				default:
+					v = ((112 * c->r - 94 * c->g - 18 * c->b + 128) >> 8) + 128;
+					break;
+				}
+				fputc(v, vd_out);
+			}
+		}
+	}
+}
+
+static void _vd_write_ansi(const rgb_t *frame, uint32_t render, uint32_t transmit) {
+	// cursor home, two character cells per pixel
+	fprintf(vd_out, "\x1b[H");
+	for (unsigned int y = 0; y < WS_HEIGHT; y++) {
+		for (unsigned int x = 0; x < WS_WIDTH; x++) {
+			const rgb_t *c = &frame[y * WS_WIDTH + x];
+			fprintf(vd_out, "\x1b[48;2;%u;%u;%um  ", c->r, c->g, c->b);
+		}
+		fprintf(vd_out, "\x1b[0m\n");
+	}
+	fprintf(vd_out, "frame %lu render %lu transmit %lu budget %lu cycles\x1b[K\n",
+		vd_frames, (unsigned long) render, (unsigned long) transmit, (unsigned long) _vd_budget());
+	fflush(vd_out);
+	// pace the preview
+	struct timespec delay = { 0, 1000000000L / vd_fps };
+	nanosleep(&delay, NULL);
+}
+
+#if WS_DRIVER == WS_DRIVER_SK6812
+static uint8_t _vd_saturate(unsigned int value) {
+	return value > 255 ? 255 : value;
+}
+#endif
+
+// Decodes the wire data like the LEDs would, so the displayed frame
+// shows any mistakes in the encoding. Returns false on framing errors.
+static bool _vd_decode(const uint8_t *wire, rgb_t *frame) {
+	bool ok = true;
+	for (uint8_t i = 0; i < WS_START_BYTES; i++) {
+		ok = ok && wire[i] == 0;
+	}
+	const uint8_t *data = &wire[WS_START_BYTES];
+	for (ws_index_t p = 0; p < _WS_FB_SIZE; p++) {
+#if WS_DRIVER == WS_DRIVER_WS2812
+		frame[p] = rgb_mk(data[1], data[0], data[2]);
+#elif WS_DRIVER == WS_DRIVER_SK6812
+		// the white LED adds to all three channels
+		frame[p] = rgb_mk(_vd_saturate(data[1] + data[3]), _vd_saturate(data[0] + data[3]), _vd_saturate(data[2] + data[3]));
+#elif WS_DRIVER == WS_DRIVER_APA102
+		// a pixel starts with three 1 bits, followed by the brightness
+		ok = ok && (data[0] & 0xe0) == 0xe0;
+		uint8_t brightness = data[0] & 0x1f;
+		frame[p] = rgb_mk(data[3] * brightness / 31, data[2] * brightness / 31, data[1] * brightness / 31);
+#endif
+		data += WS_PIXEL_BYTES;
+	}
+	for (ws_index_t i = 0; i < WS_END_BYTES; i++) {
+		ok = ok && data[i] == 0;
+	}
+	return ok;
+}
+
+void ws_scan_fb() {
+	// resolve the palette and encode, just like the real driver does during the scan
+	uint8_t dither = ws_dither_next();
+	static uint8_t wire[_VD_WIRE_SIZE];
+	memset(wire, 0, sizeof(wire));
+	for (ws_index_t p = 0; p < _WS_FB_SIZE; p++) {
+		ws_encode_pixel(ws_pixel_color(p, dither), &wire[WS_START_BYTES + (uint32_t) p * WS_PIXEL_BYTES]);
+	}
+	rgb_t frame[_WS_FB_SIZE];
+	if (!_vd_decode(wire, frame)) {
+		fprintf(stderr, "warning: frame %lu has an invalid encoding\n", vd_frames);
+	}
+
+	// cycle model
+	uint32_t render = ws_virtual_accesses * _VD_CYCLES_ACCESS + ws_virtual_cycles;
+	uint32_t transmit = (uint32_t) _WS_FB_SIZE * (WS_PIXEL_BYTES * (8 * _VD_CYCLES_BIT + _VD_CYCLES_BYTE) + _VD_CYCLES_PIXEL + _VD_CYCLES_DITHER)
+		+ (WS_START_BYTES + WS_END_BYTES) * _VD_CYCLES_BYTE + _VD_CYCLES_LATCH;
+	ws_virtual_accesses = 0;
+	ws_virtual_cycles = 0;
+	vd_render_total += render;
+	vd_transmit_total += transmit;
+	if (render > vd_render_max) {
+		vd_render_max = render;
+	}
+	if (render + transmit > _vd_budget()) {
+		if (vd_over_budget == 0) {
+			fprintf(stderr, "warning: frame %lu needs %lu cycles, budget is %lu\n",
+				vd_frames, (unsigned long) (render + transmit), (unsigned long) _vd_budget());
+		}
+		vd_over_budget++;
+	}
+
+	switch (vd_format) {
+	case _VD_FORMAT_PPM:
+		_vd_write_ppm(frame);
+		break;
+	case _VD_FORMAT_Y4M:
+		_vd_write_y4m(frame);
+		break;
+	case _VD_FORMAT_ANSI:
+		_vd_write_ansi(frame, render, transmit);
+		break;
+	}
+
+	vd_frames++;
+	if (vd_frame_limit && vd_frames >= vd_frame_limit) {
+		exit(0);
+	}
+}